@@ -0,0 +1,254 @@
+//
+// Copyright 2018 - 2020 (C). Alex Robenko. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Compares the handling time of the code generated with --variant-dispatch
+// against the polymorphic one. The same input buffer of encoded messages is
+// read and dispatched to a handler:
+// - polymorphically: frame read allocating the message object followed by
+//   virtual dispatch.
+// - statically: frame readVariant() constructing the message in place
+//   inside std::variant followed by dispatchVariantMessage().
+// The best times of the runs are reported as a single line JSON object.
+// The application fails only when both paths produce different results.
+
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "bench_dispatch/Message.h"
+#include "bench_dispatch/frame/Frame.h"
+#include "bench_dispatch/input/AllMessages.h"
+#include "bench_dispatch/dispatch/VariantMessage.h"
+
+namespace
+{
+
+struct Config
+{
+    unsigned m_messages = 1000000U;
+    unsigned m_repeat = 5U;
+};
+
+class PolyHandler;
+
+using PolyInterface =
+    bench_dispatch::Message<
+        comms::option::app::IdInfoInterface,
+        comms::option::app::ReadIterator<const std::uint8_t*>,
+        comms::option::app::Handler<PolyHandler>
+    >;
+
+using PolyFrame = bench_dispatch::frame::Frame<PolyInterface>;
+
+using VariantInterface = bench_dispatch::Message<>;
+using VariantFrame = bench_dispatch::frame::Frame<VariantInterface>;
+using Variant = bench_dispatch::dispatch::MsgVariant<VariantInterface>;
+
+template <typename TMsg>
+std::uintmax_t sumFields(const TMsg& msg)
+{
+    return
+        static_cast<std::uintmax_t>(msg.doGetId()) +
+        msg.field_f1().value() +
+        msg.field_f2().value() +
+        msg.field_f3().value();
+}
+
+class PolyHandler
+{
+public:
+    template <typename TMsg>
+    void handle(TMsg& msg)
+    {
+        m_sum += sumFields(msg);
+    }
+
+    void handle(PolyInterface&)
+    {
+    }
+
+    std::uintmax_t m_sum = 0U;
+};
+
+class VariantHandler
+{
+public:
+    template <typename TMsg>
+    void handle(TMsg& msg)
+    {
+        m_sum += sumFields(msg);
+    }
+
+    void handle(std::monostate&)
+    {
+    }
+
+    std::uintmax_t m_sum = 0U;
+};
+
+void printHelp(std::ostream& out)
+{
+    out <<
+        "Usage: commsdsl2comms_dispatch_bench [options]\n"
+        "Options:\n"
+        "  --messages N    Number of messages in the input buffer.\n"
+        "  --repeat N      Number of runs, the best time is taken.\n"
+        "  --help          This help.\n";
+}
+
+bool parseArgs(int argc, const char* argv[], Config& config)
+{
+    for (auto idx = 1; idx < argc; ++idx) {
+        std::string arg(argv[idx]);
+        if ((idx + 1) == argc) {
+            std::cerr << "ERROR: Unknown option or missing value for \"" << arg << "\"" << std::endl;
+            return false;
+        }
+
+        std::string value(argv[idx + 1]);
+        ++idx;
+
+        if ((arg != "--messages") && (arg != "--repeat")) {
+            std::cerr << "ERROR: Unknown option \"" << arg << "\"" << std::endl;
+            return false;
+        }
+
+        char* end = nullptr;
+        auto result = std::strtoul(value.c_str(), &end, 0);
+        if ((end == value.c_str()) || (*end != '\0') || (result == 0U)) {
+            std::cerr << "ERROR: Invalid value \"" << value << "\" for \"" << arg << "\"" << std::endl;
+            return false;
+        }
+
+        auto& numValue = (arg == "--messages") ? config.m_messages : config.m_repeat;
+        numValue = static_cast<unsigned>(result);
+    }
+
+    return true;
+}
+
+// Every message is encoded as 1 byte ID followed by 7 bytes of fields
+std::vector<std::uint8_t> prepareInput(unsigned messages)
+{
+    static const std::size_t MsgTypesCount = bench_dispatch::MsgId_M8;
+    std::vector<std::uint8_t> buf;
+    buf.reserve(messages * 8U);
+    std::srand(0);
+    for (auto idx = 0U; idx < messages; ++idx) {
+        buf.push_back(static_cast<std::uint8_t>((static_cast<std::size_t>(std::rand()) % MsgTypesCount) + 1U));
+        for (auto byteIdx = 0U; byteIdx < 7U; ++byteIdx) {
+            buf.push_back(static_cast<std::uint8_t>(std::rand()));
+        }
+    }
+    return buf;
+}
+
+template <typename TFunc>
+double measure(unsigned repeat, TFunc&& func)
+{
+    double best = 0.0;
+    for (auto idx = 0U; idx < repeat; ++idx) {
+        auto start = std::chrono::steady_clock::now();
+        func();
+        auto duration = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+        if ((idx == 0U) || (duration < best)) {
+            best = duration;
+        }
+    }
+    return best;
+}
+
+} // namespace
+
+int main(int argc, const char* argv[])
+{
+    Config config;
+    for (auto idx = 1; idx < argc; ++idx) {
+        if (std::string(argv[idx]) == "--help") {
+            printHelp(std::cout);
+            return 0;
+        }
+    }
+
+    if (!parseArgs(argc, argv, config)) {
+        printHelp(std::cerr);
+        return -1;
+    }
+
+    auto input = prepareInput(config.m_messages);
+    auto* begin = input.data();
+    auto* end = begin + input.size();
+
+    std::uintmax_t polySum = 0U;
+    auto polyMs =
+        measure(
+            config.m_repeat,
+            [begin, end, &polySum]()
+            {
+                PolyFrame frame;
+                PolyHandler handler;
+                const std::uint8_t* iter = begin;
+                while (iter < end) {
+                    PolyFrame::MsgPtr msg;
+                    auto es = frame.read(msg, iter, static_cast<std::size_t>(end - iter));
+                    if (es != comms::ErrorStatus::Success) {
+                        std::cerr << "ERROR: Unexpected polymorphic read failure" << std::endl;
+                        std::exit(-1);
+                    }
+
+                    msg->dispatch(handler);
+                }
+                polySum = handler.m_sum;
+            });
+
+    std::uintmax_t variantSum = 0U;
+    auto variantMs =
+        measure(
+            config.m_repeat,
+            [begin, end, &variantSum]()
+            {
+                VariantFrame frame;
+                VariantHandler handler;
+                Variant msg;
+                const std::uint8_t* iter = begin;
+                while (iter < end) {
+                    auto es = frame.readVariant(msg, iter, static_cast<std::size_t>(end - iter));
+                    if (es != comms::ErrorStatus::Success) {
+                        std::cerr << "ERROR: Unexpected variant read failure" << std::endl;
+                        std::exit(-1);
+                    }
+
+                    bench_dispatch::dispatch::dispatchVariantMessage(msg, handler);
+                }
+                variantSum = handler.m_sum;
+            });
+
+    std::cout <<
+        "{\"messages\":" << config.m_messages <<
+        ",\"poly_ms\":" << polyMs <<
+        ",\"variant_ms\":" << variantMs <<
+        ",\"speedup\":" << ((0.0 < variantMs) ? (polyMs / variantMs) : 0.0) <<
+        "}" << std::endl;
+
+    if (polySum != variantSum) {
+        std::cerr << "ERROR: Different handling results: " << polySum << " vs " << variantSum << std::endl;
+        return -1;
+    }
+
+    return 0;
+}
@@ -0,0 +1,32 @@
+//
+// Copyright 2018 - 2020 (C). Alex Robenko. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Translation unit instantiating the generated message factory, compiled
+// by the factory_bench_compile target to measure the compilation time.
+
+#include "bench_factory/Message.h"
+#include "bench_factory/factory/MsgFactory.h"
+
+using Interface =
+    bench_factory::Message<
+        comms::option::app::IdInfoInterface
+    >;
+
+using Factory = bench_factory::factory::MsgFactory<Interface>;
+
+Factory::MsgPtr createMsg(bench_factory::MsgId id, unsigned idx)
+{
+    return Factory::createMsg(id, idx);
+}
@@ -0,0 +1,233 @@
+//
+// Copyright 2018 - 2020 (C). Alex Robenko. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Measures the message object creation latency for random message IDs:
+// - generated: generated switch based factory allocating the message.
+// - comms: comms::MsgFactory over the AllMessages bundle allocating the message.
+// - generated_in_place: generated factory constructing the message in the
+//   provided storage.
+// - comms_in_place: comms::MsgFactory with in-place allocation.
+// The best times of the runs are reported as a single line JSON object.
+// The application fails only when the factories create different messages.
+
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "comms/MsgFactory.h"
+#include "bench_factory/Message.h"
+#include "bench_factory/input/AllMessages.h"
+#include "bench_factory/factory/MsgFactory.h"
+
+namespace
+{
+
+struct Config
+{
+    unsigned m_creations = 1000000U;
+    unsigned m_repeat = 5U;
+};
+
+using Interface =
+    bench_factory::Message<
+        comms::option::app::IdInfoInterface
+    >;
+
+using AllMessages = bench_factory::input::AllMessages<Interface>;
+using GeneratedFactory = bench_factory::factory::MsgFactory<Interface>;
+using InPlaceStorage = bench_factory::factory::MsgFactoryInPlaceStorage<Interface>;
+using CommsFactory = comms::MsgFactory<Interface, AllMessages>;
+using CommsInPlaceFactory = comms::MsgFactory<Interface, AllMessages, comms::option::app::InPlaceAllocation>;
+
+void printHelp(std::ostream& out)
+{
+    out <<
+        "Usage: commsdsl2comms_factory_bench [options]\n"
+        "Options:\n"
+        "  --creations N   Number of created messages in every run.\n"
+        "  --repeat N      Number of runs, the best time is taken.\n"
+        "  --help          This help.\n";
+}
+
+bool parseArgs(int argc, const char* argv[], Config& config)
+{
+    for (auto idx = 1; idx < argc; ++idx) {
+        std::string arg(argv[idx]);
+        if ((idx + 1) == argc) {
+            std::cerr << "ERROR: Unknown option or missing value for \"" << arg << "\"" << std::endl;
+            return false;
+        }
+
+        std::string value(argv[idx + 1]);
+        ++idx;
+
+        unsigned* numValue = nullptr;
+        if (arg == "--creations") {
+            numValue = &config.m_creations;
+        }
+        else if (arg == "--repeat") {
+            numValue = &config.m_repeat;
+        }
+        else {
+            std::cerr << "ERROR: Unknown option \"" << arg << "\"" << std::endl;
+            return false;
+        }
+
+        char* end = nullptr;
+        auto result = std::strtoul(value.c_str(), &end, 0);
+        if ((end == value.c_str()) || (*end != '\0') || (result == 0U)) {
+            std::cerr << "ERROR: Invalid value \"" << value << "\" for \"" << arg << "\"" << std::endl;
+            return false;
+        }
+
+        *numValue = static_cast<unsigned>(result);
+    }
+
+    return true;
+}
+
+// All the message IDs are between 1 and the number of messages
+std::vector<bench_factory::MsgId> prepareIds(unsigned creations)
+{
+    static const std::size_t MsgTypesCount = std::tuple_size<AllMessages>::value;
+    std::vector<bench_factory::MsgId> ids;
+    ids.reserve(creations);
+    std::srand(0);
+    for (auto idx = 0U; idx < creations; ++idx) {
+        ids.push_back(static_cast<bench_factory::MsgId>((static_cast<std::size_t>(std::rand()) % MsgTypesCount) + 1U));
+    }
+    return ids;
+}
+
+template <typename TFunc>
+double measure(unsigned repeat, TFunc&& func)
+{
+    double best = 0.0;
+    for (auto idx = 0U; idx < repeat; ++idx) {
+        auto start = std::chrono::steady_clock::now();
+        func();
+        auto duration = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+        if ((idx == 0U) || (duration < best)) {
+            best = duration;
+        }
+    }
+    return best;
+}
+
+template <typename TCreateFunc>
+double measureCreation(unsigned repeat, const std::vector<bench_factory::MsgId>& ids, std::uintmax_t& sum, TCreateFunc&& func)
+{
+    return
+        measure(
+            repeat,
+            [&ids, &sum, &func]()
+            {
+                sum = 0U;
+                for (auto id : ids) {
+                    auto createdId = func(id);
+                    if (createdId != id) {
+                        std::cerr << "ERROR: Unexpected message created" << std::endl;
+                        std::exit(-1);
+                    }
+                    sum += static_cast<std::uintmax_t>(createdId);
+                }
+            });
+}
+
+} // namespace
+
+int main(int argc, const char* argv[])
+{
+    Config config;
+    for (auto idx = 1; idx < argc; ++idx) {
+        if (std::string(argv[idx]) == "--help") {
+            printHelp(std::cout);
+            return 0;
+        }
+    }
+
+    if (!parseArgs(argc, argv, config)) {
+        printHelp(std::cerr);
+        return -1;
+    }
+
+    auto ids = prepareIds(config.m_creations);
+
+    std::uintmax_t generatedSum = 0U;
+    auto generatedMs =
+        measureCreation(
+            config.m_repeat, ids, generatedSum,
+            [](bench_factory::MsgId id)
+            {
+                auto msg = GeneratedFactory::createMsg(id);
+                return msg->getId();
+            });
+
+    std::uintmax_t commsSum = 0U;
+    CommsFactory commsFactory;
+    auto commsMs =
+        measureCreation(
+            config.m_repeat, ids, commsSum,
+            [&commsFactory](bench_factory::MsgId id)
+            {
+                auto msg = commsFactory.createMsg(id);
+                return msg->getId();
+            });
+
+    std::uintmax_t generatedInPlaceSum = 0U;
+    InPlaceStorage storage;
+    auto generatedInPlaceMs =
+        measureCreation(
+            config.m_repeat, ids, generatedInPlaceSum,
+            [&storage](bench_factory::MsgId id)
+            {
+                auto* msg = GeneratedFactory::createMsgInPlace(id, 0U, &storage);
+                auto createdId = msg->getId();
+                msg->~Interface();
+                return createdId;
+            });
+
+    std::uintmax_t commsInPlaceSum = 0U;
+    CommsInPlaceFactory commsInPlaceFactory;
+    auto commsInPlaceMs =
+        measureCreation(
+            config.m_repeat, ids, commsInPlaceSum,
+            [&commsInPlaceFactory](bench_factory::MsgId id)
+            {
+                auto msg = commsInPlaceFactory.createMsg(id);
+                return msg->getId();
+            });
+
+    std::cout <<
+        "{\"messages\":" << std::tuple_size<AllMessages>::value <<
+        ",\"creations\":" << config.m_creations <<
+        ",\"generated_ms\":" << generatedMs <<
+        ",\"comms_ms\":" << commsMs <<
+        ",\"generated_in_place_ms\":" << generatedInPlaceMs <<
+        ",\"comms_in_place_ms\":" << commsInPlaceMs <<
+        "}" << std::endl;
+
+    if ((generatedSum != commsSum) ||
+        (generatedSum != generatedInPlaceSum) ||
+        (generatedSum != commsInPlaceSum)) {
+        std::cerr << "ERROR: Different creation results" << std::endl;
+        return -1;
+    }
+
+    return 0;
+}
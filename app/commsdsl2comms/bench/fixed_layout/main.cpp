@@ -0,0 +1,312 @@
+//
+// Copyright 2018 - 2020 (C). Alex Robenko. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Compares the fixed layout read and write of a message, generated when all
+// the fields have fixed serialisation length, against the default
+// implementation of comms::MessageBase, which iterates over the fields tuple
+// and checks the remaining length and the returned status for every field.
+// The same buffer of encoded messages is read and written by both paths.
+// The best times of the runs are reported as a single line JSON object.
+// The application fails only when both paths produce different results.
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <iterator>
+#include <string>
+#include <vector>
+
+#include "comms/util/Tuple.h"
+#include "bench_fixed_layout/Message.h"
+#include "bench_fixed_layout/message/M1.h"
+
+namespace
+{
+
+struct Config
+{
+    unsigned m_messages = 1000000U;
+    unsigned m_repeat = 5U;
+};
+
+using Interface = bench_fixed_layout::Message<>;
+using M1 = bench_fixed_layout::message::M1<Interface>;
+
+void printHelp(std::ostream& out)
+{
+    out <<
+        "Usage: commsdsl2comms_fixed_layout_bench [options]\n"
+        "Options:\n"
+        "  --messages N    Number of encoded messages in the buffer.\n"
+        "  --repeat N      Number of runs, the best time is taken.\n"
+        "  --help          This help.\n";
+}
+
+bool parseArgs(int argc, const char* argv[], Config& config)
+{
+    for (auto idx = 1; idx < argc; ++idx) {
+        std::string arg(argv[idx]);
+        if ((idx + 1) == argc) {
+            std::cerr << "ERROR: Unknown option or missing value for \"" << arg << "\"" << std::endl;
+            return false;
+        }
+
+        std::string value(argv[idx + 1]);
+        ++idx;
+
+        unsigned* numValue = nullptr;
+        if (arg == "--messages") {
+            numValue = &config.m_messages;
+        }
+        else if (arg == "--repeat") {
+            numValue = &config.m_repeat;
+        }
+        else {
+            std::cerr << "ERROR: Unknown option \"" << arg << "\"" << std::endl;
+            return false;
+        }
+
+        char* end = nullptr;
+        auto result = std::strtoul(value.c_str(), &end, 0);
+        if ((end == value.c_str()) || (*end != '\0') || (result == 0U)) {
+            std::cerr << "ERROR: Invalid value \"" << value << "\" for \"" << arg << "\"" << std::endl;
+            return false;
+        }
+
+        *numValue = static_cast<unsigned>(result);
+    }
+
+    return true;
+}
+
+// Same logic as the default read of comms::MessageBase
+class TupleReader
+{
+public:
+    TupleReader(const std::uint8_t*& iter, std::size_t& len, comms::ErrorStatus& es) :
+        m_iter(iter),
+        m_len(len),
+        m_es(es)
+    {
+    }
+
+    template <typename TField>
+    void operator()(TField& field)
+    {
+        if (m_es != comms::ErrorStatus::Success) {
+            return;
+        }
+
+        m_es = field.read(m_iter, m_len);
+        if (m_es == comms::ErrorStatus::Success) {
+            m_len -= field.length();
+        }
+    }
+
+private:
+    const std::uint8_t*& m_iter;
+    std::size_t& m_len;
+    comms::ErrorStatus& m_es;
+};
+
+// Same logic as the default write of comms::MessageBase
+class TupleWriter
+{
+public:
+    TupleWriter(std::uint8_t*& iter, std::size_t& len, comms::ErrorStatus& es) :
+        m_iter(iter),
+        m_len(len),
+        m_es(es)
+    {
+    }
+
+    template <typename TField>
+    void operator()(const TField& field)
+    {
+        if (m_es != comms::ErrorStatus::Success) {
+            return;
+        }
+
+        m_es = field.write(m_iter, m_len);
+        if (m_es == comms::ErrorStatus::Success) {
+            m_len -= field.length();
+        }
+    }
+
+private:
+    std::uint8_t*& m_iter;
+    std::size_t& m_len;
+    comms::ErrorStatus& m_es;
+};
+
+comms::ErrorStatus tupleRead(M1& msg, const std::uint8_t*& iter, std::size_t len)
+{
+    auto es = comms::ErrorStatus::Success;
+    comms::util::tupleForEach(msg.fields(), TupleReader(iter, len, es));
+    return es;
+}
+
+comms::ErrorStatus tupleWrite(const M1& msg, std::uint8_t*& iter, std::size_t len)
+{
+    auto es = comms::ErrorStatus::Success;
+    comms::util::tupleForEach(msg.fields(), TupleWriter(iter, len, es));
+    return es;
+}
+
+void fillMessage(M1& msg, unsigned idx)
+{
+    msg.field_f1().value() = idx;
+    msg.field_f2().value() = static_cast<std::uint16_t>(idx);
+    msg.field_f3().value() = (idx & 0x1U) == 0U ? M1::Field_f3::ValueType::V1 : M1::Field_f3::ValueType::V2;
+    msg.field_f4().setBitValue_B0((idx & 0x1U) != 0U);
+    msg.field_f5().field_m1().value() = static_cast<std::uint8_t>(idx & 0xfU);
+    msg.field_f6().field_x().value() = static_cast<std::int32_t>(idx);
+    msg.field_f6().field_z().value() = static_cast<float>(idx) / 2;
+    msg.field_f7().value() = static_cast<std::int16_t>(idx);
+    msg.field_f8().value() = static_cast<double>(idx) / 4;
+    msg.field_f9().value() = static_cast<std::uint64_t>(idx) << 20;
+    msg.field_f10().field_y().value() = -static_cast<std::int32_t>(idx);
+}
+
+template <typename TFunc>
+double measure(unsigned repeat, TFunc&& func)
+{
+    double best = 0.0;
+    for (auto idx = 0U; idx < repeat; ++idx) {
+        auto start = std::chrono::steady_clock::now();
+        func();
+        auto duration = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+        if ((idx == 0U) || (duration < best)) {
+            best = duration;
+        }
+    }
+    return best;
+}
+
+} // namespace
+
+int main(int argc, const char* argv[])
+{
+    Config config;
+    for (auto idx = 1; idx < argc; ++idx) {
+        if (std::string(argv[idx]) == "--help") {
+            printHelp(std::cout);
+            return 0;
+        }
+    }
+
+    if (!parseArgs(argc, argv, config)) {
+        printHelp(std::cerr);
+        return -1;
+    }
+
+    std::vector<M1> msgs(config.m_messages);
+    for (auto idx = 0U; idx < msgs.size(); ++idx) {
+        fillMessage(msgs[idx], idx);
+    }
+
+    std::vector<std::uint8_t> fixedOutput(msgs.size() * M1::FixedLength);
+    auto fixedWriteMs =
+        measure(
+            config.m_repeat,
+            [&msgs, &fixedOutput]()
+            {
+                auto* iter = fixedOutput.data();
+                for (auto& msg : msgs) {
+                    auto es = msg.doWrite(iter, M1::FixedLength);
+                    if (es != comms::ErrorStatus::Success) {
+                        std::cerr << "ERROR: Unexpected fixed layout write failure" << std::endl;
+                        std::exit(-1);
+                    }
+                }
+            });
+
+    std::vector<std::uint8_t> tupleOutput(fixedOutput.size());
+    auto tupleWriteMs =
+        measure(
+            config.m_repeat,
+            [&msgs, &tupleOutput]()
+            {
+                auto* iter = tupleOutput.data();
+                for (auto& msg : msgs) {
+                    auto es = tupleWrite(msg, iter, M1::FixedLength);
+                    if (es != comms::ErrorStatus::Success) {
+                        std::cerr << "ERROR: Unexpected tuple write failure" << std::endl;
+                        std::exit(-1);
+                    }
+                }
+            });
+
+    if (fixedOutput != tupleOutput) {
+        std::cerr << "ERROR: Different write results" << std::endl;
+        return -1;
+    }
+
+    std::vector<M1> fixedMsgs(msgs.size());
+    auto fixedReadMs =
+        measure(
+            config.m_repeat,
+            [&fixedMsgs, &fixedOutput]()
+            {
+                const auto* iter = fixedOutput.data();
+                for (auto& msg : fixedMsgs) {
+                    auto es = msg.doRead(iter, M1::FixedLength);
+                    if (es != comms::ErrorStatus::Success) {
+                        std::cerr << "ERROR: Unexpected fixed layout read failure" << std::endl;
+                        std::exit(-1);
+                    }
+                }
+            });
+
+    std::vector<M1> tupleMsgs(msgs.size());
+    auto tupleReadMs =
+        measure(
+            config.m_repeat,
+            [&tupleMsgs, &fixedOutput]()
+            {
+                const auto* iter = fixedOutput.data();
+                for (auto& msg : tupleMsgs) {
+                    auto es = tupleRead(msg, iter, M1::FixedLength);
+                    if (es != comms::ErrorStatus::Success) {
+                        std::cerr << "ERROR: Unexpected tuple read failure" << std::endl;
+                        std::exit(-1);
+                    }
+                }
+            });
+
+    std::cout <<
+        "{\"messages\":" << config.m_messages <<
+        ",\"fixed_read_ms\":" << fixedReadMs <<
+        ",\"tuple_read_ms\":" << tupleReadMs <<
+        ",\"read_speedup\":" << ((0.0 < fixedReadMs) ? (tupleReadMs / fixedReadMs) : 0.0) <<
+        ",\"fixed_write_ms\":" << fixedWriteMs <<
+        ",\"tuple_write_ms\":" << tupleWriteMs <<
+        ",\"write_speedup\":" << ((0.0 < fixedWriteMs) ? (tupleWriteMs / fixedWriteMs) : 0.0) <<
+        "}" << std::endl;
+
+    for (auto idx = 0U; idx < msgs.size(); ++idx) {
+        if ((fixedMsgs[idx].fields() == msgs[idx].fields()) &&
+            (tupleMsgs[idx].fields() == msgs[idx].fields())) {
+            continue;
+        }
+
+        std::cerr << "ERROR: Different read results" << std::endl;
+        return -1;
+    }
+
+    return 0;
+}
@@ -0,0 +1,66 @@
+//
+// Copyright 2018 - 2020 (C). Alex Robenko. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Translation unit reading and writing all the messages through the frame,
+// compiled by the instantiation_bench_compile target to measure the
+// compilation time. When BENCH_USE_EXTERN is defined, the messages and the
+// frame are declared to be explicitly instantiated in the instantiation
+// library and their members are not instantiated here.
+
+#include <cstdint>
+#include <vector>
+
+#include "bench_instantiation/Message.h"
+#include "bench_instantiation/frame/Frame.h"
+#include "bench_instantiation/options/DefaultOptions.h"
+
+#ifdef BENCH_USE_EXTERN
+#include "bench_instantiation/instantiation/Messages.h"
+#include "bench_instantiation/instantiation/Frames.h"
+#endif
+
+using Interface =
+    bench_instantiation::Message<
+        comms::option::app::IdInfoInterface,
+        comms::option::app::ReadIterator<const std::uint8_t*>,
+        comms::option::app::WriteIterator<std::uint8_t*>,
+        comms::option::app::LengthInfoInterface,
+        comms::option::app::ValidCheckInterface,
+        comms::option::app::NameInterface
+    >;
+
+using Options = bench_instantiation::options::DefaultOptions;
+
+#ifdef BENCH_USE_EXTERN
+BENCH_INSTANTIATION_EXTERN_MESSAGES(Interface, Options)
+BENCH_INSTANTIATION_EXTERN_FRAMES(Interface, Options)
+#endif
+
+using Frame = bench_instantiation::frame::Frame<Interface>;
+
+bool echo(const std::uint8_t* buf, std::size_t len, std::vector<std::uint8_t>& output)
+{
+    Frame frame;
+    Frame::MsgPtr msg;
+    auto readIter = buf;
+    auto es = frame.read(msg, readIter, len);
+    if ((es != comms::ErrorStatus::Success) || (!msg->valid())) {
+        return false;
+    }
+
+    output.resize(frame.length(*msg));
+    auto writeIter = output.data();
+    return frame.write(*msg, writeIter, output.size()) == comms::ErrorStatus::Success;
+}
@@ -0,0 +1,517 @@
+//
+// Copyright 2018 - 2020 (C). Alex Robenko. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Runs commsdsl2comms over synthetic schemas of increasing size and reports
+// wall time, CPU time, number of written files, emitted bytes and peak RSS of
+// the generator process for every size as a single line JSON object.
+// When the baseline file is provided, the number of files, emitted bytes and
+// peak RSS are compared against it and the application fails when the allowed
+// regression is exceeded or when the baseline has no result for a measured size.
+// The CPU time depends on the machine and build type, it is compared only when
+// requested with --compare-cpu for the baseline recorded in the same environment.
+// The wall time is only reported, it is dominated by the file system performance
+// and too noisy to be compared.
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <sys/resource.h>
+#include <sys/types.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include <boost/filesystem.hpp>
+
+namespace bf = boost::filesystem;
+
+namespace
+{
+
+struct Config
+{
+    std::string m_generator;
+    std::string m_workDir = "commsdsl2comms_bench";
+    std::string m_baseline;
+    std::vector<unsigned> m_sizes = {100U, 1000U, 10000U};
+    unsigned m_fields = 6U;
+    unsigned m_repeat = 1U;
+    double m_threshold = 50.0; // percent
+    bool m_updateBaseline = false;
+    bool m_compareCpu = false;
+};
+
+struct Result
+{
+    unsigned m_messages = 0U;
+    double m_timeMs = 0.0;
+    double m_cpuMs = 0.0;
+    std::uintmax_t m_files = 0U;
+    std::uintmax_t m_bytes = 0U;
+    long m_peakRssKb = 0;
+};
+
+using BaselineMap = std::map<unsigned, Result>;
+
+void printHelp(std::ostream& out)
+{
+    out <<
+        "Usage: commsdsl2comms_bench --generator PATH [options]\n"
+        "Options:\n"
+        "  --generator PATH    Path to commsdsl2comms executable.\n"
+        "  --sizes LIST        Comma separated list of number of messages in the schemas.\n"
+        "  --fields N          Number of extra fields in every message.\n"
+        "  --repeat N          Number of generator runs for every size, the best time is taken.\n"
+        "  --work-dir DIR      Directory for the synthesised schemas and generated code.\n"
+        "  --baseline FILE     Baseline results file.\n"
+        "  --threshold PCT     Allowed regression of the compared values against the baseline in percent.\n"
+        "  --compare-cpu       Compare the CPU time as well, the baseline must be recorded\n"
+        "                      on the same machine with the same build type.\n"
+        "  --update-baseline   Record the results into the baseline file instead of comparing.\n"
+        "  --help              This help.\n";
+}
+
+bool parseUnsigned(const std::string& str, unsigned& value)
+{
+    char* end = nullptr;
+    auto result = std::strtoul(str.c_str(), &end, 0);
+    if ((end == str.c_str()) || (*end != '\0')) {
+        return false;
+    }
+
+    value = static_cast<unsigned>(result);
+    return true;
+}
+
+bool parseArgs(int argc, const char* argv[], Config& config)
+{
+    for (auto idx = 1; idx < argc; ++idx) {
+        std::string arg(argv[idx]);
+        if (arg == "--update-baseline") {
+            config.m_updateBaseline = true;
+            continue;
+        }
+
+        if (arg == "--compare-cpu") {
+            config.m_compareCpu = true;
+            continue;
+        }
+
+        if ((idx + 1) == argc) {
+            std::cerr << "ERROR: Unknown option or missing value for \"" << arg << "\"" << std::endl;
+            return false;
+        }
+
+        std::string value(argv[idx + 1]);
+        ++idx;
+
+        if (arg == "--generator") {
+            config.m_generator = value;
+            continue;
+        }
+
+        if (arg == "--work-dir") {
+            config.m_workDir = value;
+            continue;
+        }
+
+        if (arg == "--baseline") {
+            config.m_baseline = value;
+            continue;
+        }
+
+        if (arg == "--threshold") {
+            char* end = nullptr;
+            config.m_threshold = std::strtod(value.c_str(), &end);
+            if ((end == value.c_str()) || (*end != '\0') || (config.m_threshold < 0.0)) {
+                std::cerr << "ERROR: Invalid threshold \"" << value << "\"" << std::endl;
+                return false;
+            }
+            continue;
+        }
+
+        if (arg == "--sizes") {
+            config.m_sizes.clear();
+            std::istringstream stream(value);
+            std::string elem;
+            while (std::getline(stream, elem, ',')) {
+                unsigned size = 0U;
+                if ((!parseUnsigned(elem, size)) || (size == 0U)) {
+                    std::cerr << "ERROR: Invalid size \"" << elem << "\"" << std::endl;
+                    return false;
+                }
+                config.m_sizes.push_back(size);
+            }
+            continue;
+        }
+
+        if ((arg == "--fields") || (arg == "--repeat")) {
+            auto& numValue = (arg == "--fields") ? config.m_fields : config.m_repeat;
+            if (!parseUnsigned(value, numValue)) {
+                std::cerr << "ERROR: Invalid value \"" << value << "\" for \"" << arg << "\"" << std::endl;
+                return false;
+            }
+            continue;
+        }
+
+        std::cerr << "ERROR: Unknown option \"" << arg << "\"" << std::endl;
+        return false;
+    }
+
+    if (config.m_generator.empty()) {
+        std::cerr << "ERROR: Path to the generator is not provided" << std::endl;
+        return false;
+    }
+
+    if (config.m_sizes.empty()) {
+        std::cerr << "ERROR: No sizes provided" << std::endl;
+        return false;
+    }
+
+    if (config.m_repeat == 0U) {
+        config.m_repeat = 1U;
+    }
+
+    return true;
+}
+
+std::string synthesise(unsigned messages, unsigned fields)
+{
+    static const char* IntTypes[] = {"uint8", "uint16", "uint32", "int16"};
+    static const auto IntTypesCount = sizeof(IntTypes) / sizeof(IntTypes[0]);
+
+    std::string out;
+    out += "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n";
+    out += "<schema name=\"bench\" endian=\"big\">\n";
+    out += "    <fields>\n";
+    out += "        <enum name=\"MsgId\" type=\"uint16\" semanticType=\"messageId\">\n";
+    for (auto idx = 0U; idx < messages; ++idx) {
+        auto idxStr = std::to_string(idx);
+        out += "            <validValue name=\"Msg" + idxStr + "\" val=\"" + std::to_string(idx + 1U) + "\" />\n";
+    }
+    out += "        </enum>\n";
+    out += "        <bundle name=\"Header\">\n";
+    out += "            <int name=\"first\" type=\"uint8\" />\n";
+    out += "            <int name=\"second\" type=\"uint16\" />\n";
+    out += "        </bundle>\n";
+    out += "        <string name=\"Name\" length=\"16\" />\n";
+    out += "        <list name=\"Values\" element=\"Header\" count=\"2\" />\n";
+    out += "    </fields>\n";
+    out += "    <interface name=\"Message\" />\n";
+    out += "    <frame name=\"Frame\">\n";
+    out += "        <size name=\"Size\"><int name=\"SizeField\" type=\"uint16\" /></size>\n";
+    out += "        <id name=\"Id\" field=\"MsgId\" />\n";
+    out += "        <payload name=\"Data\" />\n";
+    out += "    </frame>\n";
+    for (auto idx = 0U; idx < messages; ++idx) {
+        auto idxStr = std::to_string(idx);
+        out += "    <message name=\"Msg" + idxStr + "\" id=\"MsgId.Msg" + idxStr + "\">\n";
+        out += "        <ref name=\"header\" field=\"Header\" />\n";
+        for (auto fieldIdx = 0U; fieldIdx < fields; ++fieldIdx) {
+            out += "        <int name=\"f" + std::to_string(fieldIdx) + "\" type=\"" +
+                   IntTypes[fieldIdx % IntTypesCount] + "\" />\n";
+        }
+        out += "        <ref name=\"name\" field=\"Name\" />\n";
+        out += "        <ref name=\"values\" field=\"Values\" />\n";
+        out += "    </message>\n";
+    }
+    out += "</schema>\n";
+    return out;
+}
+
+bool writeFile(const bf::path& path, const std::string& contents)
+{
+    std::ofstream stream(path.string(), std::ios_base::out | std::ios_base::trunc | std::ios_base::binary);
+    if (!stream) {
+        std::cerr << "ERROR: Failed to create \"" << path.string() << "\"" << std::endl;
+        return false;
+    }
+
+    stream << contents;
+    stream.flush();
+    if (!stream.good()) {
+        std::cerr << "ERROR: Failed to write \"" << path.string() << "\"" << std::endl;
+        return false;
+    }
+
+    return true;
+}
+
+// Runs the generator as a child process, the resource usage of
+// the terminated child provides its peak RSS.
+bool runGenerator(const std::string& generator, const bf::path& schema, const bf::path& outDir, Result& result)
+{
+    auto start = std::chrono::steady_clock::now();
+    auto pid = fork();
+    if (pid < 0) {
+        std::cerr << "ERROR: Failed to start generator process" << std::endl;
+        return false;
+    }
+
+    if (pid == 0) {
+        auto outDirStr = outDir.string();
+        auto schemaStr = schema.string();
+        const char* args[] = {generator.c_str(), "-q", "-o", outDirStr.c_str(), schemaStr.c_str(), nullptr};
+        execv(generator.c_str(), const_cast<char* const*>(args));
+        _exit(127);
+    }
+
+    int status = 0;
+    struct rusage usage;
+    if (wait4(pid, &status, 0, &usage) != pid) {
+        std::cerr << "ERROR: Failed to wait for generator process" << std::endl;
+        return false;
+    }
+
+    auto duration = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    if ((!WIFEXITED(status)) || (WEXITSTATUS(status) != 0)) {
+        std::cerr << "ERROR: Generator failed for \"" << schema.string() << "\"" << std::endl;
+        return false;
+    }
+
+    auto toMs =
+        [](const struct timeval& tv)
+        {
+            return (static_cast<double>(tv.tv_sec) * 1000.0) + (static_cast<double>(tv.tv_usec) / 1000.0);
+        };
+
+    result.m_timeMs = duration;
+    result.m_cpuMs = toMs(usage.ru_utime) + toMs(usage.ru_stime);
+#ifdef __APPLE__
+    result.m_peakRssKb = usage.ru_maxrss / 1024;
+#else
+    result.m_peakRssKb = usage.ru_maxrss;
+#endif
+    return true;
+}
+
+void countOutput(const bf::path& outDir, Result& result)
+{
+    result.m_files = 0U;
+    result.m_bytes = 0U;
+    for (bf::recursive_directory_iterator iter(outDir), end; iter != end; ++iter) {
+        if (!bf::is_regular_file(iter->status())) {
+            continue;
+        }
+
+        ++result.m_files;
+        result.m_bytes += bf::file_size(iter->path());
+    }
+}
+
+bool measure(const Config& config, unsigned messages, Result& result)
+{
+    bf::path workDir(config.m_workDir);
+    boost::system::error_code ec;
+    bf::create_directories(workDir, ec);
+    if (ec) {
+        std::cerr << "ERROR: Failed to create \"" << workDir.string() << "\": " << ec.message() << std::endl;
+        return false;
+    }
+
+    auto sizeStr = std::to_string(messages);
+    auto schema = workDir / ("Schema" + sizeStr + ".xml");
+    if (!writeFile(schema, synthesise(messages, config.m_fields))) {
+        return false;
+    }
+
+    auto outDir = workDir / ("output" + sizeStr);
+    result.m_messages = messages;
+    for (auto idx = 0U; idx < config.m_repeat; ++idx) {
+        bf::remove_all(outDir, ec);
+        if (ec) {
+            std::cerr << "ERROR: Failed to remove \"" << outDir.string() << "\": " << ec.message() << std::endl;
+            return false;
+        }
+
+        Result run;
+        if (!runGenerator(config.m_generator, schema, outDir, run)) {
+            return false;
+        }
+
+        if ((idx == 0U) || (run.m_timeMs < result.m_timeMs)) {
+            result.m_timeMs = run.m_timeMs;
+        }
+
+        if ((idx == 0U) || (run.m_cpuMs < result.m_cpuMs)) {
+            result.m_cpuMs = run.m_cpuMs;
+        }
+
+        result.m_peakRssKb = std::max(result.m_peakRssKb, run.m_peakRssKb);
+    }
+
+    countOutput(outDir, result);
+    return true;
+}
+
+std::string toJson(const Result& result)
+{
+    std::ostringstream stream;
+    stream <<
+        "{\"messages\":" << result.m_messages <<
+        ",\"time_ms\":" << result.m_timeMs <<
+        ",\"cpu_ms\":" << result.m_cpuMs <<
+        ",\"files\":" << result.m_files <<
+        ",\"bytes\":" << result.m_bytes <<
+        ",\"peak_rss_kb\":" << result.m_peakRssKb <<
+        "}";
+    return stream.str();
+}
+
+bool getJsonNumber(const std::string& line, const std::string& key, double& value)
+{
+    auto keyStr = '\"' + key + "\":";
+    auto pos = line.find(keyStr);
+    if (pos == std::string::npos) {
+        return false;
+    }
+
+    auto* begin = line.c_str() + pos + keyStr.size();
+    char* end = nullptr;
+    value = std::strtod(begin, &end);
+    return end != begin;
+}
+
+BaselineMap readBaseline(const std::string& path)
+{
+    BaselineMap map;
+    std::ifstream stream(path);
+    std::string line;
+    while (std::getline(stream, line)) {
+        double messages = 0.0;
+        double timeMs = 0.0;
+        double cpuMs = 0.0;
+        double files = 0.0;
+        double bytes = 0.0;
+        double peakRss = 0.0;
+        if ((!getJsonNumber(line, "messages", messages)) ||
+            (!getJsonNumber(line, "time_ms", timeMs)) ||
+            (!getJsonNumber(line, "cpu_ms", cpuMs)) ||
+            (!getJsonNumber(line, "files", files)) ||
+            (!getJsonNumber(line, "bytes", bytes)) ||
+            (!getJsonNumber(line, "peak_rss_kb", peakRss))) {
+            continue;
+        }
+
+        auto& elem = map[static_cast<unsigned>(messages)];
+        elem.m_messages = static_cast<unsigned>(messages);
+        elem.m_timeMs = timeMs;
+        elem.m_cpuMs = cpuMs;
+        elem.m_files = static_cast<std::uintmax_t>(files);
+        elem.m_bytes = static_cast<std::uintmax_t>(bytes);
+        elem.m_peakRssKb = static_cast<long>(peakRss);
+    }
+    return map;
+}
+
+bool checkRegression(const char* name, double value, double baseline, double threshold, unsigned messages)
+{
+    if (baseline <= 0.0) {
+        return true;
+    }
+
+    auto limit = baseline * (1.0 + (threshold / 100.0));
+    if (value <= limit) {
+        return true;
+    }
+
+    std::cerr << "ERROR: Regression of " << name << " for " << messages << " messages: " <<
+        value << " vs baseline " << baseline << " (limit " << limit << ")" << std::endl;
+    return false;
+}
+
+} // namespace
+
+int main(int argc, const char* argv[])
+{
+    Config config;
+    for (auto idx = 1; idx < argc; ++idx) {
+        if (std::string(argv[idx]) == "--help") {
+            printHelp(std::cout);
+            return 0;
+        }
+    }
+
+    if (!parseArgs(argc, argv, config)) {
+        printHelp(std::cerr);
+        return -1;
+    }
+
+    BaselineMap baseline;
+    if ((!config.m_updateBaseline) && (!config.m_baseline.empty())) {
+        baseline = readBaseline(config.m_baseline);
+        if (baseline.empty()) {
+            std::cerr << "ERROR: No baseline results in \"" << config.m_baseline << "\", " <<
+                "record them with --update-baseline or omit --baseline to skip the comparison" << std::endl;
+            return -1;
+        }
+    }
+
+    std::vector<Result> results;
+    bool ok = true;
+    for (auto size : config.m_sizes) {
+        Result result;
+        if (!measure(config, size, result)) {
+            return -1;
+        }
+
+        std::cout << toJson(result) << std::endl;
+        results.push_back(result);
+
+        if (baseline.empty()) {
+            continue;
+        }
+
+        auto iter = baseline.find(size);
+        if (iter == baseline.end()) {
+            std::cerr << "ERROR: No baseline result for " << size << " messages in \"" << config.m_baseline << "\"" << std::endl;
+            ok = false;
+            continue;
+        }
+
+        auto& base = iter->second;
+        ok = checkRegression("files", static_cast<double>(result.m_files), static_cast<double>(base.m_files), config.m_threshold, size) && ok;
+        ok = checkRegression("bytes", static_cast<double>(result.m_bytes), static_cast<double>(base.m_bytes), config.m_threshold, size) && ok;
+        ok = checkRegression("peak_rss_kb", static_cast<double>(result.m_peakRssKb), static_cast<double>(base.m_peakRssKb), config.m_threshold, size) && ok;
+        if (config.m_compareCpu) {
+            ok = checkRegression("cpu_ms", result.m_cpuMs, base.m_cpuMs, config.m_threshold, size) && ok;
+        }
+    }
+
+    if (config.m_updateBaseline && (!config.m_baseline.empty())) {
+        std::string contents;
+        for (auto& r : results) {
+            contents += toJson(r);
+            contents += '\n';
+        }
+
+        if (!writeFile(config.m_baseline, contents)) {
+            return -1;
+        }
+    }
+
+    if (!ok) {
+        return -1;
+    }
+
+    return 0;
+}
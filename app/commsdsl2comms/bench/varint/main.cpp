@@ -0,0 +1,252 @@
+//
+// Copyright 2018 - 2020 (C). Alex Robenko. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Compares the generated read of the uintvar field, which decodes up to
+// 8 bytes at once, against the default byte by byte read of
+// comms::field::IntValue with comms::option::def::VarLength:
+// - every encoding length from 1 to 10 bytes, the buffer contains
+//   values of the same encoding length only.
+// - list of values of mixed encoding lengths, the list elements are
+//   read with the field read, there is no separate path for lists.
+// The best times of the runs are reported as a single line JSON object.
+// The application fails only when both reads produce different results.
+
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <iterator>
+#include <string>
+#include <vector>
+
+#include "comms/field/ArrayList.h"
+#include "comms/field/IntValue.h"
+#include "bench_varint/field/FieldBase.h"
+#include "bench_varint/field/Value.h"
+#include "bench_varint/field/Values.h"
+
+namespace
+{
+
+struct Config
+{
+    unsigned m_values = 1000000U;
+    unsigned m_repeat = 5U;
+};
+
+using Field = bench_varint::field::Value<>;
+using ListField = bench_varint::field::Values<>;
+
+using PlainField =
+    comms::field::IntValue<
+        bench_varint::field::FieldBase<>,
+        std::uint64_t,
+        comms::option::def::VarLength<1U, 10U>
+    >;
+
+using PlainListField =
+    comms::field::ArrayList<
+        bench_varint::field::FieldBase<>,
+        PlainField
+    >;
+
+const std::size_t MaxEncodingLen = 10U;
+
+void printHelp(std::ostream& out)
+{
+    out <<
+        "Usage: commsdsl2comms_varint_bench [options]\n"
+        "Options:\n"
+        "  --values N      Number of encoded values in the buffer.\n"
+        "  --repeat N      Number of runs, the best time is taken.\n"
+        "  --help          This help.\n";
+}
+
+bool parseArgs(int argc, const char* argv[], Config& config)
+{
+    for (auto idx = 1; idx < argc; ++idx) {
+        std::string arg(argv[idx]);
+        if ((idx + 1) == argc) {
+            std::cerr << "ERROR: Unknown option or missing value for \"" << arg << "\"" << std::endl;
+            return false;
+        }
+
+        std::string value(argv[idx + 1]);
+        ++idx;
+
+        unsigned* numValue = nullptr;
+        if (arg == "--values") {
+            numValue = &config.m_values;
+        }
+        else if (arg == "--repeat") {
+            numValue = &config.m_repeat;
+        }
+        else {
+            std::cerr << "ERROR: Unknown option \"" << arg << "\"" << std::endl;
+            return false;
+        }
+
+        char* end = nullptr;
+        auto result = std::strtoul(value.c_str(), &end, 0);
+        if ((end == value.c_str()) || (*end != '\0') || (result == 0U)) {
+            std::cerr << "ERROR: Invalid value \"" << value << "\" for \"" << arg << "\"" << std::endl;
+            return false;
+        }
+
+        *numValue = static_cast<unsigned>(result);
+    }
+
+    return true;
+}
+
+// Value with the requested encoding length
+std::uint64_t makeValue(std::size_t encodingLen, unsigned idx)
+{
+    auto minValue = (encodingLen <= 1U) ? std::uint64_t(0U) : (std::uint64_t(1U) << ((encodingLen - 1U) * 7U));
+    auto maxValue = (MaxEncodingLen <= encodingLen) ? ~std::uint64_t(0U) : ((std::uint64_t(1U) << (encodingLen * 7U)) - 1U);
+    return minValue + ((static_cast<std::uint64_t>(idx) * 2654435761ULL) % (maxValue - minValue));
+}
+
+template <typename TFunc>
+double measure(unsigned repeat, TFunc&& func)
+{
+    double best = 0.0;
+    for (auto idx = 0U; idx < repeat; ++idx) {
+        auto start = std::chrono::steady_clock::now();
+        func();
+        auto duration = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+        if ((idx == 0U) || (duration < best)) {
+            best = duration;
+        }
+    }
+    return best;
+}
+
+template <typename TField>
+double measureRead(unsigned repeat, const std::vector<std::uint8_t>& buf, std::vector<std::uint64_t>& values)
+{
+    return
+        measure(
+            repeat,
+            [&buf, &values]()
+            {
+                const auto* iter = buf.data();
+                std::size_t remLen = buf.size();
+                for (auto& value : values) {
+                    TField field;
+                    const auto* fieldStart = iter;
+                    auto es = field.read(iter, remLen);
+                    if (es != comms::ErrorStatus::Success) {
+                        std::cerr << "ERROR: Unexpected read failure" << std::endl;
+                        std::exit(-1);
+                    }
+                    remLen -= static_cast<std::size_t>(std::distance(fieldStart, iter));
+                    value = field.value();
+                }
+            });
+}
+
+template <typename TListField>
+double measureListRead(unsigned repeat, const std::vector<std::uint8_t>& buf, std::vector<std::uint64_t>& values)
+{
+    return
+        measure(
+            repeat,
+            [&buf, &values]()
+            {
+                TListField field;
+                const auto* iter = buf.data();
+                auto es = field.read(iter, buf.size());
+                if (es != comms::ErrorStatus::Success) {
+                    std::cerr << "ERROR: Unexpected list read failure" << std::endl;
+                    std::exit(-1);
+                }
+
+                values.clear();
+                for (auto& elem : field.value()) {
+                    values.push_back(elem.value());
+                }
+            });
+}
+
+} // namespace
+
+int main(int argc, const char* argv[])
+{
+    Config config;
+    for (auto idx = 1; idx < argc; ++idx) {
+        if (std::string(argv[idx]) == "--help") {
+            printHelp(std::cout);
+            return 0;
+        }
+    }
+
+    if (!parseArgs(argc, argv, config)) {
+        printHelp(std::cerr);
+        return -1;
+    }
+
+    bool same = true;
+    std::cout << "{\"values\":" << config.m_values;
+    for (auto encodingLen = 1U; encodingLen <= MaxEncodingLen; ++encodingLen) {
+        std::vector<std::uint8_t> buf;
+        buf.reserve(config.m_values * encodingLen);
+        auto writeIter = std::back_inserter(buf);
+        for (auto idx = 0U; idx < config.m_values; ++idx) {
+            PlainField field;
+            field.value() = makeValue(encodingLen, idx);
+            field.write(writeIter, buf.max_size());
+        }
+
+        std::vector<std::uint64_t> values(config.m_values);
+        auto fastMs = measureRead<Field>(config.m_repeat, buf, values);
+        std::vector<std::uint64_t> plainValues(config.m_values);
+        auto plainMs = measureRead<PlainField>(config.m_repeat, buf, plainValues);
+        same = same && (values == plainValues) && (buf.size() == (config.m_values * encodingLen));
+
+        std::cout <<
+            ",\"len" << encodingLen << "_fast_ms\":" << fastMs <<
+            ",\"len" << encodingLen << "_plain_ms\":" << plainMs;
+    }
+
+    PlainListField plainList;
+    for (auto idx = 0U; idx < config.m_values; ++idx) {
+        PlainField field;
+        field.value() = makeValue((idx % MaxEncodingLen) + 1U, idx);
+        plainList.value().push_back(field);
+    }
+
+    std::vector<std::uint8_t> listBuf(plainList.length());
+    auto* listWriteIter = listBuf.data();
+    plainList.write(listWriteIter, listBuf.size());
+
+    std::vector<std::uint64_t> listValues;
+    auto listFastMs = measureListRead<ListField>(config.m_repeat, listBuf, listValues);
+    std::vector<std::uint64_t> plainListValues;
+    auto listPlainMs = measureListRead<PlainListField>(config.m_repeat, listBuf, plainListValues);
+    same = same && (listValues == plainListValues);
+
+    std::cout <<
+        ",\"list_fast_ms\":" << listFastMs <<
+        ",\"list_plain_ms\":" << listPlainMs <<
+        "}" << std::endl;
+
+    if (!same) {
+        std::cerr << "ERROR: Different read results" << std::endl;
+        return -1;
+    }
+
+    return 0;
+}
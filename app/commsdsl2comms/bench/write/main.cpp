@@ -0,0 +1,237 @@
+//
+// Copyright 2018 - 2020 (C). Alex Robenko. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Measures the framed write of a message with a large list of variable
+// length elements preceded by a detached length prefix:
+// - refresh: update of the length prefix, which calculates the length of
+//   every list element.
+// - length first: frame length calculation followed by the write into the
+//   buffer of the exact size, the interface provides length information.
+// - single pass: frame writeSinglePass() into the reused buffer, the size
+//   and checksum values are updated after the payload is written, the
+//   interface has no length information.
+// The best times of the runs are reported as a single line JSON object.
+// The application fails only when both writes produce different output.
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "bench_write/Message.h"
+#include "bench_write/message/M1.h"
+#include "bench_write/frame/Frame.h"
+
+namespace
+{
+
+struct Config
+{
+    unsigned m_elements = 100000U;
+    unsigned m_writes = 20U;
+    unsigned m_repeat = 5U;
+};
+
+using Interface =
+    bench_write::Message<
+        comms::option::app::IdInfoInterface,
+        comms::option::app::WriteIterator<std::uint8_t*>
+    >;
+
+using LengthInterface =
+    bench_write::Message<
+        comms::option::app::IdInfoInterface,
+        comms::option::app::WriteIterator<std::uint8_t*>,
+        comms::option::app::LengthInfoInterface
+    >;
+
+using Frame = bench_write::frame::Frame<Interface>;
+using LengthFrame = bench_write::frame::Frame<LengthInterface>;
+
+using M1 = bench_write::message::M1<Interface>;
+using LengthM1 = bench_write::message::M1<LengthInterface>;
+
+void printHelp(std::ostream& out)
+{
+    out <<
+        "Usage: commsdsl2comms_write_bench [options]\n"
+        "Options:\n"
+        "  --elements N    Number of list elements in the message.\n"
+        "  --writes N      Number of writes in every run.\n"
+        "  --repeat N      Number of runs, the best time is taken.\n"
+        "  --help          This help.\n";
+}
+
+bool parseArgs(int argc, const char* argv[], Config& config)
+{
+    for (auto idx = 1; idx < argc; ++idx) {
+        std::string arg(argv[idx]);
+        if ((idx + 1) == argc) {
+            std::cerr << "ERROR: Unknown option or missing value for \"" << arg << "\"" << std::endl;
+            return false;
+        }
+
+        std::string value(argv[idx + 1]);
+        ++idx;
+
+        unsigned* numValue = nullptr;
+        if (arg == "--elements") {
+            numValue = &config.m_elements;
+        }
+        else if (arg == "--writes") {
+            numValue = &config.m_writes;
+        }
+        else if (arg == "--repeat") {
+            numValue = &config.m_repeat;
+        }
+        else {
+            std::cerr << "ERROR: Unknown option \"" << arg << "\"" << std::endl;
+            return false;
+        }
+
+        char* end = nullptr;
+        auto result = std::strtoul(value.c_str(), &end, 0);
+        if ((end == value.c_str()) || (*end != '\0') || (result == 0U)) {
+            std::cerr << "ERROR: Invalid value \"" << value << "\" for \"" << arg << "\"" << std::endl;
+            return false;
+        }
+
+        *numValue = static_cast<unsigned>(result);
+    }
+
+    return true;
+}
+
+// The values are between 0 and 99 characters long
+template <typename TMsg>
+void fillMessage(TMsg& msg, unsigned elements)
+{
+    auto& list = msg.field_list().value();
+    list.resize(elements);
+    for (auto idx = 0U; idx < list.size(); ++idx) {
+        list[idx].field_key().value() = static_cast<std::uint16_t>(idx);
+        list[idx].field_value().value().assign(idx % 100U, 'a');
+    }
+}
+
+template <typename TFunc>
+double measure(unsigned repeat, TFunc&& func)
+{
+    double best = 0.0;
+    for (auto idx = 0U; idx < repeat; ++idx) {
+        auto start = std::chrono::steady_clock::now();
+        func();
+        auto duration = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+        if ((idx == 0U) || (duration < best)) {
+            best = duration;
+        }
+    }
+    return best;
+}
+
+} // namespace
+
+int main(int argc, const char* argv[])
+{
+    Config config;
+    for (auto idx = 1; idx < argc; ++idx) {
+        if (std::string(argv[idx]) == "--help") {
+            printHelp(std::cout);
+            return 0;
+        }
+    }
+
+    if (!parseArgs(argc, argv, config)) {
+        printHelp(std::cerr);
+        return -1;
+    }
+
+    M1 msg;
+    fillMessage(msg, config.m_elements);
+    LengthM1 lengthMsg;
+    fillMessage(lengthMsg, config.m_elements);
+
+    auto refreshMs =
+        measure(
+            config.m_repeat,
+            [&config, &msg]()
+            {
+                for (auto idx = 0U; idx < config.m_writes; ++idx) {
+                    msg.field_length().value() = 0U;
+                    if (!msg.doRefresh()) {
+                        std::cerr << "ERROR: Length prefix is not updated" << std::endl;
+                        std::exit(-1);
+                    }
+                }
+            });
+    lengthMsg.doRefresh();
+
+    std::vector<std::uint8_t> lengthOutput;
+    auto lengthFirstMs =
+        measure(
+            config.m_repeat,
+            [&config, &lengthMsg, &lengthOutput]()
+            {
+                LengthFrame frame;
+                for (auto idx = 0U; idx < config.m_writes; ++idx) {
+                    lengthOutput.resize(frame.length(lengthMsg));
+                    auto* iter = lengthOutput.data();
+                    auto es = frame.write(lengthMsg, iter, lengthOutput.size());
+                    if (es != comms::ErrorStatus::Success) {
+                        std::cerr << "ERROR: Unexpected length first write failure" << std::endl;
+                        std::exit(-1);
+                    }
+                }
+            });
+
+    // Reused between the writes, the application doesn't know the length
+    std::vector<std::uint8_t> output;
+    std::size_t outputLen = 0U;
+    auto singlePassMs =
+        measure(
+            config.m_repeat,
+            [&config, &msg, &output, &outputLen]()
+            {
+                Frame frame;
+                for (auto idx = 0U; idx < config.m_writes; ++idx) {
+                    auto es = frame.writeSinglePass(msg, output, outputLen);
+                    if (es != comms::ErrorStatus::Success) {
+                        std::cerr << "ERROR: Unexpected single pass write failure" << std::endl;
+                        std::exit(-1);
+                    }
+                }
+            });
+
+    std::cout <<
+        "{\"elements\":" << config.m_elements <<
+        ",\"writes\":" << config.m_writes <<
+        ",\"bytes\":" << outputLen <<
+        ",\"refresh_ms\":" << refreshMs <<
+        ",\"length_first_ms\":" << lengthFirstMs <<
+        ",\"single_pass_ms\":" << singlePassMs <<
+        ",\"speedup\":" << ((0.0 < singlePassMs) ? (lengthFirstMs / singlePassMs) : 0.0) <<
+        "}" << std::endl;
+
+    if ((outputLen != lengthOutput.size()) ||
+        (!std::equal(lengthOutput.begin(), lengthOutput.end(), output.begin()))) {
+        std::cerr << "ERROR: Different write results" << std::endl;
+        return -1;
+    }
+
+    return 0;
+}
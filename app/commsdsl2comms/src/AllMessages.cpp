@@ -15,12 +15,16 @@
 
 #include "AllMessages.h"
 
-#include <fstream>
+#include <algorithm>
+#include <limits>
+#include <map>
 
 #include <boost/filesystem.hpp>
 
 #include "Generator.h"
+#include "OutputFile.h"
 #include "common.h"
+#include "Message.h"
 
 namespace bf = boost::filesystem;
 
@@ -30,15 +34,23 @@ namespace commsdsl2comms
 bool AllMessages::write(Generator& generator)
 {
     AllMessages obj(generator);
-    return obj.writeProtocolDefinition() && obj.writePluginDefinition();
+    return
+        obj.writeProtocolDefinition() &&
+        obj.writeProtocolFwdDefinition() &&
+        obj.writePluginDefinition();
 }
 
 bool AllMessages::writeProtocolDefinition() const
 {
+    static const std::size_t MaxLen = std::numeric_limits<std::size_t>::max();
+
     struct MessagesInfo
     {
         common::StringsList m_messages;
         common::StringsList m_includes;        
+        common::StringsList m_unlimited;
+        std::size_t m_minLength = MaxLen;
+        std::size_t m_maxLength = 0U;
     };
 
     struct PlatformInfo
@@ -66,13 +78,19 @@ bool AllMessages::writeProtocolDefinition() const
 
     auto allMessages = m_generator.getAllDslMessages();
 
+    std::map<std::string, const Message*> genMessages;
+    for (auto* m : m_generator.getAllMessages()) {
+        genMessages.insert(std::make_pair(m->externalRef(), m));
+    }
+
     for (auto& p : platformsMap) {
         auto updateFunc = 
             [this, &allMessages](auto& msgInfo)
             {
                 msgInfo.m_messages.reserve(allMessages.size());
-                msgInfo.m_includes.reserve(allMessages.size() + 2);
+                msgInfo.m_includes.reserve(allMessages.size() + 4);
                 common::mergeInclude("<tuple>", msgInfo.m_includes);
+                common::mergeIncludes(common::lengthBoundsIncludes(), msgInfo.m_includes);
                 auto optionsHeader = m_generator.headerfileForOptions(common::defaultOptionsStr(), false);
                 common::mergeInclude(optionsHeader, msgInfo.m_includes);
             };
@@ -92,14 +110,25 @@ bool AllMessages::writeProtocolDefinition() const
         auto extRef = m.externalRef();
         assert(!extRef.empty());
 
-        auto msgStr = m_generator.scopeForMessage(extRef, true, true) + "<TBase, TOpt>";
+        auto msgScope = m_generator.scopeForMessage(extRef, true, true);
+        auto msgStr = msgScope + "<TBase, TOpt>";
         auto incStr = m_generator.headerfileForMessage(extRef, false);
 
+        auto genMsgIter = genMessages.find(extRef);
+        assert(genMsgIter != genMessages.end());
+        auto msgMinLength = genMsgIter->second->minLength();
+        auto msgMaxLength = genMsgIter->second->maxLength();
+
         auto addToMessageInfoFunc =
-            [&msgStr, &incStr](MessagesInfo& info)
+            [&msgStr, &incStr, &msgScope, msgMinLength, msgMaxLength](MessagesInfo& info)
             {
                 info.m_messages.push_back(msgStr);
                 common::mergeInclude(incStr, info.m_includes);
+                info.m_minLength = std::min(info.m_minLength, msgMinLength);
+                info.m_maxLength = std::max(info.m_maxLength, msgMaxLength);
+                if (msgMaxLength == MaxLen) {
+                    info.m_unlimited.push_back(msgScope);
+                }
             };
 
         bool serverInput = m.sender() != commsdsl::Message::Sender::Server;            
@@ -169,11 +198,7 @@ bool AllMessages::writeProtocolDefinition() const
                 return true;
             }
 
-            std::ofstream stream(filePath);
-            if (!stream) {
-                m_generator.logger().error("Failed to open \"" + filePath + "\" for writing.");
-                return false;
-            }
+            OutputFile stream(m_generator, filePath);
 
             common::ReplacementMap replacements;
             auto namespaces = m_generator.namespacesForInput();
@@ -186,6 +211,23 @@ bool AllMessages::writeProtocolDefinition() const
             replacements.insert(std::make_pair("CLASS_NAME", std::move(className)));
             replacements.insert(std::make_pair("OPTIONS", m_generator.scopeForOptions(common::defaultOptionsStr(), true, true)));
 
+            auto minLength = info.m_minLength;
+            if (info.m_messages.empty()) {
+                minLength = 0U;
+            }
+
+            auto subject = "the payload of any message in @ref " + replacements["CLASS_NAME"] + " bundle";
+            auto lengthFuncs = common::lengthBoundsFuncs(minLength, info.m_maxLength, subject);
+            replacements.insert(std::make_pair("LENGTH_FUNCS", std::move(lengthFuncs)));
+
+            if (!info.m_unlimited.empty()) {
+                static const std::string UnlimitedPrefix("///     @li @ref ");
+                auto unlimitedDoc =
+                    "/// @details Maximal serialisation length is unlimited due to the following messages:\n" +
+                    UnlimitedPrefix + common::listToString(info.m_unlimited, "\n" + UnlimitedPrefix, common::emptyString());
+                replacements.insert(std::make_pair("UNLIMITED_DOC", std::move(unlimitedDoc)));
+            }
+
             if (!platName.empty()) {
                 replacements.insert(std::make_pair("PLAT_NAME", '\"' + platName + "\" "));
             }
@@ -209,6 +251,13 @@ bool AllMessages::writeProtocolDefinition() const
                 "    std::tuple<\n"
                 "        #^#MESSAGES#$#\n"
                 "    >;\n\n"
+                "/// @brief Compile time serialisation length bounds of the messages in\n"
+                "///     @ref #^#CLASS_NAME#$# bundle.\n"
+                "#^#UNLIMITED_DOC#$#\n"
+                "struct #^#CLASS_NAME#$#Common\n"
+                "{\n"
+                "    #^#LENGTH_FUNCS#$#\n"
+                "};\n\n"
                 "#^#END_NAMESPACE#$#\n"
             );
 
@@ -264,6 +313,75 @@ bool AllMessages::writeProtocolDefinition() const
         return true;
 }
 
+bool AllMessages::writeProtocolFwdDefinition() const
+{
+    auto startInfo = m_generator.startInputProtocolWrite(common::allMessagesStr() + common::fwdSuffixStr());
+    auto& filePath = startInfo.first;
+
+    if (filePath.empty()) {
+        return true;
+    }
+
+    // Group consecutive messages residing in the same namespace to avoid
+    // re-opening it for every declaration.
+    std::string decls;
+    std::pair<std::string, std::string> prevNamespaces;
+    auto allMessages = m_generator.getAllDslMessages();
+    for (auto m : allMessages) {
+        assert(m.valid());
+
+        if (!m_generator.doesElementExist(m.sinceVersion(), m.deprecatedSince(), m.isDeprecatedRemoved())) {
+            continue;
+        }
+
+        auto extRef = m.externalRef();
+        assert(!extRef.empty());
+
+        auto namespaces = m_generator.namespacesForMessage(extRef);
+        if (namespaces != prevNamespaces) {
+            decls += prevNamespaces.second;
+            decls += namespaces.first;
+            decls += '\n';
+            prevNamespaces = std::move(namespaces);
+        }
+
+        auto scope = m_generator.scopeForMessage(extRef, true, true);
+        auto className = scope.substr(scope.rfind(':') + 1);
+        decls += "template <typename TMsgBase, typename TOpt>\n";
+        decls += "class " + className + ";\n\n";
+    }
+    decls += prevNamespaces.second;
+
+    OutputFile stream(m_generator, filePath);
+
+    common::ReplacementMap replacements;
+    replacements.insert(std::make_pair("GEN_COMMENT", m_generator.fileGeneratedComment()));
+    replacements.insert(std::make_pair("DECLS", std::move(decls)));
+    replacements.insert(std::make_pair("ALL_MESSAGES_HEADER", m_generator.headerfileForInput(common::allMessagesStr(), false)));
+
+    const std::string Template(
+        "#^#GEN_COMMENT#$#\n"
+        "/// @file\n"
+        "/// @brief Contains forward declarations of all the message classes.\n"
+        "/// @details Allows referring to the message types by name (handler\n"
+        "///     declarations, pointers and references) without including the\n"
+        "///     full definitions. Include #^#ALL_MESSAGES_HEADER#$# or the\n"
+        "///     relevant message header when the complete type is required.\n\n"
+        "#pragma once\n\n"
+        "#^#DECLS#$#\n"
+    );
+
+    auto str = common::processTemplate(Template, replacements);
+    stream << str;
+
+    stream.flush();
+    if (!stream.good()) {
+        m_generator.logger().error("Failed to write \"" + filePath + "\".");
+        return false;
+    }
+    return true;
+}
+
 bool AllMessages::writePluginDefinition() const
 {
 
@@ -360,11 +478,7 @@ bool AllMessages::writePluginDefinition() const
                 return true;
             }
 
-            std::ofstream stream(filePath);
-            if (!stream) {
-                m_generator.logger().error("Failed to open \"" + filePath + "\" for writing.");
-                return false;
-            }
+            OutputFile stream(m_generator, filePath);
 
             common::ReplacementMap replacements;
             auto namespaces = m_generator.namespacesForInputInPlugin();
@@ -28,6 +28,7 @@ private:
     explicit AllMessages(Generator& generator) : m_generator(generator) {}
 
     bool writeProtocolDefinition() const;
+    bool writeProtocolFwdDefinition() const;
     bool writePluginDefinition() const;
 
     Generator& m_generator;
@@ -16,6 +16,7 @@
 #include "BitfieldField.h"
 
 #include <type_traits>
+#include <algorithm>
 
 #include <boost/algorithm/string.hpp>
 
@@ -339,6 +340,17 @@ bool BitfieldField::verifyAliasImpl(const std::string& fieldName) const
     return (*iter)->verifyAlias(restFieldName);
 }
 
+bool BitfieldField::isFixedLayoutImpl() const
+{
+    return
+        std::none_of(
+            m_members.begin(), m_members.end(),
+            [](auto& m)
+            {
+                return m->dslObj().isFailOnInvalid() || m->hasCustomReadRefresh();
+            });
+}
+
 std::string BitfieldField::getFieldBaseParams() const
 {
     auto obj = bitfieldFieldDslObj();
@@ -176,6 +176,10 @@ void BundleField::updateIncludesImpl(IncludesList& includes) const
 
     common::mergeIncludes(List, includes);
 
+    if (isFixedLayoutForFields(m_members)) {
+        common::mergeInclude("<iterator>", includes);
+    }
+
     for (auto& m : m_members) {
         m->updateIncludes(includes);
     }
@@ -255,6 +259,10 @@ std::string BundleField::getClassDefinitionImpl(
         replacements["COMMA"] = ',';
     }
 
+    if (replacements["READ"].empty() && replacements["WRITE"].empty() && isFixedLayoutForFields(m_members)) {
+        replacements["READ"] = getFixedLayoutForFields(m_members);
+    }
+
     if (!externalRef().empty()) {
         replacements.insert(std::make_pair("MEMBERS_OPT", "<TOpt>"));
     }
@@ -433,6 +441,11 @@ bool BundleField::verifyAliasImpl(const std::string& fieldName) const
     return (*iter)->verifyAlias(restFieldName);
 }
 
+bool BundleField::isFixedLayoutImpl() const
+{
+    return isFixedLayoutForFields(m_members);
+}
+
 std::string BundleField::getFieldOpts(const std::string& scope) const
 {
     StringsList options;
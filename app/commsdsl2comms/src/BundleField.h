@@ -57,6 +57,7 @@ protected:
     virtual std::string getCommonDefinitionImpl(const std::string& fullScope) const override final;
     virtual std::string getExtraRefToCommonDefinitionImpl(const std::string& fullScope) const override final;
     virtual bool verifyAliasImpl(const std::string& fieldName) const override final;
+    virtual bool isFixedLayoutImpl() const override final;
 
 private:
     using StringsList = common::StringsList;
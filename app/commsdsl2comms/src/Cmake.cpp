@@ -15,11 +15,10 @@
 
 #include "Cmake.h"
 
-#include <fstream>
-
 #include <boost/filesystem.hpp>
 
 #include "Generator.h"
+#include "OutputFile.h"
 #include "common.h"
 
 namespace bf = boost::filesystem;
@@ -27,13 +26,21 @@ namespace bf = boost::filesystem;
 namespace commsdsl2comms
 {
 
+namespace
+{
+
+const std::string IncludeReportScriptStr("IncludeReport.cmake");
+
+} // namespace
+
 bool Cmake::write(Generator& generator)
 {
     Cmake obj(generator);
     return 
         obj.writeMain() && 
         obj.writePlugin() &&
-        obj.writeTest();
+        obj.writeTest() &&
+        obj.writeIncludeReport();
 }
 
 bool Cmake::writeMain() const
@@ -49,11 +56,7 @@ bool Cmake::writeMain() const
     std::string filePathStr(filePath.string());
 
     m_generator.logger().info("Generating " + filePathStr);
-    std::ofstream stream(filePathStr);
-    if (!stream) {
-        m_generator.logger().error("Failed to open \"" + filePathStr + "\" for writing.");
-        return false;
-    }
+    OutputFile stream(m_generator, filePathStr);
 
     auto allInterfaces = m_generator.getAllInterfaces();
     assert(!allInterfaces.empty());
@@ -88,15 +91,66 @@ bool Cmake::writeMain() const
     replacements.insert(std::make_pair("BUILD_TEST_OPT", build_test_opt));
     replacements.insert(std::make_pair("BUILD_PLUGIN_OPT", build_plugin_opt));
 
+    if (m_generator.explicitInstantiationRequested()) {
+        replacements.insert(std::make_pair("INSTANTIATION_OPT",
+            "option (OPT_BUILD_INSTANTIATION \"Build and install library of explicitly instantiated messages and frames.\" OFF)\n"));
+        replacements.insert(std::make_pair("INSTANTIATION_PARAMS",
+            "# OPT_INSTANTIATION_INTERFACE - Class name of the interface for the explicit\n"
+            "#       instantiation library, must be provided when OPT_BUILD_INSTANTIATION is used.\n"
+            "# OPT_INSTANTIATION_INTERFACE_HEADER - Header file defining OPT_INSTANTIATION_INTERFACE,\n"
+            "#       defaults to the class name with \"::\" replaced by \"/\".\n"
+            "# OPT_INSTANTIATION_INCLUDE_DIRS - Extra include directories for the explicit\n"
+            "#       instantiation library, where the interface header resides.\n"
+            "# OPT_INSTANTIATION_OPTIONS - Class name of the options for the explicit\n"
+            "#       instantiation library, defaults to " + m_generator.scopeForOptions(common::defaultOptionsStr(), true, true) + "."));
+        replacements.insert(std::make_pair("INSTANTIATION_NEEDS_CC", " OR OPT_BUILD_INSTANTIATION"));
+        replacements.insert(std::make_pair("INSTANTIATION_SUBDIR",
+            "\n######################################################################\n\n"
+            "if (OPT_BUILD_INSTANTIATION)\n"
+            "    add_subdirectory(" + common::instantiationStr() + ")\n"
+            "endif ()"));
+    }
+
+    if (m_generator.includeReportRequested()) {
+        replacements.insert(std::make_pair("INCLUDE_REPORT",
+            "######################################################################\n\n"
+            "# Define include report target\n"
+            "if ((CMAKE_COMPILER_IS_GNUCC) OR (\"${CMAKE_CXX_COMPILER_ID}\" STREQUAL \"Clang\"))\n"
+            "    set (include_report_dirs \"${CMAKE_CURRENT_SOURCE_DIR}/include\")\n"
+            "    if (NOT \"${OPT_CC_MAIN_INSTALL_DIR}\" STREQUAL \"\")\n"
+            "        list (APPEND include_report_dirs \"${OPT_CC_MAIN_INSTALL_DIR}/include\")\n"
+            "    elseif (NOT \"${cc_install_dir}\" STREQUAL \"\")\n"
+            "        list (APPEND include_report_dirs \"${cc_install_dir}/include\")\n"
+            "    endif ()\n\n"
+            "    string (REPLACE \";\" \"|\" include_report_dirs_str \"${include_report_dirs}\")\n"
+            "    set (include_report_tgt \"include_report_" + m_generator.mainNamespace() + "\")\n"
+            "    add_custom_target (\"${include_report_tgt}\"\n"
+            "        COMMAND ${CMAKE_COMMAND}\n"
+            "            -DCOMPILER=${CMAKE_CXX_COMPILER}\n"
+            "            -DCXX_STANDARD=${CMAKE_CXX_STANDARD}\n"
+            "            -DINCLUDE_DIRS=${include_report_dirs_str}\n"
+            "            -DHEADERS_DIR=${CMAKE_CURRENT_SOURCE_DIR}/include/" + m_generator.mainNamespace() + "\n"
+            "            -DOUTPUT=${CMAKE_BINARY_DIR}/include_report_" + m_generator.mainNamespace() + ".csv\n"
+            "            -P ${CMAKE_CURRENT_SOURCE_DIR}/" + common::cmakeStr() + '/' + IncludeReportScriptStr + "\n"
+            "        WORKING_DIRECTORY ${PROJECT_SOURCE_DIR}\n"
+            "        VERBATIM)\n\n"
+            "    if (TARGET ${CC_EXTERNAL_TGT})\n"
+            "        add_dependencies(\"${include_report_tgt}\" ${CC_EXTERNAL_TGT})\n"
+            "    endif ()\n"
+            "endif ()\n"));
+    }
+
     static const std::string Template = 
         "cmake_minimum_required (VERSION 3.1)\n"
         "project (\"#^#PROJ_NAME#$#\")\n\n"
         "option (OPT_BUILD_TEST \"Build and install test applications.\" #^#BUILD_TEST_OPT#$#)\n"
         "option (OPT_BUILD_PLUGIN \"Build and install CommsChampion plugin.\" #^#BUILD_PLUGIN_OPT#$#)\n"
+        "#^#INSTANTIATION_OPT#$#"
         "option (OPT_NO_COMMS \"Forcefully exclude checkout and install of COMMS library. \\\n"
         "    Works only if OPT_BUILD_TEST and OPT_BUILD_PLUGIN options weren't used\" OFF)\n"
         "option (OPT_WARN_AS_ERR \"Treat warning as error\" ON)\n"
-        "option (OPT_USE_CCACHE \"Use of ccache on UNIX system\" ON)\n\n"
+        "option (OPT_USE_CCACHE \"Use of ccache on UNIX system\" ON)\n"
+        "option (OPT_PLUGIN_PCH \"Use precompiled header when building CommsChampion plugin (requires CMake v3.16).\" OFF)\n\n"
         "# Other parameters:\n"
         "# OPT_CMAKE_EXPORT_NAMESPACE - Set namespace for a protocol library\n"
         "#     exported via generated *Config.cmake file. Defaults to \"cc\".\n"
@@ -111,7 +165,11 @@ bool Cmake::writeMain() const
         "# OPT_TEST_FRAME - Class name of the frame for test applications,\n"
         "#       defaults to #^#DEFAULT_FRAME#$#.\n"
         "# OPT_TEST_INPUT_MESSAGES - All input messages bundle for test applications,\n"
-        "#       defaults to #^#DEFAULT_INPUT#$#.\n\n"
+        "#       defaults to #^#DEFAULT_INPUT#$#.\n"
+        "# OPT_PLUGIN_UNITY_BUILD_GROUPS - Number of unity translation units to group\n"
+        "#       CommsChampion plugin sources into (requires CMake v3.16), defaults to 0 (disabled).\n"
+        "#^#INSTANTIATION_PARAMS#$#\n"
+        "\n"
         "if (\"${OPT_CC_TAG}\" STREQUAL \"\")\n"
         "    set (OPT_CC_TAG \"#^#CC_TAG#$#\")\n"
         "endif()\n\n"
@@ -173,7 +231,7 @@ bool Cmake::writeMain() const
         "######################################################################\n\n"
         "# Use external CommsChampion project or compile it in place\n"
         "set (CC_EXTERNAL_TGT \"comms_champion_external\")\n"
-        "if (OPT_BUILD_TEST OR OPT_BUILD_PLUGIN)\n"
+        "if (OPT_BUILD_TEST OR OPT_BUILD_PLUGIN#^#INSTANTIATION_NEEDS_CC#$#)\n"
         "    set (external_cc_needed TRUE)\n"
         "endif ()\n\n"
         "if ((external_cc_needed OR (NOT OPT_NO_COMMS)) AND (\"${OPT_CC_MAIN_INSTALL_DIR}\" STREQUAL \"\"))\n"
@@ -257,6 +315,7 @@ bool Cmake::writeMain() const
         "        COMMAND ${DOXYGEN_EXECUTABLE} ${OPT_DOXYGEN_CONFIG_FILE}\n"
         "        WORKING_DIRECTORY ${PROJECT_SOURCE_DIR})\n"
         "endif ()\n\n"
+        "#^#INCLUDE_REPORT#$#\n"
         "######################################################################\n\n"
         "# Define protocol library\n"
         "add_library(#^#PROJ_NAMESPACE#$# INTERFACE)\n\n"
@@ -311,6 +370,7 @@ bool Cmake::writeMain() const
         "if (OPT_BUILD_PLUGIN)\n"
         "    add_subdirectory(cc_plugin)\n"
         "endif ()\n"
+        "#^#INSTANTIATION_SUBDIR#$#\n"
         "#^#APPEND#$#\n";
 
     auto str = common::processTemplate(Template, replacements);
@@ -337,11 +397,7 @@ bool Cmake::writePlugin() const
     std::string filePathStr(filePath.string());
 
     m_generator.logger().info("Generating " + filePathStr);
-    std::ofstream stream(filePathStr);
-    if (!stream) {
-        m_generator.logger().error("Failed to open \"" + filePathStr + "\" for writing.");
-        return false;
-    }
+    OutputFile stream(m_generator, filePathStr);
 
     common::StringsList calls;
     auto plugins = m_generator.getPlugins();
@@ -361,6 +417,17 @@ bool Cmake::writePlugin() const
     replacements.insert(std::make_pair("SOURCES", m_generator.pluginCommonSources()));
     replacements.insert(std::make_pair("PROJ_NAMESPACE", m_generator.mainNamespace()));
     replacements.insert(std::make_pair("PLUGINS", common::listToString(calls, "\n", "\n")));
+
+    common::StringsList pchIncludes = {
+        "<QtCore/QVariantList>",
+        "<QtCore/QVariantMap>",
+        "[[\"comms/comms.h\"]]",
+        "[[\"comms_champion/property/field.h\"]]",
+        "[[\"comms_champion/ProtocolMessageBase.h\"]]",
+        "[[" + m_generator.headerfileForField(common::fieldBaseStr()) + "]]",
+        "[[" + m_generator.headerfileForOptions(common::defaultOptionsStr()) + "]]"
+    };
+    replacements.insert(std::make_pair("PCH_INCLUDES", common::listToString(pchIncludes, "\n", common::emptyString())));
     if (plugins.size() == 1U) {
         auto str =
             "if (TARGET ${CC_EXTERNAL_TGT})\n"
@@ -399,6 +466,22 @@ bool Cmake::writePlugin() const
         "    endif ()\n\n"
         "    if (TARGET ${CC_EXTERNAL_TGT})\n"
         "        add_dependencies(${name} ${CC_EXTERNAL_TGT})\n"
+        "    endif ()\n\n"
+        "    if ((OPT_PLUGIN_UNITY_BUILD_GROUPS GREATER 0) OR OPT_PLUGIN_PCH)\n"
+        "        if (CMAKE_VERSION VERSION_LESS \"3.16\")\n"
+        "            message (WARNING \"Unity build and precompiled header of the plugin require CMake v3.16 or later\")\n"
+        "            return ()\n"
+        "        endif ()\n"
+        "    endif ()\n\n"
+        "    if (OPT_PLUGIN_UNITY_BUILD_GROUPS GREATER 0)\n"
+        "        list (LENGTH src src_count)\n"
+        "        math (EXPR batch_size \"(${src_count} + ${OPT_PLUGIN_UNITY_BUILD_GROUPS} - 1) / ${OPT_PLUGIN_UNITY_BUILD_GROUPS}\")\n"
+        "        set_target_properties (${name} PROPERTIES UNITY_BUILD ON UNITY_BUILD_BATCH_SIZE ${batch_size})\n"
+        "    endif ()\n\n"
+        "    if (OPT_PLUGIN_PCH)\n"
+        "        target_precompile_headers (${name} PRIVATE\n"
+        "            #^#PCH_INCLUDES#$#\n"
+        "        )\n"
         "    endif ()\n"
         "endfunction()\n\n"
         "######################################################################\n\n"
@@ -483,11 +566,7 @@ bool Cmake::writeTest() const
     std::string filePathStr(filePath.string());
 
     m_generator.logger().info("Generating " + filePathStr);
-    std::ofstream stream(filePathStr);
-    if (!stream) {
-        m_generator.logger().error("Failed to open \"" + filePathStr + "\" for writing.");
-        return false;
-    }
+    OutputFile stream(m_generator, filePathStr);
 
     auto allInterfaces = m_generator.getAllInterfaces();
     assert(!allInterfaces.empty());
@@ -592,4 +671,71 @@ bool Cmake::writeTest() const
 }
 
 
+bool Cmake::writeIncludeReport() const
+{
+    if (!m_generator.includeReportRequested()) {
+        return true;
+    }
+
+    auto filePath = m_generator.startCmakeScriptWrite(IncludeReportScriptStr);
+    if (filePath.empty()) {
+        return true;
+    }
+
+    OutputFile stream(m_generator, filePath);
+
+    static const std::string Template =
+        "# Reports preprocessed size of every protocol definition header.\n"
+        "# Expected parameters:\n"
+        "# COMPILER - GCC or Clang compatible C++ compiler.\n"
+        "# CXX_STANDARD - Version of the C++ standard to use.\n"
+        "# INCLUDE_DIRS - Include directories, separated by \"|\".\n"
+        "# HEADERS_DIR - Directory of the protocol definition headers.\n"
+        "# OUTPUT - Path to the output report file (CSV).\n\n"
+        "foreach (param COMPILER CXX_STANDARD HEADERS_DIR OUTPUT)\n"
+        "    if (\"${${param}}\" STREQUAL \"\")\n"
+        "        message (FATAL_ERROR \"${param} parameter is not provided\")\n"
+        "    endif ()\n"
+        "endforeach ()\n\n"
+        "string (REPLACE \"|\" \";\" inc_dirs \"${INCLUDE_DIRS}\")\n"
+        "set (inc_opts)\n"
+        "foreach (dir ${inc_dirs})\n"
+        "    list (APPEND inc_opts \"-I${dir}\")\n"
+        "endforeach ()\n\n"
+        "get_filename_component (base_dir \"${HEADERS_DIR}\" DIRECTORY)\n"
+        "file (GLOB_RECURSE headers RELATIVE \"${base_dir}\" \"${HEADERS_DIR}/*.h\")\n"
+        "list (SORT headers)\n\n"
+        "set (report \"header,direct_includes,preprocessed_bytes\\n\")\n"
+        "set (total_bytes 0)\n"
+        "foreach (header ${headers})\n"
+        "    file (STRINGS \"${base_dir}/${header}\" direct_includes REGEX \"^#include \")\n"
+        "    list (LENGTH direct_includes direct_count)\n\n"
+        "    execute_process (\n"
+        "        COMMAND ${COMPILER} -E -P -x c++ -std=c++${CXX_STANDARD} ${inc_opts} \"${base_dir}/${header}\"\n"
+        "        OUTPUT_VARIABLE preprocessed\n"
+        "        ERROR_VARIABLE errors\n"
+        "        RESULT_VARIABLE result\n"
+        "    )\n\n"
+        "    if (\"${result}\" STREQUAL \"0\")\n"
+        "        string (LENGTH \"${preprocessed}\" bytes)\n"
+        "        math (EXPR total_bytes \"${total_bytes} + ${bytes}\")\n"
+        "    else ()\n"
+        "        message (WARNING \"Failed to preprocess ${header}:\\n${errors}\")\n"
+        "        set (bytes \"\")\n"
+        "    endif ()\n\n"
+        "    set (report \"${report}${header},${direct_count},${bytes}\\n\")\n"
+        "endforeach ()\n\n"
+        "file (WRITE \"${OUTPUT}\" \"${report}\")\n"
+        "message (STATUS \"Total preprocessed size: ${total_bytes} bytes, report: ${OUTPUT}\")\n";
+
+    stream << Template;
+
+    stream.flush();
+    if (!stream.good()) {
+        m_generator.logger().error("Failed to write \"" + filePath + "\".");
+        return false;
+    }
+    return true;
+}
+
 } // namespace commsdsl2comms
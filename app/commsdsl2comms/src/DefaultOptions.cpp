@@ -15,11 +15,10 @@
 
 #include "DefaultOptions.h"
 
-#include <fstream>
-
 #include <boost/filesystem.hpp>
 
 #include "Generator.h"
+#include "OutputFile.h"
 #include "common.h"
 
 namespace bf = boost::filesystem;
@@ -55,11 +54,7 @@ bool DefaultOptions::writeDefinition() const
     replacements.insert(std::make_pair("CLASS_NAME", std::move(className)));
     replacements.insert(std::make_pair("BODY", m_generator.getDefaultOptionsBody()));
 
-    std::ofstream stream(fileName);
-    if (!stream) {
-        m_generator.logger().error("Failed to open \"" + fileName + "\" for writing.");
-        return false;
-    }
+    OutputFile stream(m_generator, fileName);
 
     static const std::string Template(
         "#^#GEN_COMMENT#$#\n"
@@ -123,11 +118,7 @@ bool DefaultOptions::writeClientServer(bool client) const
     replacements.insert(std::make_pair("BODY", std::move(body)));
     replacements.insert(std::make_pair("TYPE", common::toLowerCopy(type)));
 
-    std::ofstream stream(fileName);
-    if (!stream) {
-        m_generator.logger().error("Failed to open \"" + fileName + "\" for writing.");
-        return false;
-    }
+    OutputFile stream(m_generator, fileName);
 
     static const std::string Template(
         "#^#GEN_COMMENT#$#\n"
@@ -181,11 +172,7 @@ bool DefaultOptions::writeBareMetal() const
     replacements.insert(std::make_pair("BODY", std::move(body)));
     replacements.insert(std::make_pair("SEQ_DEFAULT_SIZE", common::seqDefaultSizeStr()));
 
-    std::ofstream stream(fileName);
-    if (!stream) {
-        m_generator.logger().error("Failed to open \"" + fileName + "\" for writing.");
-        return false;
-    }
+    OutputFile stream(m_generator, fileName);
 
     static const std::string Template(
         "#^#GEN_COMMENT#$#\n"
@@ -15,14 +15,12 @@
 
 #include "Dispatch.h"
 
-#include <fstream>
-
 #include <boost/filesystem.hpp>
 #include <boost/algorithm/string.hpp>
 
 #include "Generator.h"
+#include "OutputFile.h"
 #include "common.h"
-#include "EnumField.h"
 
 namespace bf = boost::filesystem;
 namespace ba = boost::algorithm;
@@ -39,132 +37,24 @@ bool Dispatch::write(Generator& generator)
 
 bool Dispatch::writeProtocolDefinition() const
 {
-    struct MessagesInfo
-    {
-        DslMessagesList m_messages;
-        common::StringsList m_includes;
-    };
-
-    struct PlatformInfo
-    {
-        MessagesInfo m_all;
-        MessagesInfo m_serverInput;
-        MessagesInfo m_clientInput;
-        bool m_realPlatform = true;
-    };
-
-    using PlatformsMap = std::map<std::string, PlatformInfo>;
-    PlatformsMap platformsMap;
-    platformsMap.insert(std::make_pair(std::string(), PlatformInfo()));
-
-    auto& platforms = m_generator.platforms();
-    for (auto& p : platforms) {
-        platformsMap.insert(std::make_pair(p, PlatformInfo()));
-    };
-
-    auto bundles = m_generator.extraMessagesBundles();
-    for (auto& b : bundles) {
-        auto& elem = platformsMap[b];
-        elem.m_realPlatform = false;
-    }
-
-    auto allMessages = m_generator.getAllDslMessages();
-
-    for (auto& p : platformsMap) {
-        auto updateFunc =
-            [this, &allMessages](auto& msgInfo, const std::string& inputName)
-            {
-                msgInfo.m_messages.reserve(allMessages.size());
-                common::mergeInclude("<type_traits>", msgInfo.m_includes);
-                auto inputHeader = m_generator.headerfileForInput(inputName, false);
-                common::mergeInclude(inputHeader, msgInfo.m_includes);
-                auto msgIdHeader = m_generator.headerfileForRoot(common::msgIdEnumNameStr(), false);
-                common::mergeInclude(msgIdHeader, msgInfo.m_includes);
-            };
-
-        auto& inputPrefix = p.first;
-        if (inputPrefix.empty()) {
-            updateFunc(p.second.m_all, common::allMessagesStr());
-        }
-        else {
-            updateFunc(p.second.m_all, inputPrefix + "Messages");
-        }
-
-        updateFunc(p.second.m_serverInput, inputPrefix + common::serverInputMessagesStr());
-        updateFunc(p.second.m_clientInput, inputPrefix + common::clientInputMessagesStr());
-    }
-
-    for (auto m : allMessages) {
-        assert(m.valid());
-
-        if (!m_generator.doesElementExist(m.sinceVersion(), m.deprecatedSince(), m.isDeprecatedRemoved())) {
-            continue;
-        }
-
-        auto extRef = m.externalRef();
-        assert(!extRef.empty());
-
-        auto addToMessageInfoFunc =
-            [m](MessagesInfo& info)
-            {
-                info.m_messages.push_back(m);
-            };
-
-        bool serverInput = m.sender() != commsdsl::Message::Sender::Server;
-        bool clientInput = m.sender() != commsdsl::Message::Sender::Client;
-
-        auto addToPlatformInfoFunc =
-            [&addToMessageInfoFunc, serverInput, clientInput](PlatformInfo& info)
-            {
-                addToMessageInfoFunc(info.m_all);
-                if (serverInput) {
-                    addToMessageInfoFunc(info.m_serverInput);
-                }
+    auto platformsMap = m_generator.getPlatformsMessages();
 
-                if (clientInput) {
-                    addToMessageInfoFunc(info.m_clientInput);
-                }
-            };
-
-        addToPlatformInfoFunc(platformsMap[common::emptyString()]);
-
-        if (platformsMap.size() == 1U) {
-            continue;
-        }
-
-        auto& msgPlatforms = m.platforms();
-        if (msgPlatforms.empty()) {
-            for (auto& p : platformsMap) {
-                if (p.first.empty() || (!p.second.m_realPlatform)) {
-                    continue;
-                }
-                addToPlatformInfoFunc(p.second);
-            }
-        }
-
-        for (auto& p : msgPlatforms) {
-            auto iter = platformsMap.find(p);
-            if (iter == platformsMap.end()) {
-                assert(!"Should not happen");
-                continue;
-            }
-
-            addToPlatformInfoFunc(iter->second);
-        }
-
-        auto inBundles = m_generator.bundlesForMessage(extRef);
-        for (auto& b : inBundles) {
-            auto iter = platformsMap.find(b);
-            if (iter == platformsMap.end()) {
-                assert(!"Should not happen");
-                continue;
-            }
-            addToPlatformInfoFunc(iter->second);
-        }
-    }
+    // The dispatch functions refer to the message classes only inside
+    // templates, the forward declarations are enough. The message
+    // definitions are required only when the functions are instantiated.
+    auto includesFunc =
+        [this]()
+        {
+            common::StringsList includes;
+            common::mergeInclude("<type_traits>", includes);
+            common::mergeInclude(m_generator.headerfileForInput(common::allMessagesStr() + common::fwdSuffixStr(), false), includes);
+            common::mergeInclude(m_generator.headerfileForOptions(common::defaultOptionsStr(), false), includes);
+            common::mergeInclude(m_generator.headerfileForRoot(common::msgIdEnumNameStr(), false), includes);
+            return includes;
+        };
 
     auto writeFileFunc =
-        [this](const MessagesInfo& info,
+        [this, &includesFunc](const Generator::InputMessages& info,
                const std::string& fileName,
                const std::string& platName = common::emptyString(),
                const std::string& inputName = common::emptyString())
@@ -176,11 +66,7 @@ bool Dispatch::writeProtocolDefinition() const
                 return true;
             }
 
-            std::ofstream stream(filePath);
-            if (!stream) {
-                m_generator.logger().error("Failed to open \"" + filePath + "\" for writing.");
-                return false;
-            }
+            OutputFile stream(m_generator, filePath);
 
             auto func =
                 getDispatchFunc(
@@ -192,7 +78,7 @@ bool Dispatch::writeProtocolDefinition() const
             replacements.insert(std::make_pair("GEN_COMMENT", m_generator.fileGeneratedComment()));
             replacements.insert(std::make_pair("BEG_NAMESPACE", std::move(namespaces.first)));
             replacements.insert(std::make_pair("END_NAMESPACE", std::move(namespaces.second)));
-            replacements.insert(std::make_pair("INCLUDES", common::includesToStatements(info.m_includes)));
+            replacements.insert(std::make_pair("INCLUDES", common::includesToStatements(includesFunc())));
             replacements.insert(std::make_pair("FUNCS", std::move(func)));
             replacements.insert(std::make_pair("DISPATCHERS", getMsgDispatcher(common::nameToClassCopy(fileName))));
 
@@ -208,7 +94,10 @@ bool Dispatch::writeProtocolDefinition() const
             static const std::string Templ =
                 "#^#GEN_COMMENT#$#\n"
                 "/// @file\n"
-                "/// @brief Contains dispatch to handling function(s) for #^#PLAT_NAME#$##^#INPUT#$#messages.\n\n"
+                "/// @brief Contains dispatch to handling function(s) for #^#PLAT_NAME#$##^#INPUT#$#messages.\n"
+                "/// @details Only forward declarations of the messages are included, the\n"
+                "///     definitions of the dispatched messages need to be included before\n"
+                "///     the functions are used.\n\n"
                 "#pragma once\n\n"
                 "#^#INCLUDES#$#\n"
                 "#^#BEG_NAMESPACE#$#\n"
@@ -227,6 +116,70 @@ bool Dispatch::writeProtocolDefinition() const
             return true;
         };
 
+    auto writeVariantFileFunc =
+        [this](const Generator::InputMessages& info,
+               const std::string& name,
+               const std::string& platName,
+               const std::string& inputName)
+        {
+            auto fileName = "Variant" + name + "Message";
+            auto startInfo = m_generator.startDispatchProtocolWrite(fileName);
+            auto& filePath = startInfo.first;
+
+            if (filePath.empty()) {
+                return true;
+            }
+
+            OutputFile stream(m_generator, filePath);
+
+            // The variant holds the message objects, complete types are required.
+            common::StringsList includes;
+            common::mergeInclude("<type_traits>", includes);
+            common::mergeInclude(m_generator.headerfileForInput(info.m_inputName, false), includes);
+            common::mergeInclude(m_generator.headerfileForRoot(common::msgIdEnumNameStr(), false), includes);
+            common::mergeInclude("<cstddef>", includes);
+            common::mergeInclude("<variant>", includes);
+            common::mergeInclude("comms/ErrorStatus.h", includes);
+
+            common::ReplacementMap replacements;
+            auto namespaces = m_generator.namespacesForDispatch();
+            replacements.insert(std::make_pair("GEN_COMMENT", m_generator.fileGeneratedComment()));
+            replacements.insert(std::make_pair("BEG_NAMESPACE", std::move(namespaces.first)));
+            replacements.insert(std::make_pair("END_NAMESPACE", std::move(namespaces.second)));
+            replacements.insert(std::make_pair("INCLUDES", common::includesToStatements(includes)));
+            replacements.insert(std::make_pair("DEFS", getVariantDefs(name, info.m_messages)));
+
+            if (!platName.empty()) {
+                replacements.insert(std::make_pair("PLAT_NAME", '\"' + platName + "\" "));
+            }
+
+            replacements.insert(std::make_pair("INPUT", inputName + " input "));
+
+            static const std::string Templ =
+                "#^#GEN_COMMENT#$#\n"
+                "/// @file\n"
+                "/// @brief Contains std::variant based read and dispatch of #^#PLAT_NAME#$##^#INPUT#$#messages.\n"
+                "/// @details Requires C++17, the definitions are skipped when compiled\n"
+                "///     with earlier standard.\n\n"
+                "#pragma once\n\n"
+                "#if __cplusplus >= 201703L || (defined(_MSVC_LANG) && _MSVC_LANG >= 201703L)\n\n"
+                "#^#INCLUDES#$#\n"
+                "#^#BEG_NAMESPACE#$#\n"
+                "#^#DEFS#$#\n"
+                "#^#END_NAMESPACE#$#\n"
+                "#endif // #if __cplusplus >= 201703L || (defined(_MSVC_LANG) && _MSVC_LANG >= 201703L)\n";
+
+            auto str = common::processTemplate(Templ, replacements);
+            stream << str;
+
+            stream.flush();
+            if (!stream.good()) {
+                m_generator.logger().error("Failed to write \"" + filePath + "\".");
+                return false;
+            }
+            return true;
+        };
+
     for (auto& p : platformsMap) {
         static const std::string DispatchPrefix = "Dispatch";
         static const std::string MessageSuffix = "Message";
@@ -246,6 +199,22 @@ bool Dispatch::writeProtocolDefinition() const
         if (!writeFileFunc(p.second.m_clientInput, clientName, p.first, "client")) {
             return false;
         }
+
+        if (!m_generator.variantDispatchRequested()) {
+            continue;
+        }
+
+        if (!writeVariantFileFunc(p.second.m_all, platformName, p.first, "all")) {
+            return false;
+        }
+
+        if (!writeVariantFileFunc(p.second.m_serverInput, platformName + common::serverInputStr(), p.first, "server")) {
+            return false;
+        }
+
+        if (!writeVariantFileFunc(p.second.m_clientInput, platformName + common::clientInputStr(), p.first, "client")) {
+            return false;
+        }
     }
 
     return true;
@@ -275,7 +244,7 @@ std::string Dispatch::getDispatchFunc(
     for (auto& elem : msgMap) {
         auto& msgList = elem.second;
         assert(!msgList.empty());
-        auto idStr = getIdString(elem.first);
+        auto idStr = m_generator.messageIdStr(elem.first);
 
         static const std::string MsgCaseTempl =
             "case #^#MSG_ID#$#:\n"
@@ -624,35 +593,152 @@ std::string Dispatch::getMsgDispatcher(
 }
 
 
-std::string Dispatch::getIdString(std::uintmax_t value) const
+std::string Dispatch::getVariantDefs(
+    const std::string& name,
+    const DslMessagesList& messages) const
 {
-    auto numValueFunc =
-        [this, value]()
-        {
-            return
-                "static_cast<" +
-                m_generator.scopeForRoot(common::msgIdEnumNameStr(), true, true) +
-                ">(" +
-                common::numToString(value) +
-                ")";
-        };
-
-    auto* idField = m_generator.getMessageIdField();
-    if (idField == nullptr) {
-        return numValueFunc();
+    using MsgMap = std::map<std::uintmax_t, DslMessagesList>;
+    MsgMap msgMap;
+    common::StringsList msgTypes;
+    msgTypes.reserve(messages.size() + 1U);
+    msgTypes.push_back("std::monostate");
+    for (auto& m : messages) {
+        msgMap[m.id()].push_back(m);
+        msgTypes.push_back(m_generator.scopeForMessage(m.externalRef(), true, true) + "<TInterface, TProtOptions>");
     }
 
-    if (idField->kind() != commsdsl::Field::Kind::Enum) {
-        return numValueFunc();
+    static const std::string MsgCaseTempl =
+        "case #^#MSG_ID#$#:\n"
+        "{\n"
+        "    using MsgType = #^#MSG_TYPE#$#<TInterface, TProtOptions>;\n"
+        "    return msg.template emplace<MsgType>().doRead(iter, len);\n"
+        "}";
+
+    common::StringsList cases;
+    for (auto& elem : msgMap) {
+        auto& msgList = elem.second;
+        assert(!msgList.empty());
+
+        common::StringsList offsetCases;
+        for (auto idx=0U; idx < msgList.size(); ++idx) {
+            common::ReplacementMap repl;
+            repl.insert(std::make_pair("MSG_ID", common::numToString(idx)));
+            repl.insert(std::make_pair("MSG_TYPE", m_generator.scopeForMessage(msgList[idx].externalRef(), true, true)));
+            offsetCases.push_back(common::processTemplate(MsgCaseTempl, repl));
+        }
+
+        common::ReplacementMap repl;
+        repl.insert(std::make_pair("MSG_ID", m_generator.messageIdStr(elem.first)));
+        repl.insert(std::make_pair("IDX_CASES", common::listToString(offsetCases, "\n", common::emptyString())));
+
+        static const std::string Templ =
+            "case #^#MSG_ID#$#:\n"
+            "    switch (idx) {\n"
+            "    #^#IDX_CASES#$#\n"
+            "    default:\n"
+            "        break;\n"
+            "    };\n"
+            "    break;";
+        cases.push_back(common::processTemplate(Templ, repl));
     }
 
-    auto* castedMsgIdField = static_cast<const EnumField*>(idField);
-    auto valStr = castedMsgIdField->getValueName(static_cast<std::intmax_t>(value));
-    if (valStr.empty()) {
-        return numValueFunc();
+    static const std::string Templ =
+        "/// @brief Variant of all the #^#DESC#$#messages.\n"
+        "/// @details Holds @b std::monostate when no valid message object has been read.\n"
+        "/// @tparam TInterface Interface class of all the messages. Expected to be\n"
+        "///     defined without any polymorphic interface options, which results\n"
+        "///     in message classes without virtual functions.\n"
+        "/// @tparam TProtOptions Protocol options struct used for the application,\n"
+        "///     like @ref #^#DEFAULT_OPTIONS#$#.\n"
+        "/// @note Defined in #^#HEADERFILE#$#\n"
+        "template <typename TInterface, typename TProtOptions = #^#DEFAULT_OPTIONS#$#>\n"
+        "using #^#NAME#$#MsgVariant =\n"
+        "    std::variant<\n"
+        "        #^#MESSAGES#$#\n"
+        "    >;\n\n"
+        "/// @brief Read message into the variant object.\n"
+        "/// @details @b switch statement based (on message ID) selection of the message\n"
+        "///     type to construct in place inside the variant, followed by non-polymorphic\n"
+        "///     read of its contents. No dynamic memory allocation is involved.\n"
+        "/// @tparam TInterface Interface class of all the messages.\n"
+        "/// @tparam TProtOptions Protocol options struct used for the application,\n"
+        "///     like @ref #^#DEFAULT_OPTIONS#$#.\n"
+        "/// @param[in] id Numeric message ID.\n"
+        "/// @param[in] idx Index of the message among messages with the same ID.\n"
+        "/// @param[out] msg Variant object to construct the message in.\n"
+        "/// @param[in, out] iter Iterator used for reading.\n"
+        "/// @param[in] len Number of remaining bytes in the input buffer.\n"
+        "/// @return @b comms::ErrorStatus::InvalidMsgId in case the message type\n"
+        "///     is not recognised (@b msg holds @b std::monostate), status of the\n"
+        "///     message read otherwise.\n"
+        "/// @note Defined in #^#HEADERFILE#$#\n"
+        "template <typename TInterface, typename TProtOptions = #^#DEFAULT_OPTIONS#$#, typename TIter>\n"
+        "comms::ErrorStatus readVariant#^#NAME#$#Message(\n"
+        "    #^#MSG_ID_TYPE#$# id,\n"
+        "    std::size_t idx,\n"
+        "    #^#NAME#$#MsgVariant<TInterface, TProtOptions>& msg,\n"
+        "    TIter& iter,\n"
+        "    std::size_t len)\n"
+        "{\n"
+        "    static_cast<void>(iter);\n"
+        "    static_cast<void>(len);\n"
+        "    switch(id) {\n"
+        "    #^#CASES#$#\n"
+        "    default:\n"
+        "        break;\n"
+        "    };\n\n"
+        "    msg.template emplace<std::monostate>();\n"
+        "    return comms::ErrorStatus::InvalidMsgId;\n"
+        "}\n\n"
+        "/// @brief Read message into the variant object.\n"
+        "/// @details Same as other readVariant#^#NAME#$#Message(), but without @b idx parameter.\n"
+        "/// @note Defined in #^#HEADERFILE#$#\n"
+        "template <typename TInterface, typename TProtOptions = #^#DEFAULT_OPTIONS#$#, typename TIter>\n"
+        "comms::ErrorStatus readVariant#^#NAME#$#Message(\n"
+        "    #^#MSG_ID_TYPE#$# id,\n"
+        "    #^#NAME#$#MsgVariant<TInterface, TProtOptions>& msg,\n"
+        "    TIter& iter,\n"
+        "    std::size_t len)\n"
+        "{\n"
+        "    return readVariant#^#NAME#$#Message<TInterface, TProtOptions>(id, 0U, msg, iter, len);\n"
+        "}\n\n"
+        "/// @brief Dispatch message held by the variant object to its appropriate handling function.\n"
+        "/// @details Uses @b std::visit(), i.e. static (compile time) binding to the\n"
+        "///     handling function, no virtual functions are involved.\n"
+        "/// @param[in] msg Variant object holding the message.\n"
+        "/// @param[in] handler Reference to handling object. Must define\n"
+        "///     @b handle() member function for every message type it expects\n"
+        "///     to handle and one for @b std::monostate (or a template one for\n"
+        "///     all the irrelevant message types).\n"
+        "///     Every @b handle() function may return a value, but every\n"
+        "///     function must return the @b same type.\n"
+        "/// @note Defined in #^#HEADERFILE#$#\n"
+        "template <typename TVariant, typename THandler>\n"
+        "decltype(auto) dispatchVariant#^#NAME#$#Message(TVariant& msg, THandler& handler)\n"
+        "{\n"
+        "    return\n"
+        "        std::visit(\n"
+        "            [&handler](auto& m) -> decltype(auto)\n"
+        "            {\n"
+        "                return handler.handle(m);\n"
+        "            },\n"
+        "            msg);\n"
+        "}\n";
+
+    std::string desc;
+    if (!name.empty()) {
+        desc = name + ' ';
     }
 
-    return m_generator.scopeForRoot(common::msgIdPrefixStr() + valStr, true, true);
+    common::ReplacementMap repl;
+    repl.insert(std::make_pair("NAME", name));
+    repl.insert(std::make_pair("DESC", std::move(desc)));
+    repl.insert(std::make_pair("MSG_ID_TYPE", m_generator.scopeForRoot(common::msgIdEnumNameStr(), true, true)));
+    repl.insert(std::make_pair("MESSAGES", common::listToString(msgTypes, ",\n", common::emptyString())));
+    repl.insert(std::make_pair("CASES", common::listToString(cases, "\n", common::emptyString())));
+    repl.insert(std::make_pair("DEFAULT_OPTIONS", m_generator.scopeForOptions(common::defaultOptionsStr(), true, true)));
+    repl.insert(std::make_pair("HEADERFILE", m_generator.headerfileForDispatch("Variant" + name + "Message")));
+    return common::processTemplate(Templ, repl);
 }
 
 } // namespace commsdsl2comms
@@ -41,7 +41,9 @@ private:
         const DslMessagesList& messages) const;
     std::string getMsgDispatcher(
         const std::string& fileName) const;
-    std::string getIdString(std::uintmax_t value) const;
+    std::string getVariantDefs(
+        const std::string& name,
+        const DslMessagesList& messages) const;
 
     Generator& m_generator;
 };
@@ -15,7 +15,6 @@
 
 #include "Doxygen.h"
 
-#include <fstream>
 #include <vector>
 #include <string>
 
@@ -23,6 +22,7 @@
 #include <boost/algorithm/string.hpp>
 
 #include "Generator.h"
+#include "OutputFile.h"
 #include "common.h"
 
 namespace bf = boost::filesystem;
@@ -63,11 +63,7 @@ bool Doxygen::writeConf() const
         return true;
     }
 
-    std::ofstream stream(filePath);
-    if (!stream) {
-        m_generator.logger().error("Failed to open \"" + filePath + "\" for writing.");
-        return false;
-    }
+    OutputFile stream(m_generator, filePath);
 
     static const std::string Template = 
         "DOXYFILE_ENCODING      = UTF-8\n"
@@ -232,11 +228,7 @@ bool Doxygen::writeLayout() const
         return true;
     }
 
-    std::ofstream stream(filePath);
-    if (!stream) {
-        m_generator.logger().error("Failed to open \"" + filePath + "\" for writing.");
-        return false;
-    }
+    OutputFile stream(m_generator, filePath);
 
     static const std::string Str =
         "<doxygenlayout version=\"1.0\">\n"
@@ -442,11 +434,7 @@ bool Doxygen::writeNamespaces() const
         return true;
     }
 
-    std::ofstream stream(filePath);
-    if (!stream) {
-        m_generator.logger().error("Failed to open \"" + filePath + "\" for writing.");
-        return false;
-    }
+    OutputFile stream(m_generator, filePath);
 
     static const std::string Template =
         "/// @namespace #^#NS#$#\n"
@@ -467,6 +455,8 @@ bool Doxygen::writeNamespaces() const
         "/// @brief Main namespace for hold input messages bundles.\n\n"
         "/// @namespace #^#NS#$#::dispatch\n"
         "/// @brief Main namespace for the various message dispatch functions.\n\n"
+        "/// @namespace #^#NS#$#::factory\n"
+        "/// @brief Main namespace for the message factories.\n\n"
         "#^#OTHER_NS#$#\n"
         "#^#APPEND#$#\n"
         ;
@@ -524,11 +514,7 @@ bool Doxygen::writeMainpage() const
         return true;
     }
 
-    std::ofstream stream(filePath);
-    if (!stream) {
-        m_generator.logger().error("Failed to open \"" + filePath + "\" for writing.");
-        return false;
-    }
+    OutputFile stream(m_generator, filePath);
 
     static const std::string Template =
         "/// @mainpage \"#^#PROJ_NAME#$#\" Binary Protocol Library\n"
@@ -577,6 +577,11 @@ std::string EnumField::getCommonDefinitionImpl(const std::string& fullScope) con
     return common::processTemplate(Templ, repl);
 }
 
+bool EnumField::isFixedLayoutImpl() const
+{
+    return true;
+}
+
 std::string EnumField::getEnumeration(const std::string& scope, bool checkIfMemberChild) const
 {
     if (dslObj().semanticType() == commsdsl::Field::SemanticType::MessageId) {
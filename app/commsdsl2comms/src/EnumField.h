@@ -56,6 +56,7 @@ protected:
         bool forcedVersionOptional) const override final;
     virtual std::string getPluginPropertiesImpl(bool serHiddenParam) const override final;
     virtual std::string getCommonDefinitionImpl(const std::string& fullScope) const override final;
+    virtual bool isFixedLayoutImpl() const override final;
 
 private:
     using StringsList = common::StringsList;
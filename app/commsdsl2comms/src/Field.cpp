@@ -19,11 +19,11 @@
 #include <type_traits>
 #include <cassert>
 #include <algorithm>
-#include <fstream>
 
 #include <boost/algorithm/string.hpp>
 
 #include "Generator.h"
+#include "OutputFile.h"
 #include "IntField.h"
 #include "RefField.h"
 #include "EnumField.h"
@@ -295,10 +295,17 @@ std::string Field::getBareMetalDefaultOptions(const std::string& scope) const
 bool Field::writeFiles() const
 {
     return
-        writeProtocolDefinitionCommonFile() &&
-        writeProtocolDefinitionFile() &&
-        writePluginHeaderFile() &&
-        writePluginScrFile();
+        m_generator.writeCachedField(
+            externalRef(),
+            m_dslObj.definitionDigest(),
+            [this]()
+            {
+                return
+                    writeProtocolDefinitionCommonFile() &&
+                    writeProtocolDefinitionFile() &&
+                    writePluginHeaderFile() &&
+                    writePluginScrFile();
+            });
 }
 
 std::string Field::getClassPrefix(
@@ -550,6 +557,24 @@ bool Field::isPseudo() const
     return m_forcedPseudo || m_dslObj.isPseudo();
 }
 
+bool Field::isFixedLayout() const
+{
+    if (isVersionOptional() ||
+        isFailOnInvalid() ||
+        (!m_customRead.empty()) ||
+        (!m_customWrite.empty()) ||
+        hasCustomReadRefresh()) {
+        return false;
+    }
+
+    auto len = minLength();
+    if ((len == 0U) || (len != maxLength())) {
+        return false;
+    }
+
+    return isFixedLayoutImpl();
+}
+
 std::string Field::getReadForFields(
     const FieldsList& fields,
     bool forMessage,
@@ -726,6 +751,117 @@ std::string Field::getPrivateRefreshForFields(const Field::FieldsList& fields)
     return common::listToString(funcs, "\n", common::emptyString());
 }
 
+bool Field::isFixedLayoutForFields(const FieldsList& fields)
+{
+    if (fields.empty()) {
+        return false;
+    }
+
+    return
+        std::all_of(
+            fields.begin(), fields.end(),
+            [](auto& f)
+            {
+                assert(f);
+                return f->isFixedLayout();
+            });
+}
+
+std::string Field::getFixedLayoutForFields(
+    const FieldsList& fields,
+    bool forMessage,
+    bool updateVersion)
+{
+    assert(isFixedLayoutForFields(fields));
+
+    common::StringsList offsets;
+    common::StringsList reads;
+    common::StringsList writes;
+    common::StringsList peeks;
+    std::size_t offset = 0U;
+    for (auto& f : fields) {
+        auto accessName = common::nameToAccessCopy(f->name());
+
+        static const std::string OffsetTempl =
+            "/// @brief Offset of the @ref Field_#^#NAME#$# field in the serialised data.\n"
+            "static const std::size_t FieldOffset_#^#NAME#$# = #^#OFFSET#$#;\n";
+
+        static const std::string PeekTempl =
+            "/// @brief Read the @ref Field_#^#NAME#$# field directly from the undecoded buffer.\n"
+            "/// @details The buffer is expected to contain at least @ref FixedLength bytes.\n"
+            "template <typename TIter>\n"
+            "static Field_#^#NAME#$# peekField_#^#NAME#$#(TIter iter)\n"
+            "{\n"
+            "    std::advance(iter, FieldOffset_#^#NAME#$#);\n"
+            "    Field_#^#NAME#$# field;\n"
+            "    field.readNoStatus(iter);\n"
+            "    return field;\n"
+            "}\n";
+
+        common::ReplacementMap replacements;
+        replacements.insert(std::make_pair("NAME", accessName));
+        replacements.insert(std::make_pair("OFFSET", common::numToString(offset)));
+        offsets.push_back(common::processTemplate(OffsetTempl, replacements));
+        peeks.push_back(common::processTemplate(PeekTempl, replacements));
+        reads.push_back("field_" + accessName + "().readNoStatus(iter);");
+        writes.push_back("field_" + accessName + "().writeNoStatus(iter);");
+        offset += f->minLength();
+    }
+
+    std::string readFunc("read");
+    std::string writeFunc("write");
+    if (forMessage) {
+        readFunc = "doRead";
+        writeFunc = "doWrite";
+    }
+
+    static const std::string Templ =
+        "/// @brief Serialisation length of the fixed layout.\n"
+        "static const std::size_t FixedLength = #^#LENGTH#$#;\n\n"
+        "#^#OFFSETS#$#\n"
+        "/// @brief Read functionality optimised for the fixed layout.\n"
+        "/// @details Checks the available length once and then reads\n"
+        "///     all the fields without any further checks.\n"
+        "template <typename TIter>\n"
+        "comms::ErrorStatus #^#READ_FUNC#$#(TIter& iter, std::size_t len)\n"
+        "{\n"
+        "    if (len < FixedLength) {\n"
+        "        return comms::ErrorStatus::NotEnoughData;\n"
+        "    }\n\n"
+        "    #^#UPDATE_VERSION#$#\n"
+        "    #^#READS#$#\n"
+        "    return comms::ErrorStatus::Success;\n"
+        "}\n\n"
+        "/// @brief Write functionality optimised for the fixed layout.\n"
+        "/// @details Checks the available space once and then writes\n"
+        "///     all the fields without any further checks.\n"
+        "template <typename TIter>\n"
+        "comms::ErrorStatus #^#WRITE_FUNC#$#(TIter& iter, std::size_t len) const\n"
+        "{\n"
+        "    if (len < FixedLength) {\n"
+        "        return comms::ErrorStatus::BufferOverflow;\n"
+        "    }\n\n"
+        "    #^#WRITES#$#\n"
+        "    return comms::ErrorStatus::Success;\n"
+        "}\n\n"
+        "#^#PEEKS#$#\n";
+
+    common::ReplacementMap replacements;
+    replacements.insert(std::make_pair("LENGTH", common::numToString(offset)));
+    replacements.insert(std::make_pair("OFFSETS", common::listToString(offsets, "\n", common::emptyString())));
+    replacements.insert(std::make_pair("READ_FUNC", std::move(readFunc)));
+    replacements.insert(std::make_pair("WRITE_FUNC", std::move(writeFunc)));
+    replacements.insert(std::make_pair("READS", common::listToString(reads, "\n", common::emptyString())));
+    replacements.insert(std::make_pair("WRITES", common::listToString(writes, "\n", common::emptyString())));
+    replacements.insert(std::make_pair("PEEKS", common::listToString(peeks, "\n", common::emptyString())));
+
+    if (updateVersion) {
+        assert(forMessage);
+        replacements.insert(std::make_pair("UPDATE_VERSION", "Base::doFieldsVersionUpdate();\n"));
+    }
+    return common::processTemplate(Templ, replacements);
+}
+
 std::string Field::getPluginCreatePropsFunc(
     const std::string& scope,
     bool forcedSerialisedHidden,
@@ -1050,6 +1186,11 @@ bool Field::isVersionDependentImpl() const
     return false;
 }
 
+bool Field::isFixedLayoutImpl() const
+{
+    return false;
+}
+
 std::string Field::getCommonDefinitionImpl(const std::string& fullScope) const
 {
     static_cast<void>(fullScope);
@@ -1319,13 +1460,10 @@ bool Field::writeProtocolDefinitionCommonFile() const
 
     std::string str = common::processTemplate(FileTemplate, replacements);
 
-    std::ofstream stream(filePath);
-    if (!stream) {
-        m_generator.logger().error("Failed to open \"" + filePath + "\" for writing.");
-        return false;
-    }
+    OutputFile stream(m_generator, filePath);
     stream << str;
 
+    stream.flush();
     if (!stream.good()) {
         m_generator.logger().error("Failed to write \"" + filePath + "\".");
         return false;
@@ -1380,13 +1518,10 @@ bool Field::writeProtocolDefinitionFile() const
 
     std::string str = common::processTemplate(FileTemplate, replacements);
 
-    std::ofstream stream(filePath);
-    if (!stream) {
-        m_generator.logger().error("Failed to open \"" + filePath + "\" for writing.");
-        return false;
-    }
+    OutputFile stream(m_generator, filePath);
     stream << str;
 
+    stream.flush();
     if (!stream.good()) {
         m_generator.logger().error("Failed to write \"" + filePath + "\".");
         return false;
@@ -1424,13 +1559,10 @@ bool Field::writePluginHeaderFile() const
     replacements.insert(std::make_pair("NAME", common::nameToAccessCopy(className)));
     auto str = common::processTemplate(Templ, replacements);
 
-    std::ofstream stream(filePath);
-    if (!stream) {
-        m_generator.logger().error("Failed to open \"" + filePath + "\" for writing.");
-        return false;
-    }
+    OutputFile stream(m_generator, filePath);
     stream << str;
 
+    stream.flush();
     if (!stream.good()) {
         m_generator.logger().error("Failed to write \"" + filePath + "\".");
         return false;
@@ -1479,13 +1611,10 @@ bool Field::writePluginScrFile() const
 
     auto str = common::processTemplate(Templ, replacements);
 
-    std::ofstream stream(filePath);
-    if (!stream) {
-        m_generator.logger().error("Failed to open \"" + filePath + "\" for writing.");
-        return false;
-    }
+    OutputFile stream(m_generator, filePath);
     stream << str;
 
+    stream.flush();
     if (!stream.good()) {
         m_generator.logger().error("Failed to write \"" + filePath + "\".");
         return false;
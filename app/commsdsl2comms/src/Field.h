@@ -153,6 +153,7 @@ public:
     }
 
     bool isPseudo() const;
+    bool isFixedLayout() const;
 
     static std::string getReadForFields(
         const FieldsList& fields,
@@ -162,6 +163,11 @@ public:
         const FieldsList& fields, 
         bool forMessage = false);
     static std::string getPrivateRefreshForFields(const FieldsList& fields);
+    static bool isFixedLayoutForFields(const FieldsList& fields);
+    static std::string getFixedLayoutForFields(
+        const FieldsList& fields,
+        bool forMessage = false,
+        bool updateVersion = false);
 
     std::string getPrivateRefreshBody(const FieldsList& fields) const
     {
@@ -219,6 +225,11 @@ protected:
         return m_memberChild;
     }
 
+    bool isFailOnInvalid() const
+    {
+        return m_focedFailOnInvalid || m_dslObj.isFailOnInvalid();
+    }
+
     virtual bool prepareImpl();
     virtual void updateIncludesImpl(IncludesList& includes) const;
     virtual void updateIncludesCommonImpl(IncludesList& includes) const;
@@ -258,6 +269,7 @@ protected:
     virtual void setForcedPseudoImpl();
     virtual void setForcedNoOptionsConfigImpl();
     virtual bool isVersionDependentImpl() const;
+    virtual bool isFixedLayoutImpl() const;
     virtual std::string getCommonDefinitionImpl(const std::string& fullScope) const;
     virtual std::string getExtraRefToCommonDefinitionImpl(const std::string& fullScope) const;
     virtual bool verifyAliasImpl(const std::string& fieldName) const;
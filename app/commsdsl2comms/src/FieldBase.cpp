@@ -15,11 +15,10 @@
 
 #include "FieldBase.h"
 
-#include <fstream>
-
 #include <boost/filesystem.hpp>
 
 #include "Generator.h"
+#include "OutputFile.h"
 #include "common.h"
 
 namespace bf = boost::filesystem;
@@ -68,11 +67,7 @@ bool FieldBase::writeDefinition() const
         return true;
     }
 
-    std::ofstream stream(filePath);
-    if (!stream) {
-        m_generator.logger().error("Failed to open \"" + filePath + "\" for writing.");
-        return false;
-    }
+    OutputFile stream(m_generator, filePath);
 
     common::StringsList options;
     options.push_back(common::dslEndianToOpt(m_generator.schemaEndian()));
@@ -0,0 +1,59 @@
+//
+// Copyright 2018 - 2020 (C). Alex Robenko. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "FilesystemOutputSink.h"
+
+#include <fstream>
+
+#include <boost/filesystem.hpp>
+
+#include "Logger.h"
+
+namespace bf = boost::filesystem;
+
+namespace commsdsl2comms
+{
+
+bool FilesystemOutputSink::createDirImpl(const std::string& path)
+{
+    boost::system::error_code ec;
+    bf::create_directories(path, ec);
+    if (ec) {
+        m_logger.error("Failed to create directory \"" + path + "\" with reason: " + ec.message());
+        return false;
+    }
+
+    return true;
+}
+
+bool FilesystemOutputSink::writeImpl(const std::string& path, const std::string& contents)
+{
+    std::ofstream stream(path);
+    if (!stream) {
+        m_logger.error("Failed to open \"" + path + "\" for writing.");
+        return false;
+    }
+
+    stream << contents;
+    stream.flush();
+    if (!stream.good()) {
+        m_logger.error("Failed to write \"" + path + "\".");
+        return false;
+    }
+
+    return true;
+}
+
+} // namespace commsdsl2comms
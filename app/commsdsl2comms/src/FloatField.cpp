@@ -584,6 +584,11 @@ std::string FloatField::getCommonDefinitionImpl(const std::string& fullScope) co
     return common::processTemplate(Templ, repl);
 }
 
+bool FloatField::isFixedLayoutImpl() const
+{
+    return true;
+}
+
 std::string FloatField::getFieldBaseParams() const
 {
     auto obj = floatFieldDslObj();
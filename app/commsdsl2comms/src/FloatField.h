@@ -38,6 +38,7 @@ protected:
         const std::string& className) const override final;
     virtual std::string getPluginPropertiesImpl(bool serHiddenParam) const override final;
     virtual std::string getCommonDefinitionImpl(const std::string& fullScope) const override final;
+    virtual bool isFixedLayoutImpl() const override final;
 
 private:
     using StringsList = common::StringsList;
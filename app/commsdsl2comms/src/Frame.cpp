@@ -16,15 +16,16 @@
 #include "Frame.h"
 
 #include <cassert>
-#include <fstream>
 #include <map>
 #include <algorithm>
 #include <iterator>
 #include <numeric>
+#include <limits>
 
 #include <boost/algorithm/string.hpp>
 
 #include "Generator.h"
+#include "OutputFile.h"
 #include "common.h"
 #include "ChecksumLayer.h"
 #include "CustomLayer.h"
@@ -81,6 +82,8 @@ const std::string Template(
     "    COMMS_PROTOCOL_LAYERS_ACCESS(\n"
     "        #^#LAYERS_ACCESS_LIST#$#\n"
     "    );\n"
+    "    #^#WRITE_SINGLE_PASS#$#\n"
+    "    #^#VARIANT_READ#$#\n"
     "};\n\n"
     "#^#END_NAMESPACE#$#\n"
     "#^#APPEND#$#\n"
@@ -139,11 +142,18 @@ bool Frame::prepare()
 bool Frame::write()
 {
     return
-        writeProtocolDefinitionCommonFile() &&
-        writeProtocol() &&
-        writePluginTransportMessageHeader() &&
-        writePluginTransportMessageSrc() &&
-        writePluginHeader();
+        m_generator.writeCachedFrame(
+            m_externalRef,
+            m_dslObj.definitionDigest(),
+            [this]()
+            {
+                return
+                    writeProtocolDefinitionCommonFile() &&
+                    writeProtocol() &&
+                    writePluginTransportMessageHeader() &&
+                    writePluginTransportMessageSrc() &&
+                    writePluginHeader();
+            });
 }
 
 std::string Frame::getDefaultOptions() const
@@ -184,10 +194,7 @@ bool Frame::writeProtocolDefinitionCommonFile()
         }
     }
 
-    if (commonElems.empty()) {
-        return true;
-    }
-
+    common::mergeIncludes(common::lengthBoundsIncludes(), includes);
 
     auto adjName = m_externalRef + common::commonSuffixStr();
     auto names = m_generator.startFrameProtocolWrite(adjName);
@@ -203,40 +210,119 @@ bool Frame::writeProtocolDefinitionCommonFile()
         "#^#GEN_COMMENT#$#\n"
         "/// @file\n"
         "/// @brief Contains common template parameters independent functionality of\n"
-        "///    fields used in definition of @ref #^#SCOPE#$# frame.\n"
+        "///    @ref #^#SCOPE#$# frame and fields used in its definition.\n"
         "\n"
         "#pragma once\n"
         "\n"
         "#^#INCLUDES#$#\n"
         "#^#BEGIN_NAMESPACE#$#\n"
-        "/// @brief Common types and functions of fields using in definition of\n"
+        "#^#LAYERS_COMMON#$#\n"
+        "/// @brief Common types and functions of\n"
         "///     @ref #^#SCOPE#$# frame.\n"
-        "/// @see #^#SCOPE#$#Layers\n"
-        "struct #^#NAME#$#LayersCommon\n"
+        "#^#UNLIMITED_DOC#$#\n"
+        "/// @see #^#SCOPE#$#\n"
+        "struct #^#NAME#$#Common\n"
         "{\n"
-        "    #^#BODY#$#\n"
-        "};\n"
+        "    #^#LENGTH_FUNCS#$#\n"
+        "};\n\n"
         "#^#END_NAMESPACE#$#\n";
 
-    auto namespaces = m_generator.namespacesForFrame(m_externalRef);
     common::ReplacementMap repl;
-    repl.insert(std::make_pair("GEN_COMMENT", m_generator.fileGeneratedComment()));
     repl.insert(std::make_pair("SCOPE", frameScope));
     repl.insert(std::make_pair("NAME", common::nameToClassCopy(name())));
-    repl.insert(std::make_pair("BODY", common::listToString(commonElems, "\n", common::emptyString())));
+
+    if (!commonElems.empty()) {
+        static const std::string LayersTempl =
+            "/// @brief Common types and functions of fields using in definition of\n"
+            "///     @ref #^#SCOPE#$# frame.\n"
+            "/// @see #^#SCOPE#$#Layers\n"
+            "struct #^#NAME#$#LayersCommon\n"
+            "{\n"
+            "    #^#BODY#$#\n"
+            "};\n";
+
+        repl.insert(std::make_pair("BODY", common::listToString(commonElems, "\n", common::emptyString())));
+        repl.insert(std::make_pair("LAYERS_COMMON", common::processTemplate(LayersTempl, repl)));
+    }
+
+    static const std::size_t MaxLen = std::numeric_limits<std::size_t>::max();
+    auto addLengthFunc =
+        [](std::size_t soFar, std::size_t len)
+        {
+            if ((MaxLen - soFar) <= len) {
+                return MaxLen;
+            }
+
+            return soFar + len;
+        };
+
+    // Same as in calcBackPayloadOffset(), but for all the layers
+    std::size_t layersMinLength = 0U;
+    std::size_t layersMaxLength = 0U;
+    for (auto& l : m_dslObj.layers()) {
+        if (l.kind() == commsdsl::Layer::Kind::Payload) {
+            continue;
+        }
+
+        if ((l.kind() == commsdsl::Layer::Kind::Value) &&
+            (commsdsl::ValueLayer(l).pseudo())) {
+            continue;
+        }
+
+        assert(l.field().valid());
+        layersMinLength = addLengthFunc(layersMinLength, l.field().minLength());
+        layersMaxLength = addLengthFunc(layersMaxLength, l.field().maxLength());
+    }
+
+    std::size_t msgsMinLength = MaxLen;
+    std::size_t msgsMaxLength = 0U;
+    common::StringsList unlimitedMessages;
+    for (auto* m : m_generator.getAllMessages()) {
+        if (!m->doesExist()) {
+            continue;
+        }
+
+        msgsMinLength = std::min(msgsMinLength, m->minLength());
+        msgsMaxLength = std::max(msgsMaxLength, m->maxLength());
+        if (m->maxLength() == MaxLen) {
+            unlimitedMessages.push_back(m_generator.scopeForMessage(m->externalRef(), true, true));
+        }
+    }
+
+    if (msgsMaxLength == 0U) {
+        msgsMinLength = 0U;
+    }
+
+    auto allMessagesScope = m_generator.scopeForInput(common::allMessagesStr(), true, true);
+    auto lengthFuncs =
+        common::lengthBoundsFuncs(
+            layersMinLength, layersMaxLength, "all the layers of the @ref " + frameScope + " frame except payload", "Layers") + '\n' +
+        common::lengthBoundsFuncs(
+            addLengthFunc(layersMinLength, msgsMinLength),
+            addLengthFunc(layersMaxLength, msgsMaxLength),
+            "any message from @ref " + allMessagesScope + " bundle wrapped in the @ref " + frameScope + " frame");
+    repl.insert(std::make_pair("LENGTH_FUNCS", std::move(lengthFuncs)));
+
+    if (!unlimitedMessages.empty()) {
+        static const std::string UnlimitedPrefix("///     @li @ref ");
+        auto unlimitedDoc =
+            "/// @details Maximal serialisation length is unlimited due to the following messages:\n" +
+            UnlimitedPrefix + common::listToString(unlimitedMessages, "\n" + UnlimitedPrefix, common::emptyString());
+        repl.insert(std::make_pair("UNLIMITED_DOC", std::move(unlimitedDoc)));
+    }
+
+    auto namespaces = m_generator.namespacesForFrame(m_externalRef);
+    repl.insert(std::make_pair("GEN_COMMENT", m_generator.fileGeneratedComment()));
     repl.insert(std::make_pair("INCLUDES", common::includesToStatements(includes)));
     repl.insert(std::make_pair("BEGIN_NAMESPACE", std::move(namespaces.first)));
     repl.insert(std::make_pair("END_NAMESPACE", std::move(namespaces.second)));
 
     auto str = common::processTemplate(Templ, repl);
 
-    std::ofstream stream(filePath);
-    if (!stream) {
-        m_generator.logger().error("Failed to open \"" + filePath + "\" for writing.");
-        return false;
-    }
+    OutputFile stream(m_generator, filePath);
     stream << str;
 
+    stream.flush();
     if (!stream.good()) {
         m_generator.logger().error("Failed to write \"" + filePath + "\".");
         return false;
@@ -271,6 +357,8 @@ bool Frame::writeProtocol()
     replacements.insert(std::make_pair("ACCESS_FUNCS_DOC", getLayersAccessDoc()));
     replacements.insert(std::make_pair("INPUT_MESSAGES", getInputMessages()));
     replacements.insert(std::make_pair("INPUT_MESSAGES_DOC", getInputMessagesDoc()));
+    replacements.insert(std::make_pair("WRITE_SINGLE_PASS", getWriteSinglePass()));
+    replacements.insert(std::make_pair("VARIANT_READ", getVariantRead()));
     replacements.insert(std::make_pair("APPEND", m_generator.getExtraAppendForFrame(m_externalRef)));
     replacements.insert(std::make_pair("OPTIONS", m_generator.scopeForOptions(common::defaultOptionsStr(), true, true)));
 
@@ -280,13 +368,10 @@ bool Frame::writeProtocol()
 
     auto str = common::processTemplate(Template, replacements);
 
-    std::ofstream stream(filePath);
-    if (!stream) {
-        m_generator.logger().error("Failed to open \"" + filePath + "\" for writing.");
-        return false;
-    }
+    OutputFile stream(m_generator, filePath);
     stream << str;
 
+    stream.flush();
     if (!stream.good()) {
         m_generator.logger().error("Failed to write \"" + filePath + "\".");
         return false;
@@ -417,13 +502,10 @@ bool Frame::writePluginTransportMessageHeader()
 
     std::string str = common::processTemplate(Templ, replacements);
 
-    std::ofstream stream(filePath);
-    if (!stream) {
-        m_generator.logger().error("Failed to open \"" + filePath + "\" for writing.");
-        return false;
-    }
+    OutputFile stream(m_generator, filePath);
     stream << str;
 
+    stream.flush();
     if (!stream.good()) {
         m_generator.logger().error("Failed to write \"" + filePath + "\".");
         return false;
@@ -452,6 +534,8 @@ bool Frame::writePluginTransportMessageSrc()
         "#^#BEGIN_NAMESPACE#$#\n"
         "namespace\n"
         "{\n\n"
+        "namespace #^#CLASS_NAME#$#Props\n"
+        "{\n\n"
         "#^#FIELDS_PROPS#$#\n"
         "QVariantList createProps()\n"
         "{\n"
@@ -459,10 +543,11 @@ bool Frame::writePluginTransportMessageSrc()
         "     #^#APPENDS#$#\n"
         "     return props;\n"
         "}\n\n"
+        "} // namespace #^#CLASS_NAME#$#Props\n\n"
         "} // namespace\n\n"
         "const QVariantList& #^#CLASS_NAME#$##^#PROPS_FUNC_DECL#$#\n"
         "{\n"
-        "    static const QVariantList Props = createProps();\n"
+        "    static const QVariantList Props = #^#CLASS_NAME#$#Props::createProps();\n"
         "    return Props;\n"
         "}\n\n"
         "#^#READ_FUNC#$#\n"
@@ -593,13 +678,10 @@ bool Frame::writePluginTransportMessageSrc()
 
     std::string str = common::processTemplate(Templ, replacements);
 
-    std::ofstream stream(filePath);
-    if (!stream) {
-        m_generator.logger().error("Failed to open \"" + filePath + "\" for writing.");
-        return false;
-    }
+    OutputFile stream(m_generator, filePath);
     stream << str;
 
+    stream.flush();
     if (!stream.good()) {
         m_generator.logger().error("Failed to write \"" + filePath + "\".");
         return false;
@@ -669,13 +751,10 @@ bool Frame::writePluginHeader()
 
     std::string str = common::processTemplate(Templ, replacements);
 
-    std::ofstream stream(filePath);
-    if (!stream) {
-        m_generator.logger().error("Failed to open \"" + filePath + "\" for writing.");
-        return false;
-    }
+    OutputFile stream(m_generator, filePath);
     stream << str;
 
+    stream.flush();
     if (!stream.good()) {
         m_generator.logger().error("Failed to write \"" + filePath + "\".");
         return false;
@@ -707,6 +786,15 @@ std::string Frame::getIncludes() const
         l->updateIncludes(includes);
     }
 
+    common::mergeInclude("<algorithm>", includes);
+    common::mergeInclude("<cstddef>", includes);
+    common::mergeInclude("<iterator>", includes);
+    common::mergeInclude("<limits>", includes);
+
+    if (hasVariantRead()) {
+        common::mergeInclude(m_generator.headerfileForDispatch("VariantMessage", false), includes);
+    }
+
     if (hasCommonDefinition()) {
         auto refStr = m_externalRef + common::commonSuffixStr();
         common::mergeInclude(m_generator.headerfileForFrame(refStr, false), includes);
@@ -822,6 +910,133 @@ std::string Frame::getInputMessagesDoc() const
     return "/// @tparam TAllMessages All supported input messages.";
 }
 
+std::string Frame::getWriteSinglePass() const
+{
+    static const std::string Templ =
+        "\n"
+        "/// @brief Write the message in a single pass.\n"
+        "/// @details The message payload is serialised only once, there is no\n"
+        "///     need to calculate the frame length in advance. The values of the\n"
+        "///     layers depending on the payload (size, checksum) are written after\n"
+        "///     the payload. When the output buffer is too small, its size is\n"
+        "///     doubled and the write is repeated. When the values cannot be\n"
+        "///     written after the payload using the write iterator\n"
+        "///     (@b comms::ErrorStatus::UpdateRequired is reported), the written\n"
+        "///     data is updated using update().\n"
+        "/// @param[in] msg Message object to write.\n"
+        "/// @param[in, out] buf Output buffer, expected to be a contiguous\n"
+        "///     container (such as @b std::vector), reused between the writes\n"
+        "///     to avoid the reallocation.\n"
+        "/// @param[out] len Number of written bytes.\n"
+        "/// @param[in] maxLen Maximal size of the output buffer.\n"
+        "/// @return Status of the write operation.\n"
+        "template <typename TMsg, typename TBuf>\n"
+        "comms::ErrorStatus writeSinglePass(\n"
+        "    const TMsg& msg,\n"
+        "    TBuf& buf,\n"
+        "    std::size_t& len,\n"
+        "    std::size_t maxLen = std::numeric_limits<std::size_t>::max())\n"
+        "{\n"
+        "    len = 0U;\n"
+        "    if (buf.empty()) {\n"
+        "        buf.resize(std::min(std::size_t(1024U), maxLen));\n"
+        "    }\n\n"
+        "    while (true) {\n"
+        "        auto writeIter = buf.data();\n"
+        "        auto es = Base::write(msg, writeIter, buf.size());\n"
+        "        if ((es == comms::ErrorStatus::BufferOverflow) && (buf.size() < maxLen)) {\n"
+        "            buf.resize(std::min(buf.size() * 2U, maxLen));\n"
+        "            continue;\n"
+        "        }\n\n"
+        "        auto writtenLen = static_cast<std::size_t>(std::distance(buf.data(), writeIter));\n"
+        "        if (es == comms::ErrorStatus::UpdateRequired) {\n"
+        "            auto updateIter = buf.data();\n"
+        "            es = Base::update(updateIter, writtenLen);\n"
+        "        }\n\n"
+        "        if (es == comms::ErrorStatus::Success) {\n"
+        "            len = writtenLen;\n"
+        "        }\n\n"
+        "        return es;\n"
+        "    }\n"
+        "}";
+
+    return Templ;
+}
+
+std::string Frame::getVariantRead() const
+{
+    if (!hasVariantRead()) {
+        return common::emptyString();
+    }
+
+    static const std::string Templ =
+        "\n"
+        "#if __cplusplus >= 201703L || (defined(_MSVC_LANG) && _MSVC_LANG >= 201703L)\n"
+        "/// @brief Read message into the variant object.\n"
+        "/// @details Reads the message ID and then constructs the message in place\n"
+        "///     inside the variant object using @ref #^#READ_FUNC#$#(),\n"
+        "///     followed by non-polymorphic read of its contents. No dynamic memory\n"
+        "///     allocation is involved. Messages with the same ID are tried in\n"
+        "///     order of their index. All the input messages are recognised\n"
+        "///     regardless of the @b TAllMessages template parameter.\n"
+        "///     Requires C++17.\n"
+        "/// @param[out] msg Variant object to construct the message in.\n"
+        "/// @param[in, out] iter Iterator used for reading, expected to be\n"
+        "///     at least forward one.\n"
+        "/// @param[in] len Number of remaining bytes in the input buffer.\n"
+        "/// @return Status of the ID or message read.\n"
+        "template <typename TIter>\n"
+        "comms::ErrorStatus readVariant(\n"
+        "    #^#VARIANT#$#<TMessage, TOpt>& msg,\n"
+        "    TIter& iter,\n"
+        "    std::size_t len)\n"
+        "{\n"
+        "    typename Base::Field field;\n"
+        "    auto payloadIter = iter;\n"
+        "    auto es = field.read(payloadIter, len);\n"
+        "    if (es != comms::ErrorStatus::Success) {\n"
+        "        return es;\n"
+        "    }\n\n"
+        "    auto id = static_cast<#^#MSG_ID#$#>(field.value());\n"
+        "    auto payloadLen = len - static_cast<std::size_t>(std::distance(iter, payloadIter));\n"
+        "    es = comms::ErrorStatus::InvalidMsgId;\n"
+        "    for (std::size_t idx = 0U; ; ++idx) {\n"
+        "        auto readIter = payloadIter;\n"
+        "        auto readEs = #^#READ_FUNC#$#<TMessage, TOpt>(id, idx, msg, readIter, payloadLen);\n"
+        "        if (readEs == comms::ErrorStatus::InvalidMsgId) {\n"
+        "            break;\n"
+        "        }\n\n"
+        "        es = readEs;\n"
+        "        if (es == comms::ErrorStatus::Success) {\n"
+        "            iter = readIter;\n"
+        "            break;\n"
+        "        }\n\n"
+        "        if (es == comms::ErrorStatus::NotEnoughData) {\n"
+        "            break;\n"
+        "        }\n"
+        "    }\n\n"
+        "    return es;\n"
+        "}\n"
+        "#endif // #if __cplusplus >= 201703L || (defined(_MSVC_LANG) && _MSVC_LANG >= 201703L)";
+
+    common::ReplacementMap repl;
+    repl.insert(std::make_pair("VARIANT", m_generator.scopeForDispatch("MsgVariant", true, true)));
+    repl.insert(std::make_pair("READ_FUNC", m_generator.scopeForDispatch(common::emptyString(), true, false) + "readVariantMessage"));
+    repl.insert(std::make_pair("MSG_ID", m_generator.scopeForRoot(common::msgIdEnumNameStr(), true, true)));
+    return common::processTemplate(Templ, repl);
+}
+
+bool Frame::hasVariantRead() const
+{
+    // Only when the message ID is the first layer followed by the payload,
+    // other layers don't support reading into the variant object.
+    return
+        m_generator.variantDispatchRequested() &&
+        (2U <= m_layers.size()) &&
+        (m_layers[0]->kind() == commsdsl::Layer::Kind::Id) &&
+        (m_layers[1]->kind() == commsdsl::Layer::Kind::Payload);
+}
+
 bool Frame::hasIdLayer() const
 {
     return
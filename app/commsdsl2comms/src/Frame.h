@@ -56,6 +56,11 @@ public:
         return m_externalRef;
     }
 
+    const commsdsl::Frame& dslObj() const
+    {
+        return m_dslObj;
+    }
+
     std::vector<std::string> getPseudoVersionLayers(const std::vector<std::string>& interfaceVersionFields) const;
 
 private:
@@ -76,6 +81,9 @@ private:
     std::string getInputMessages() const;
     std::string getInputMessagesDoc() const;
 
+    std::string getWriteSinglePass() const;
+    std::string getVariantRead() const;
+    bool hasVariantRead() const;
     bool hasIdLayer() const;
     unsigned calcBackPayloadOffset() const;
     std::string getOptions(GetLayerOptionsFunc func) const;
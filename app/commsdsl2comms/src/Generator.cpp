@@ -16,6 +16,7 @@
 #include "Generator.h"
 
 #include <fstream>
+#include <iostream>
 #include <iterator>
 #include <algorithm>
 #include <cctype>
@@ -36,6 +37,8 @@
 #include "Version.h"
 #include "Test.h"
 #include "Dispatch.h"
+#include "Instantiation.h"
+#include "MsgFactory.h"
 #include "License.h"
 
 namespace bf = boost::filesystem;
@@ -128,6 +131,73 @@ std::vector<std::string> splitRefPath(const std::string& ref)
     return tokens;
 }
 
+// Positions of the XML declarations starting the documents, the ones
+// inside comments and CDATA sections are ignored. The declaration may be
+// preceded by the BOM, which is included in the document, and may follow
+// a new line or the closing '>' of the previous document.
+std::vector<std::size_t> xmlDeclPositions(const std::string& contents)
+{
+    static const std::string XmlDeclStr("<?xml");
+    static const std::string CommentBegStr("<!--");
+    static const std::string CommentEndStr("-->");
+    static const std::string CdataBegStr("<![CDATA[");
+    static const std::string CdataEndStr("]]>");
+    static const std::string BomStr("\xEF\xBB\xBF");
+
+    auto startsWithFunc =
+        [&contents](std::size_t pos, const std::string& str)
+        {
+            return contents.compare(pos, str.size(), str) == 0;
+        };
+
+    std::vector<std::size_t> result;
+    auto pos = contents.find('<');
+    while (pos != std::string::npos) {
+        if (startsWithFunc(pos, CommentBegStr)) {
+            pos = contents.find(CommentEndStr, pos + CommentBegStr.size());
+            if (pos == std::string::npos) {
+                break;
+            }
+
+            pos = contents.find('<', pos + CommentEndStr.size());
+            continue;
+        }
+
+        if (startsWithFunc(pos, CdataBegStr)) {
+            pos = contents.find(CdataEndStr, pos + CdataBegStr.size());
+            if (pos == std::string::npos) {
+                break;
+            }
+
+            pos = contents.find('<', pos + CdataEndStr.size());
+            continue;
+        }
+
+        auto docPos = pos;
+        if ((BomStr.size() <= docPos) && startsWithFunc(docPos - BomStr.size(), BomStr)) {
+            docPos -= BomStr.size();
+        }
+
+        bool docStart =
+            (docPos == 0U) ||
+            (contents[docPos - 1U] == '\n') ||
+            (contents[docPos - 1U] == '\r') ||
+            (contents[docPos - 1U] == '>');
+
+        auto nextPos = pos + XmlDeclStr.size();
+        if (docStart &&
+            startsWithFunc(pos, XmlDeclStr) &&
+            (nextPos < contents.size()) &&
+            (std::isspace(static_cast<unsigned char>(contents[nextPos])) != 0)) {
+            result.push_back(docPos);
+        }
+
+        pos = contents.find('<', pos + 1U);
+    }
+
+    return result;
+}
+
 } // namespace
 
 bool Generator::generate(const FilesList& files)
@@ -138,11 +208,34 @@ bool Generator::generate(const FilesList& files)
             m_logger.log(level, msg);
         });
 
-    return
+    bool result =
         parseOptions() &&
         parseSchemaFiles(files) &&
         prepare() &&
-        writeFiles();
+        reportPerformance() &&
+        prepareRenderCache() &&
+        writeFiles() &&
+        (!m_outputFailed);
+
+    if (result && m_renderCache) {
+        m_renderCache->evictUnused();
+    }
+
+    return result;
+}
+
+bool Generator::writeOutput(const std::string& path, const std::string& contents)
+{
+    if (m_renderCache) {
+        m_renderCache->recordWrittenFile(path, contents);
+    }
+
+    if (!m_outputSink->write(path, contents)) {
+        m_outputFailed = true;
+        return false;
+    }
+
+    return true;
 }
 
 bool Generator::doesElementExist(
@@ -213,6 +306,134 @@ std::vector<std::string> Generator::bundlesForMessage(const std::string& externa
     return result;
 }
 
+Generator::PlatformsMessagesMap Generator::getPlatformsMessages()
+{
+    PlatformsMessagesMap platformsMap;
+    platformsMap.insert(std::make_pair(std::string(), PlatformMessages()));
+
+    for (auto& p : platforms()) {
+        platformsMap.insert(std::make_pair(p, PlatformMessages()));
+    };
+
+    for (auto& b : extraMessagesBundles()) {
+        auto& elem = platformsMap[b];
+        elem.m_realPlatform = false;
+    }
+
+    auto allMessages = getAllDslMessages();
+    for (auto& p : platformsMap) {
+        auto& inputPrefix = p.first;
+        if (inputPrefix.empty()) {
+            p.second.m_all.m_inputName = common::allMessagesStr();
+        }
+        else {
+            p.second.m_all.m_inputName = inputPrefix + "Messages";
+        }
+
+        p.second.m_serverInput.m_inputName = inputPrefix + common::serverInputMessagesStr();
+        p.second.m_clientInput.m_inputName = inputPrefix + common::clientInputMessagesStr();
+
+        for (auto* info : {&p.second.m_all, &p.second.m_serverInput, &p.second.m_clientInput}) {
+            info->m_messages.reserve(allMessages.size());
+        }
+    }
+
+    for (auto& m : allMessages) {
+        assert(m.valid());
+
+        if (!doesElementExist(m.sinceVersion(), m.deprecatedSince(), m.isDeprecatedRemoved())) {
+            continue;
+        }
+
+        auto extRef = m.externalRef();
+        assert(!extRef.empty());
+
+        bool serverInput = m.sender() != commsdsl::Message::Sender::Server;
+        bool clientInput = m.sender() != commsdsl::Message::Sender::Client;
+
+        auto addToPlatformFunc =
+            [&m, serverInput, clientInput](PlatformMessages& info)
+            {
+                info.m_all.m_messages.push_back(m);
+                if (serverInput) {
+                    info.m_serverInput.m_messages.push_back(m);
+                }
+
+                if (clientInput) {
+                    info.m_clientInput.m_messages.push_back(m);
+                }
+            };
+
+        addToPlatformFunc(platformsMap[common::emptyString()]);
+
+        if (platformsMap.size() == 1U) {
+            continue;
+        }
+
+        auto& msgPlatforms = m.platforms();
+        if (msgPlatforms.empty()) {
+            for (auto& p : platformsMap) {
+                if (p.first.empty() || (!p.second.m_realPlatform)) {
+                    continue;
+                }
+                addToPlatformFunc(p.second);
+            }
+        }
+
+        for (auto& p : msgPlatforms) {
+            auto iter = platformsMap.find(p);
+            if (iter == platformsMap.end()) {
+                assert(!"Should not happen");
+                continue;
+            }
+
+            addToPlatformFunc(iter->second);
+        }
+
+        for (auto& b : bundlesForMessage(extRef)) {
+            auto iter = platformsMap.find(b);
+            if (iter == platformsMap.end()) {
+                assert(!"Should not happen");
+                continue;
+            }
+            addToPlatformFunc(iter->second);
+        }
+    }
+
+    return platformsMap;
+}
+
+std::string Generator::messageIdStr(std::uintmax_t value)
+{
+    auto numValueFunc =
+        [this, value]()
+        {
+            return
+                "static_cast<" +
+                scopeForRoot(common::msgIdEnumNameStr(), true, true) +
+                ">(" +
+                common::numToString(value) +
+                ")";
+        };
+
+    auto* idField = getMessageIdField();
+    if (idField == nullptr) {
+        return numValueFunc();
+    }
+
+    if (idField->kind() != commsdsl::Field::Kind::Enum) {
+        return numValueFunc();
+    }
+
+    auto* castedMsgIdField = static_cast<const EnumField*>(idField);
+    auto valStr = castedMsgIdField->getValueName(static_cast<std::intmax_t>(value));
+    if (valStr.empty()) {
+        return numValueFunc();
+    }
+
+    return scopeForRoot(common::msgIdPrefixStr() + valStr, true, true);
+}
+
 std::string Generator::protocolDefRootDir()
 {
     auto dir = getProtocolDefRootDir();
@@ -393,8 +614,7 @@ std::string Generator::startProtocolPluginCommonWrite(
         auto replaceFile = *iter / relDirPath / (fileName + ReplaceSuffix);
         if (bf::exists(replaceFile, ec)) {
             m_logger.info("Replacing " + fullPathStr + " with " + replaceFile.string());
-            bf::copy_file(replaceFile, bf::path(fullPathStr), bf::copy_option::overwrite_if_exists, ec);
-            if (ec) {
+            if (!copyOutput(replaceFile, fullPathStr)) {
                 m_logger.warning("Failed to write " + fullPathStr);
                 assert(!"Should not happen");
             }
@@ -430,6 +650,28 @@ Generator::startDispatchProtocolWrite(const std::string& name)
     return startProtocolWrite(name, common::dispatchStr());
 }
 
+std::pair<std::string, std::string>
+Generator::startFactoryProtocolWrite(const std::string& name)
+{
+    return startProtocolWrite(name, common::factoryStr());
+}
+
+std::pair<std::string, std::string>
+Generator::startInstantiationProtocolWrite(const std::string& name)
+{
+    return startProtocolWrite(name, common::instantiationStr());
+}
+
+std::string Generator::startInstantiationSrcWrite(const std::string& name)
+{
+    return startGenericWrite(name, common::instantiationStr());
+}
+
+std::string Generator::startCmakeScriptWrite(const std::string& name)
+{
+    return startGenericWrite(name, common::cmakeStr());
+}
+
 std::pair<std::string, std::string>
 Generator::startGenericProtocolWrite(const std::string& name)
 {
@@ -544,6 +786,12 @@ Generator::namespacesForDispatch() const
     return namespacesForElement(common::emptyString(), common::dispatchStr());
 }
 
+std::pair<std::string, std::string>
+Generator::namespacesForFactory() const
+{
+    return namespacesForElement(common::emptyString(), common::factoryStr());
+}
+
 std::pair<std::string, std::string>
 Generator::namespacesForRoot() const
 {
@@ -661,6 +909,16 @@ std::string Generator::headerfileForDispatch(const std::string& name, bool quote
     return headerfileForElement(name, quotes, common::dispatchStr());
 }
 
+std::string Generator::headerfileForFactory(const std::string& name, bool quotes)
+{
+    return headerfileForElement(name, quotes, common::factoryStr());
+}
+
+std::string Generator::headerfileForInstantiation(const std::string& name, bool quotes)
+{
+    return headerfileForElement(name, quotes, common::instantiationStr());
+}
+
 std::string Generator::headerfileForRoot(const std::string& name, bool quotes)
 {
     return headerfileForElement(name, quotes);
@@ -804,6 +1062,14 @@ std::string Generator::scopeForDispatch(
     return scopeForElement(name, mainIncluded, classIncluded, common::dispatchStr());
 }
 
+std::string Generator::scopeForFactory(
+    const std::string& name,
+    bool mainIncluded,
+    bool classIncluded)
+{
+    return scopeForElement(name, mainIncluded, classIncluded, common::factoryStr());
+}
+
 std::string Generator::scopeForRoot(
     const std::string& name,
     bool mainIncluded,
@@ -834,12 +1100,13 @@ std::string Generator::getBareMetalDefaultOptionsBody() const
 
 std::string Generator::getMessageIdStr(const std::string& externalRef, std::uintmax_t id) const
 {
-    if (m_messageIdField == nullptr) {
+    auto* msgIdField = getMessageIdField();
+    if (msgIdField == nullptr) {
         return m_mainNamespace + "::" + common::msgIdPrefixStr() + ba::replace_all_copy(externalRef, ".", "_");
     }
 
-    assert(m_messageIdField->kind() == commsdsl::Field::Kind::Enum);
-    auto* castedEnumField = static_cast<const EnumField*>(m_messageIdField);
+    assert(msgIdField->kind() == commsdsl::Field::Kind::Enum);
+    auto* castedEnumField = static_cast<const EnumField*>(msgIdField);
 
     auto name = castedEnumField->getValueName(static_cast<std::intmax_t>(id));
     if (!name.empty()) {
@@ -851,6 +1118,9 @@ std::string Generator::getMessageIdStr(const std::string& externalRef, std::uint
 
 const Field* Generator::getMessageIdField() const
 {
+    if (m_messageIdField != nullptr) {
+        recordFieldDependency(*m_messageIdField, false);
+    }
     return m_messageIdField;
 }
 
@@ -904,6 +1174,10 @@ const Field* Generator::findField(const std::string& externalRef, bool record)
         m_logger.error("Internal error: unknown external reference: " + externalRef);
         assert(!"Should not happen");
     }
+
+    if (result != nullptr) {
+        recordFieldDependency(*result, record);
+    }
     return result;
 }
 
@@ -958,9 +1232,8 @@ const Frame* Generator::findFrame(const std::string& externalRef)
 
 bool Generator::parseOptions()
 {
-    auto outputDir = m_options.getOutputDirectory();
-    m_pathPrefix = outputDir;
-    if (outputDir.empty()) {
+    m_pathPrefix = m_outputDir;
+    if (m_outputDir.empty()) {
         boost::system::error_code ec;
         m_pathPrefix = bf::current_path(ec);
 
@@ -1020,19 +1293,98 @@ bool Generator::parseCustomization()
     return true;
 }
 
-bool Generator::parseSchemaFiles(const FilesList& files)
+bool Generator::parseSchemaStdin()
 {
-    for (auto& f : files) {
-        m_logger.log(commsdsl::ErrorLevel_Info, "Parsing " + f);
-        if (!m_protocol.parse(f)) {
+    std::string contents(std::istreambuf_iterator<char>(std::cin), (std::istreambuf_iterator<char>()));
+
+    auto docsPos = xmlDeclPositions(contents);
+    if (docsPos.empty()) {
+        docsPos.push_back(0U);
+    }
+
+    bool leadingText =
+        std::any_of(
+            contents.begin(),
+            contents.begin() + static_cast<std::ptrdiff_t>(docsPos.front()),
+            [](char ch)
+            {
+                return std::isspace(static_cast<unsigned char>(ch)) == 0;
+            });
+
+    if (leadingText) {
+        m_logger.error("Unexpected text before the XML declaration in the standard input.");
+        return false;
+    }
+
+    static const std::string StdinStr("stdin");
+    for (auto idx = 0U; idx < docsPos.size(); ++idx) {
+        auto begPos = docsPos[idx];
+        auto endPos = contents.size();
+        if ((idx + 1U) < docsPos.size()) {
+            endPos = docsPos[idx + 1U];
+        }
+
+        auto name = StdinStr;
+        if (1U < docsPos.size()) {
+            name += '#' + std::to_string(idx + 1U);
+        }
+
+        if (!m_protocol.parseBuffer(contents.c_str() + begPos, endPos - begPos, name)) {
             return false;
         }
+    }
+
+    return true;
+}
+
+bool Generator::parseSchemaFiles(const FilesList& files)
+{
+    // Reported before the errors of every document, the warnings
+    // of the previous one stop the parsing.
+    m_protocol.setDocReportCallback(
+        [this](const std::string& input)
+        {
+            if (m_logger.hadWarning()) {
+                m_logger.log(commsdsl::ErrorLevel_Error, "Warning treated as error");
+                return false;
+            }
 
-        if (m_logger.hadWarning()) {
-            m_logger.log(commsdsl::ErrorLevel_Error, "Warning treated as error");
+            m_logger.log(commsdsl::ErrorLevel_Info, "Parsing " + input);
+            return true;
+        });
+
+    static const std::string StdinName("-");
+    auto stdinIter = std::find(files.begin(), files.end(), StdinName);
+    if (stdinIter == files.end()) {
+        if (!m_protocol.parseAll(files)) {
             return false;
         }
     }
+    else {
+        for (auto& f : files) {
+            bool result = false;
+            if (f == StdinName) {
+                result = parseSchemaStdin();
+            }
+            else {
+                result = m_protocol.parse(f);
+            }
+
+            if (!result) {
+                return false;
+            }
+        }
+    }
+
+    if (m_logger.hadWarning()) {
+        m_logger.log(commsdsl::ErrorLevel_Error, "Warning treated as error");
+        return false;
+    }
+
+    m_protocol.setDetachedModelMode();
+    if (!m_renderCacheDir.empty()) {
+        m_protocol.setDefinitionDigestMode();
+    }
 
     if (!m_protocol.validate()) {
         return false;
@@ -1071,6 +1423,22 @@ bool Generator::parseSchemaFiles(const FilesList& files)
 
     m_minRemoteVersion = m_options.getMinRemoteVersion();
 
+    if (m_options.hasFixedVersion()) {
+        if (m_options.hasForcedSchemaVersion() || (m_minRemoteVersion != 0U)) {
+            m_logger.error("Fixed version cannot be used together with forced schema or minimal remote versions.");
+            return false;
+        }
+
+        auto fixedVersion = m_options.getFixedVersion();
+        if (m_schemaVersion < fixedVersion) {
+            m_logger.error("Fixed version cannot be greater than " + common::numToString(m_schemaVersion));
+            return false;
+        }
+
+        m_schemaVersion = fixedVersion;
+        m_minRemoteVersion = fixedVersion;
+    }
+
     return true;
 }
 
@@ -1088,7 +1456,8 @@ bool Generator::prepare()
         m_namespaces.push_back(std::move(ns));
     }
 
-    if (!m_options.versionIndependentCodeRequested()) {
+    if ((!m_options.versionIndependentCodeRequested()) &&
+        (!m_options.hasFixedVersion())) {
         m_versionDependentCode = anyInterfaceHasVersion();
     }
 
@@ -1124,14 +1493,103 @@ bool Generator::prepare()
     return true;
 }
 
+bool Generator::prepareRenderCache()
+{
+    if (m_renderCacheDir.empty()) {
+        return true;
+    }
+
+    m_renderCache.reset(new RenderCache(*this, m_renderCacheDir, m_pathPrefix));
+
+    // Digests of the definitions the elements depend on in addition to
+    // their own ones.
+    m_interfacesDigest = 0U;
+    for (auto* i : getAllInterfaces()) {
+        if (i->dslObj().valid()) {
+            m_interfacesDigest = RenderCache::combineDigests(m_interfacesDigest, i->dslObj().definitionDigest());
+        }
+    }
+
+    m_messagesDigest = 0U;
+    for (auto* m : getAllMessages()) {
+        m_messagesDigest = RenderCache::combineDigests(m_messagesDigest, m->externalRef());
+        m_messagesDigest = RenderCache::combineDigests(m_messagesDigest, static_cast<std::uint64_t>(m->id()));
+        m_messagesDigest = RenderCache::combineDigests(m_messagesDigest, static_cast<std::uint64_t>(m->doesExist()));
+        m_messagesDigest = RenderCache::combineDigests(m_messagesDigest, static_cast<std::uint64_t>(m->dslObj().sender()));
+        m_messagesDigest = RenderCache::combineDigests(m_messagesDigest, static_cast<std::uint64_t>(m->minLength()));
+        m_messagesDigest = RenderCache::combineDigests(m_messagesDigest, static_cast<std::uint64_t>(m->maxLength()));
+        auto& platforms = m->dslObj().platforms();
+        m_messagesDigest = RenderCache::combineDigests(m_messagesDigest, static_cast<std::uint64_t>(platforms.size()));
+        for (auto& p : platforms) {
+            m_messagesDigest = RenderCache::combineDigests(m_messagesDigest, p);
+        }
+    }
+
+    m_msgIdDigest = 0U;
+    if (m_messageIdField != nullptr) {
+        m_msgIdDigest = m_messageIdField->dslObj().definitionDigest();
+    }
+
+    m_framesDigest = 0U;
+    for (auto* f : getAllFrames()) {
+        m_framesDigest = RenderCache::combineDigests(m_framesDigest, f->externalRef());
+        m_framesDigest = RenderCache::combineDigests(m_framesDigest, f->dslObj().definitionDigest());
+    }
+
+    return
+        m_renderCache->prepare(
+            m_protocol.commonDefinitionDigest(),
+            m_options.renderCacheKey(),
+            m_codeInputDirs);
+}
+
+bool Generator::reportPerformance()
+{
+    if (!m_options.perfReportRequested()) {
+        return true;
+    }
+
+    static const std::string SeverityMap[] = {
+        "LOW",
+        "MEDIUM",
+        "HIGH"
+    };
+
+    static const std::size_t SeverityMapSize = std::extent<decltype(SeverityMap)>::value;
+    static_assert(SeverityMapSize == static_cast<std::size_t>(commsdsl::Protocol::PerfHazardSeverity::NumOfValues),
+        "Invalid map");
+
+    auto hazards = m_protocol.analysePerformance();
+    std::cout << "Performance report: " << hazards.size() << " hazard(s) found\n";
+    for (auto& h : hazards) {
+        auto idx = static_cast<std::size_t>(h.m_severity);
+        assert(idx < SeverityMapSize);
+        std::cout <<
+            "[" << SeverityMap[idx] << "] " << h.m_element << ": " << h.m_description << "\n"
+            "    Suggestion: " << h.m_suggestion << "\n";
+    }
+    std::cout << std::flush;
+    return true;
+}
+
 bool Generator::writeFiles()
 {
-    if ((!FieldBase::write(*this)) ||
-        (!MsgId::write(*this)) ||
-        (!Version::write(*this)) ||
-        (!AllMessages::write(*this)) ||
-        (!Dispatch::write(*this))) {
-        return false;
+    using AggregateWriteFunc = bool (*)(Generator&);
+    static const std::pair<std::string, AggregateWriteFunc> Aggregates[] = {
+        std::make_pair(common::fieldBaseStr(), &FieldBase::write),
+        std::make_pair(common::msgIdEnumNameStr(), &MsgId::write),
+        std::make_pair(common::versionStr(), &Version::write),
+        std::make_pair(common::allMessagesStr(), &AllMessages::write),
+        std::make_pair(common::dispatchStr(), &Dispatch::write),
+        std::make_pair(common::factoryStr(), &MsgFactory::write),
+        std::make_pair(common::instantiationStr(), &Instantiation::write),
+    };
+
+    for (auto& a : Aggregates) {
+        auto func = a.second;
+        if (!writeCachedAggregate(a.first, [this, func]() { return func(*this); })) {
+            return false;
+        }
     }
 
     for (auto& ns : m_namespaces) {
@@ -1174,10 +1632,7 @@ bool Generator::createDir(const boost::filesystem::path& path)
         return true;
     }
 
-    boost::system::error_code ec;
-    bf::create_directories(path, ec);
-    if (ec) {
-        m_logger.error("Failed to create directory \"" + path.string() + "\" with reason: " + ec.message());
+    if (!m_outputSink->createDir(path.string())) {
         return false;
     }
 
@@ -1282,35 +1737,21 @@ bool Generator::writeExtraFiles()
                 return false;
             }
 
-            boost::system::error_code ec;
-            bf::copy_file(srcPath, destPath, bf::copy_option::overwrite_if_exists, ec);
-            if (ec) {
-                m_logger.error("Failed to copy with reason: " + ec.message());
+            std::ifstream stream(srcPath.string());
+            if (!stream) {
+                m_logger.error("Failed to open " + srcPath.string() + " for reading.");
                 return false;
             }
 
+            std::string content((std::istreambuf_iterator<char>(stream)), std::istreambuf_iterator<char>());
             if (m_mainNamespace != m_schemaNamespace) {
                 // The namespace has changed
-
-                auto destStr = destPath.string();
-                std::ifstream stream(destStr);
-                if (!stream) {
-                    m_logger.error("Failed to open " + destStr + " for modification.");
-                    return false;
-                }
-
-                std::string content((std::istreambuf_iterator<char>(stream)), std::istreambuf_iterator<char>());
-                stream.close();
-
                 ba::replace_all(content, "namespace " + m_schemaNamespace, "namespace " + m_mainNamespace);
-                std::ofstream outStream(destStr, std::ios_base::trunc);
-                if (!outStream) {
-                    m_logger.error("Failed to modify " + destStr + ".");
-                    return false;
-                }
+                m_logger.info("Updated " + destPath.string() + " to have proper main namespace.");
+            }
 
-                outStream << content;
-                m_logger.info("Updated " + destStr + " to have proper main namespace.");
+            if (!writeOutput(destPath.string(), content)) {
+                return false;
             }
         }
     }
@@ -1727,6 +2168,16 @@ Generator::FramesAccessList Generator::getAllFrames() const
     return result;
 }
 
+Generator::MessagesAccessList Generator::getAllMessages() const
+{
+    MessagesAccessList result;
+    for (auto& n : m_namespaces) {
+        auto nList = n->getAllMessages();
+        result.insert(result.end(), nList.begin(), nList.end());
+    }
+    return result;
+}
+
 const std::string& Generator::getMinCommsVersionStr() const
 {
     return MinCommsVersionStr;
@@ -1937,18 +2388,16 @@ Generator::startProtocolWrite(
         auto replaceFile = *iter / relDirPath / (fileName + ReplaceSuffix);
         if (bf::exists(replaceFile, ec)) {
             m_logger.info("Replacing " + fullPathStr + " with " + replaceFile.string());
-            bf::copy_file(replaceFile, bf::path(fullPathStr), bf::copy_option::overwrite_if_exists, ec);
-            if (ec) {
-                m_logger.warning("Failed to write \"" + fullPathStr + "\": " + ec.message());
+            if (!copyOutput(replaceFile, fullPathStr)) {
+                m_logger.warning("Failed to write \"" + fullPathStr + "\".");
             }
             return std::make_pair(common::emptyString(), common::emptyString());
         }
 
         auto extendFile = *iter / relDirPath / (fileName + ExtendSuffix);
         if (bf::exists(extendFile, ec)) {
-            bf::copy_file(extendFile, bf::path(fullPathStr), bf::copy_option::overwrite_if_exists, ec);
-            if (ec) {
-                m_logger.warning("Failed to write \"" + fullPathStr + "\": " + ec.message());
+            if (!copyOutput(extendFile, fullPathStr)) {
+                m_logger.warning("Failed to write \"" + fullPathStr + "\".");
             }
             className += common::origSuffixStr();
             fileName = className + common::headerSuffix();
@@ -2010,8 +2459,7 @@ std::pair<std::string, std::string> Generator::startPluginWrite(
         auto replaceFile = *iter / relDirPath / (fileName + ReplaceSuffix);
         if (bf::exists(replaceFile, ec)) {
             m_logger.info("Replacing " + fullPathStr + " with " + replaceFile.string());
-            bf::copy_file(replaceFile, bf::path(fullPathStr), bf::copy_option::overwrite_if_exists, ec);
-            if (ec) {
+            if (!copyOutput(replaceFile, fullPathStr)) {
                 m_logger.warning("Failed to write " + fullPathStr);
                 assert(!"Should not happen");
             }
@@ -2020,9 +2468,8 @@ std::pair<std::string, std::string> Generator::startPluginWrite(
 
         auto extendFile = *iter / relDirPath / (fileName + ExtendSuffix);
         if (bf::exists(extendFile, ec)) {
-            bf::copy_file(extendFile, bf::path(fullPathStr), bf::copy_option::overwrite_if_exists, ec);
-            if (ec) {
-                m_logger.warning("Failed to write \"" + fullPathStr + "\": " + ec.message());
+            if (!copyOutput(extendFile, fullPathStr)) {
+                m_logger.warning("Failed to write \"" + fullPathStr + "\".");
                 assert(!"Should not happen");
             }
             className += common::origSuffixStr();
@@ -2036,6 +2483,105 @@ std::pair<std::string, std::string> Generator::startPluginWrite(
     return std::make_pair(std::move(fullPathStr), std::move(className));
 }
 
+bool Generator::writeCachedMessage(
+    const std::string& externalRef,
+    std::uint64_t digest,
+    const RenderCache::WriteFunc& func)
+{
+    // The message class depends on the interfaces (version dependent code)
+    // and the names of the message ID enum values.
+    digest = RenderCache::combineDigests(digest, m_interfacesDigest);
+    digest = RenderCache::combineDigests(digest, m_msgIdDigest);
+    return writeCached(common::messageStr(), externalRef, digest, func);
+}
+
+bool Generator::writeCachedField(
+    const std::string& externalRef,
+    std::uint64_t digest,
+    const RenderCache::WriteFunc& func)
+{
+    // The field class depends on the interfaces (version dependent code)
+    digest = RenderCache::combineDigests(digest, m_interfacesDigest);
+    return writeCached(common::fieldStr(), externalRef, digest, func);
+}
+
+bool Generator::writeCachedFrame(
+    const std::string& externalRef,
+    std::uint64_t digest,
+    const RenderCache::WriteFunc& func)
+{
+    // The frame class depends on the interfaces, the list of the input
+    // messages and their lengths.
+    digest = RenderCache::combineDigests(digest, m_interfacesDigest);
+    digest = RenderCache::combineDigests(digest, m_messagesDigest);
+    return writeCached(common::frameStr(), externalRef, digest, func);
+}
+
+bool Generator::writeCachedInterface(
+    const std::string& externalRef,
+    std::uint64_t digest,
+    const RenderCache::WriteFunc& func)
+{
+    // The interface class depends on the other interfaces (version
+    // dependent code) and the message ID type.
+    digest = RenderCache::combineDigests(digest, m_interfacesDigest);
+    digest = RenderCache::combineDigests(digest, m_msgIdDigest);
+    return writeCached(common::interfaceStr(), externalRef, digest, func);
+}
+
+std::uint64_t Generator::fieldDefinitionDigest(const std::string& externalRef) const
+{
+    auto field = m_protocol.findField(externalRef);
+    if (!field.valid()) {
+        return 0U;
+    }
+
+    return field.definitionDigest();
+}
+
+bool Generator::writeCached(
+    const std::string& kind,
+    const std::string& externalRef,
+    std::uint64_t digest,
+    const RenderCache::WriteFunc& func)
+{
+    if (!m_renderCache) {
+        return func();
+    }
+
+    return m_renderCache->write(kind + ' ' + externalRef, digest, func);
+}
+
+bool Generator::writeCachedAggregate(const std::string& name, const RenderCache::WriteFunc& func)
+{
+    // The files listing all the messages and frames (AllMessages, Dispatch,
+    // MsgId, etc...) don't depend on the message fields, they are rendered
+    // again only when the set of messages, their IDs, lengths or platforms,
+    // the interfaces or the frames change.
+    auto digest = RenderCache::combineDigests(m_interfacesDigest, m_messagesDigest);
+    digest = RenderCache::combineDigests(digest, m_msgIdDigest);
+    digest = RenderCache::combineDigests(digest, m_framesDigest);
+    return writeCached("aggregate", name, digest, func);
+}
+
+void Generator::recordFieldDependency(const Field& field, bool generate) const
+{
+    if (m_renderCache) {
+        m_renderCache->recordAccessedField(field.externalRef(), field.dslObj().definitionDigest(), generate);
+    }
+}
+
+bool Generator::copyOutput(const boost::filesystem::path& from, const std::string& to)
+{
+    std::ifstream stream(from.string());
+    if (!stream) {
+        return false;
+    }
+
+    std::string contents((std::istreambuf_iterator<char>(stream)), std::istreambuf_iterator<char>());
+    return writeOutput(to, contents);
+}
+
 std::string Generator::startGenericWrite(
     const std::string& name,
     const std::string& subFolder)
@@ -2083,9 +2629,8 @@ std::string Generator::startGenericWrite(
         auto replaceFile = *iter / relDirPath / (name + ReplaceSuffix);
         if (bf::exists(replaceFile, ec)) {
             m_logger.info("Replacing " + fullPathStr + " with " + replaceFile.string());
-            bf::copy_file(replaceFile, bf::path(fullPathStr), bf::copy_option::overwrite_if_exists, ec);
-            if (ec) {
-                m_logger.warning("Failed to write \"" + fullPathStr + "\": " + ec.message());
+            if (!copyOutput(replaceFile, fullPathStr)) {
+                m_logger.warning("Failed to write \"" + fullPathStr + "\".");
             }
             return common::emptyString();
         }
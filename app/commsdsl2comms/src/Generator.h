@@ -20,6 +20,8 @@
 #include <set>
 #include <map>
 #include <cstdint>
+#include <memory>
+#include <functional>
 
 #include <boost/filesystem.hpp>
 
@@ -29,6 +31,9 @@
 #include "Namespace.h"
 #include "Plugin.h"
 #include "CustomizationLevel.h"
+#include "RenderCache.h"
+#include "OutputSink.h"
+#include "FilesystemOutputSink.h"
 
 namespace commsdsl2comms
 {
@@ -43,14 +48,59 @@ public:
     using PlatformsList = commsdsl::Protocol::PlatformsList;
     using InterfacesAccessList = Namespace::InterfacesAccessList;
     using FramesAccessList = Namespace::FramesAccessList;
+    using MessagesAccessList = Namespace::MessagesAccessList;
+    using DslMessagesList = commsdsl::Protocol::MessagesList;
+
+    // Messages of a single input bundle together with the bundle name
+    // (as used by headerfileForInput()).
+    struct InputMessages
+    {
+        DslMessagesList m_messages;
+        std::string m_inputName;
+    };
+
+    struct PlatformMessages
+    {
+        InputMessages m_all;
+        InputMessages m_serverInput;
+        InputMessages m_clientInput;
+        bool m_realPlatform = true;
+    };
+
+    // Key is platform or extra messages bundle name, empty for all the messages
+    using PlatformsMessagesMap = std::map<std::string, PlatformMessages>;
 
     Generator(ProgramOptions& options, Logger& logger)
-      : m_options(options), m_logger(logger)
+      : m_options(options),
+        m_logger(logger),
+        m_outputDir(options.getOutputDirectory()),
+        m_renderCacheDir(options.getRenderCacheDirectory()),
+        m_filesystemSink(logger),
+        m_outputSink(&m_filesystemSink)
     {
     }
 
     bool generate(const FilesList& files);
 
+    void setOutputDir(const std::string& dir)
+    {
+        m_outputDir = dir;
+    }
+
+    void setRenderCacheDir(const std::string& dir)
+    {
+        m_renderCacheDir = dir;
+    }
+
+    // All the files are written to the disk unless other sink is provided
+    void setOutputSink(OutputSink& sink)
+    {
+        m_outputSink = &sink;
+    }
+
+    bool createDir(const boost::filesystem::path& path);
+    bool writeOutput(const std::string& path, const std::string& contents);
+
     Logger& logger()
     {
         return m_logger;
@@ -74,6 +124,10 @@ public:
 
     std::vector<std::string> bundlesForMessage(const std::string& externalRef);
 
+    PlatformsMessagesMap getPlatformsMessages();
+
+    std::string messageIdStr(std::uintmax_t value);
+
     std::string protocolDefRootDir();
 
     std::string outputDir();
@@ -141,6 +195,38 @@ public:
     std::pair<std::string, std::string>
     startDispatchProtocolWrite(const std::string& name);
 
+    std::pair<std::string, std::string>
+    startFactoryProtocolWrite(const std::string& name);
+
+    std::pair<std::string, std::string>
+    startInstantiationProtocolWrite(const std::string& name);
+
+    std::string startInstantiationSrcWrite(const std::string& name);
+
+    std::string startCmakeScriptWrite(const std::string& name);
+
+    bool writeCachedMessage(
+        const std::string& externalRef,
+        std::uint64_t digest,
+        const RenderCache::WriteFunc& func);
+
+    bool writeCachedField(
+        const std::string& externalRef,
+        std::uint64_t digest,
+        const RenderCache::WriteFunc& func);
+
+    bool writeCachedFrame(
+        const std::string& externalRef,
+        std::uint64_t digest,
+        const RenderCache::WriteFunc& func);
+
+    bool writeCachedInterface(
+        const std::string& externalRef,
+        std::uint64_t digest,
+        const RenderCache::WriteFunc& func);
+
+    std::uint64_t fieldDefinitionDigest(const std::string& externalRef) const;
+
     std::pair<std::string, std::string>
     startGenericProtocolWrite(const std::string& name);
 
@@ -193,6 +279,9 @@ public:
     std::pair<std::string, std::string>
     namespacesForDispatch() const;
 
+    std::pair<std::string, std::string>
+    namespacesForFactory() const;
+
     std::pair<std::string, std::string>
     namespacesForRoot() const;
 
@@ -225,6 +314,8 @@ public:
     std::string headerfileForInputInPlugin(const std::string& name, bool quotes = true);
 
     std::string headerfileForDispatch(const std::string& name, bool quotes = true);
+    std::string headerfileForFactory(const std::string& name, bool quotes = true);
+    std::string headerfileForInstantiation(const std::string& name, bool quotes = true);
 
     std::string headerfileForRoot(const std::string& name, bool quotes = true);
 
@@ -291,6 +382,11 @@ public:
         bool mainIncluded = false,
         bool classIncluded = false);
 
+    std::string scopeForFactory(
+        const std::string& externalRef,
+        bool mainIncluded = false,
+        bool classIncluded = false);
+
     std::string scopeForRoot(
         const std::string& externalRef,
         bool mainIncluded = false,
@@ -375,6 +471,21 @@ public:
         return m_options.pluginBuildEnabledByDefault();
     }
 
+    bool variantDispatchRequested() const
+    {
+        return m_options.variantDispatchRequested();
+    }
+
+    bool explicitInstantiationRequested() const
+    {
+        return m_options.explicitInstantiationRequested();
+    }
+
+    bool includeReportRequested() const
+    {
+        return m_options.includeReportRequested();
+    }
+
     std::string getProtocolVersion() const
     {
         return m_options.getProtocolVersion();
@@ -435,6 +546,7 @@ public:
     NamespacesScopesList getNonDefaultNamespacesScopes() const;
     InterfacesAccessList getAllInterfaces() const;
     FramesAccessList getAllFrames() const;
+    MessagesAccessList getAllMessages() const;
 
     const std::string& getMinCommsVersionStr() const;
 
@@ -458,13 +570,22 @@ private:
     bool parseOptions();
     bool parseCustomization();
     bool parseSchemaFiles(const FilesList& files);
+    bool parseSchemaStdin();
     bool prepare();
+    bool prepareRenderCache();
+    bool reportPerformance();
     bool writeFiles();
-    bool createDir(const boost::filesystem::path& path);
     boost::filesystem::path getProtocolDefRootDir() const;
     bool mustDefineDefaultInterface() const;
     bool anyInterfaceHasVersion();
     const Field* findMessageIdField() const;
+    void recordFieldDependency(const Field& field, bool generate) const;
+    bool writeCached(
+        const std::string& kind,
+        const std::string& externalRef,
+        std::uint64_t digest,
+        const RenderCache::WriteFunc& func);
+    bool writeCachedAggregate(const std::string& name, const RenderCache::WriteFunc& func);
     bool writeExtraFiles();
     Namespace& findOrCreateDefaultNamespace();
 
@@ -497,6 +618,7 @@ private:
         bool header,
         const std::string& subNs = common::emptyString());
 
+    bool copyOutput(const boost::filesystem::path& from, const std::string& to);
     std::string startGenericWrite(
         const std::string& name,
         const std::string& subFolder = common::emptyString());
@@ -520,6 +642,10 @@ private:
 
     ProgramOptions& m_options;
     Logger& m_logger;
+    std::string m_outputDir;
+    std::string m_renderCacheDir;
+    FilesystemOutputSink m_filesystemSink;
+    OutputSink* m_outputSink = nullptr;
     commsdsl::Protocol m_protocol;
     NamespacesList m_namespaces;
     PluginsList m_plugins;
@@ -535,6 +661,12 @@ private:
     const Field* m_messageIdField = nullptr;
     ExtraMessagesInfosList m_extraMessages;
     bool m_versionDependentCode = false;
+    std::unique_ptr<RenderCache> m_renderCache;
+    std::uint64_t m_interfacesDigest = 0U;
+    std::uint64_t m_messagesDigest = 0U;
+    std::uint64_t m_msgIdDigest = 0U;
+    std::uint64_t m_framesDigest = 0U;
+    bool m_outputFailed = false;
 };
 
 } // namespace commsdsl2comms
@@ -19,6 +19,7 @@
 
 #include "common.h"
 #include "Generator.h"
+#include "MsgFactory.h"
 
 namespace commsdsl2comms
 {
@@ -26,11 +27,18 @@ namespace commsdsl2comms
 void IdLayer::updateIncludesImpl(Layer::IncludesList& includes) const
 {
     static const common::StringsList List = {
+        "<cstddef>",
+        "<iterator>",
+        "<type_traits>",
         "comms/protocol/MsgIdLayer.h"
     };
 
     common::mergeIncludes(List, includes);
     common::mergeInclude(generator().headerfileForInput(common::allMessagesStr(), false), includes);
+    for (auto& f : MsgFactory::factories(generator())) {
+        common::mergeInclude(generator().headerfileForInput(f.first, false), includes);
+        common::mergeInclude(generator().headerfileForFactory(f.second, false), includes);
+    }
 }
 
 std::string IdLayer::getClassDefinitionImpl(
@@ -45,16 +53,116 @@ std::string IdLayer::getClassDefinitionImpl(
     static const std::string Templ =
         "#^#FIELD_DEF#$#\n"
         "#^#PREFIX#$#\n"
+        "/// @details Uses the generated message factory matching the\n"
+        "///     @b TAllMessages bundle to create the dynamically allocated\n"
+        "///     message objects. Other messages bundles, in-place allocation,\n"
+        "///     unknown message IDs and single pass iterators are handled\n"
+        "///     by @b comms::protocol::MsgIdLayer.\n"
         "template <typename TMessage, typename TAllMessages>\n"
-        "using #^#CLASS_NAME#$# =\n"
+        "class #^#CLASS_NAME#$# : public\n"
         "    comms::protocol::MsgIdLayer<\n"
         "        #^#FIELD_TYPE#$#,\n"
         "        TMessage,\n"
         "        TAllMessages,\n"
         "        #^#PREV_LAYER#$##^#COMMA#$#\n"
         "        #^#EXTRA_OPT#$#\n"
-        "    >;\n";
-    
+        "    >\n"
+        "{\n"
+        "    using Base =\n"
+        "        comms::protocol::MsgIdLayer<\n"
+        "            #^#FIELD_TYPE#$#,\n"
+        "            TMessage,\n"
+        "            TAllMessages,\n"
+        "            #^#PREV_LAYER#$##^#COMMA#$#\n"
+        "            #^#EXTRA_OPT#$#\n"
+        "        >;\n\n"
+        "    struct NoFactory\n"
+        "    {\n"
+        "        using MsgPtr = void;\n"
+        "    };\n\n"
+        "    using Factory =\n"
+        "        #^#FACTORY#$#;\n\n"
+        "    static const bool UseFactory =\n"
+        "        std::is_same<typename Factory::MsgPtr, typename Base::MsgPtr>::value;\n\n"
+        "    struct FactoryTag {};\n"
+        "    struct BaseTag {};\n\n"
+        "public:\n"
+        "    /// @brief Type of the message ID field.\n"
+        "    using Field = typename Base::Field;\n\n"
+        "    /// @brief Type of the message ID when passed as a parameter.\n"
+        "    using MsgIdParamType = typename TMessage::MsgIdParamType;\n\n"
+        "    /// @brief Smart pointer to the created message object.\n"
+        "    using MsgPtr = typename Base::MsgPtr;\n\n"
+        "    using Base::read;\n\n"
+        "    /// @brief Create message object given the ID of the message.\n"
+        "    /// @param[in] id ID of the message.\n"
+        "    /// @param[in] idx Index of the message among messages with the same ID.\n"
+        "    MsgPtr createMsg(MsgIdParamType id, unsigned idx = 0U)\n"
+        "    {\n"
+        "        using Tag = typename std::conditional<UseFactory, FactoryTag, BaseTag>::type;\n"
+        "        return createMsgInternal(id, idx, Tag());\n"
+        "    }\n\n"
+        "    /// @brief Read the message ID followed by the message contents.\n"
+        "    /// @details The message object is created by the generated factory\n"
+        "    ///     and read by the next layer. In case there are multiple\n"
+        "    ///     messages with the same ID, they are tried in order.\n"
+        "    /// @param[out] msg Smart pointer to the created message object.\n"
+        "    /// @param[in, out] iter Iterator used for reading.\n"
+        "    /// @param[in] size Number of bytes available for reading.\n"
+        "    template <typename TIter>\n"
+        "    comms::ErrorStatus read(MsgPtr& msg, TIter& iter, std::size_t size)\n"
+        "    {\n"
+        "        using IterCategory = typename std::iterator_traits<typename std::decay<TIter>::type>::iterator_category;\n"
+        "        static const bool MultiPass = std::is_base_of<std::forward_iterator_tag, IterCategory>::value;\n"
+        "        using Tag = typename std::conditional<UseFactory && MultiPass, FactoryTag, BaseTag>::type;\n"
+        "        return readInternal(msg, iter, size, Tag());\n"
+        "    }\n\n"
+        "private:\n"
+        "    MsgPtr createMsgInternal(MsgIdParamType id, unsigned idx, FactoryTag)\n"
+        "    {\n"
+        "        return Factory::createMsg(id, idx);\n"
+        "    }\n\n"
+        "    MsgPtr createMsgInternal(MsgIdParamType id, unsigned idx, BaseTag)\n"
+        "    {\n"
+        "        return Base::createMsg(id, idx);\n"
+        "    }\n\n"
+        "    template <typename TIter>\n"
+        "    comms::ErrorStatus readInternal(MsgPtr& msg, TIter& iter, std::size_t size, BaseTag)\n"
+        "    {\n"
+        "        return Base::read(msg, iter, size);\n"
+        "    }\n\n"
+        "    template <typename TIter>\n"
+        "    comms::ErrorStatus readInternal(MsgPtr& msg, TIter& iter, std::size_t size, FactoryTag)\n"
+        "    {\n"
+        "        Field field;\n"
+        "        auto payloadIter = iter;\n"
+        "        auto es = field.read(payloadIter, size);\n"
+        "        if (es != comms::ErrorStatus::Success) {\n"
+        "            return Base::read(msg, iter, size);\n"
+        "        }\n\n"
+        "        auto id = static_cast<MsgIdParamType>(field.value());\n"
+        "        auto count = Factory::msgCount(id);\n"
+        "        if (count == 0U) {\n"
+        "            return Base::read(msg, iter, size);\n"
+        "        }\n\n"
+        "        auto payloadSize = size - static_cast<std::size_t>(std::distance(iter, payloadIter));\n"
+        "        for (unsigned idx = 0U; idx < count; ++idx) {\n"
+        "            msg = Factory::createMsg(id, idx);\n"
+        "            auto readIter = payloadIter;\n"
+        "            es = Base::nextLayer().read(msg, readIter, payloadSize);\n"
+        "            if (es == comms::ErrorStatus::Success) {\n"
+        "                iter = readIter;\n"
+        "                return es;\n"
+        "            }\n\n"
+        "            msg.reset();\n"
+        "            if (es == comms::ErrorStatus::NotEnoughData) {\n"
+        "                break;\n"
+        "            }\n"
+        "        }\n\n"
+        "        return es;\n"
+        "    }\n"
+        "};\n";
+
     common::ReplacementMap replacements;
     replacements.insert(std::make_pair("FIELD_DEF", getFieldDefinition(scope)));
     replacements.insert(std::make_pair("PREFIX", getPrefix()));
@@ -62,6 +170,7 @@ std::string IdLayer::getClassDefinitionImpl(
     replacements.insert(std::make_pair("CLASS_NAME", common::nameToClassCopy(name())));
     replacements.insert(std::make_pair("EXTRA_OPT", getExtraOpt(scope)));
     replacements.insert(std::make_pair("PREV_LAYER", prevLayer));
+    replacements.insert(std::make_pair("FACTORY", getFactory()));
 
     if (!replacements["EXTRA_OPT"].empty()) {
         replacements.insert(std::make_pair("COMMA", ","));
@@ -83,4 +192,26 @@ bool IdLayer::isCustomizableImpl() const
     return true;
 }
 
+std::string IdLayer::getFactory() const
+{
+    // The first matching bundle is taken when several bundles have the same messages
+    auto factories = MsgFactory::factories(generator());
+    std::string result = "NoFactory";
+    for (auto iter = factories.rbegin(); iter != factories.rend(); ++iter) {
+        static const std::string Templ =
+            "typename std::conditional<\n"
+            "    std::is_same<TAllMessages, #^#INPUT#$#<TMessage, TOpt> >::value,\n"
+            "    #^#FACTORY#$#<TMessage, TOpt>,\n"
+            "    #^#NEXT#$#\n"
+            ">::type";
+
+        common::ReplacementMap repl;
+        repl.insert(std::make_pair("INPUT", generator().scopeForInput(iter->first, true, true)));
+        repl.insert(std::make_pair("FACTORY", generator().scopeForFactory(iter->second, true, true)));
+        repl.insert(std::make_pair("NEXT", std::move(result)));
+        result = common::processTemplate(Templ, repl);
+    }
+    return result;
+}
+
 } // namespace commsdsl2comms
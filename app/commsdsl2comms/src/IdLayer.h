@@ -43,6 +43,8 @@ private:
     {
         return commsdsl::IdLayer(dslObj());
     }
+
+    std::string getFactory() const;
 };
 
 inline
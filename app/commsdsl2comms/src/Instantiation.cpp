@@ -0,0 +1,358 @@
+//
+// Copyright 2018 - 2020 (C). Alex Robenko. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "Instantiation.h"
+
+#include "Generator.h"
+#include "OutputFile.h"
+
+namespace commsdsl2comms
+{
+
+namespace
+{
+
+const std::size_t MaxMessagesPerPart = 32U;
+const std::string MessagesStr("Messages");
+const std::string FramesStr("Frames");
+const std::string InstantiatePrefix("INSTANTIATE_");
+const std::string ExternPrefix("EXTERN_");
+const std::string MacroArgsStr("(prefix_, TBase_, TOpt_)");
+const std::string MacroSep(" \\\n");
+const std::string MacroIndent("    ");
+
+bool writeFileContents(Generator& generator, const std::string& filePath, const std::string& contents)
+{
+    OutputFile stream(generator, filePath);
+
+    stream << contents;
+    stream.flush();
+    if (!stream.good()) {
+        generator.logger().error("Failed to write \"" + filePath + "\".");
+        return false;
+    }
+
+    return true;
+}
+
+} // namespace
+
+bool Instantiation::write(Generator& generator)
+{
+    if (!generator.explicitInstantiationRequested()) {
+        return true;
+    }
+
+    Instantiation obj(generator);
+    return
+        obj.prepare() &&
+        obj.writeMessagesDefinition() &&
+        obj.writeFramesDefinition() &&
+        obj.writeSources() &&
+        obj.writeCmake();
+}
+
+bool Instantiation::prepare()
+{
+    auto allMessages = m_generator.getAllDslMessages();
+    for (auto& m : allMessages) {
+        assert(m.valid());
+        if (!m_generator.doesElementExist(m.sinceVersion(), m.deprecatedSince(), m.isDeprecatedRemoved())) {
+            continue;
+        }
+
+        if (m_parts.empty() || (MaxMessagesPerPart <= m_parts.back().size())) {
+            m_parts.emplace_back();
+            m_parts.back().reserve(MaxMessagesPerPart);
+        }
+
+        m_parts.back().push_back(m.externalRef());
+    }
+
+    return true;
+}
+
+bool Instantiation::writeMessagesDefinition() const
+{
+    for (auto idx = 0U; idx < m_parts.size(); ++idx) {
+        if (!writeMessagesPartDefinition(idx, m_parts[idx])) {
+            return false;
+        }
+    }
+
+    auto startInfo = m_generator.startInstantiationProtocolWrite(MessagesStr);
+    auto& filePath = startInfo.first;
+    if (filePath.empty()) {
+        return true;
+    }
+
+    common::StringsList includes;
+    common::StringsList parts;
+    for (auto idx = 0U; idx < m_parts.size(); ++idx) {
+        auto partName = getPartName(idx);
+        common::mergeInclude(m_generator.headerfileForInstantiation(partName, false), includes);
+        parts.push_back(MacroIndent + getMacroName(InstantiatePrefix + partName) + "(extern, TBase_, TOpt_)");
+    }
+
+    common::ReplacementMap replacements;
+    replacements.insert(std::make_pair("GEN_COMMENT", m_generator.fileGeneratedComment()));
+    replacements.insert(std::make_pair("INCLUDES", common::includesToStatements(includes)));
+    replacements.insert(std::make_pair("EXTERN_MACRO", getMacroName(ExternPrefix + MessagesStr)));
+    replacements.insert(std::make_pair("PARTS", common::listToString(parts, MacroSep, common::emptyString())));
+
+    const std::string Template(
+        "#^#GEN_COMMENT#$#\n"
+        "/// @file\n"
+        "/// @brief Contains macro declaring explicit instantiation of all the messages.\n\n"
+        "#pragma once\n\n"
+        "#^#INCLUDES#$#\n"
+        "/// @brief Declare explicit instantiation of all the messages, which is\n"
+        "///     defined in one of the compiled sources of the \"instantiation\" library.\n"
+        "/// @details Must be used at global scope with the same interface and options\n"
+        "///     types the library was compiled with, before the messages are used.\n"
+        "/// @param[in] TBase_ Interface class, must not contain commas.\n"
+        "/// @param[in] TOpt_ Protocol definition options, must not contain commas.\n"
+        "#define #^#EXTERN_MACRO#$#(TBase_, TOpt_) \\\n"
+        "#^#PARTS#$#\n\n"
+    );
+
+    return writeFileContents(m_generator, filePath, common::processTemplate(Template, replacements));
+}
+
+bool Instantiation::writeMessagesPartDefinition(std::size_t idx, const common::StringsList& messages) const
+{
+    auto partName = getPartName(idx);
+    auto startInfo = m_generator.startInstantiationProtocolWrite(partName);
+    auto& filePath = startInfo.first;
+    if (filePath.empty()) {
+        return true;
+    }
+
+    common::StringsList includes;
+    common::StringsList instantiations;
+    instantiations.reserve(messages.size());
+    for (auto& extRef : messages) {
+        common::mergeInclude(m_generator.headerfileForMessage(extRef, false), includes);
+        instantiations.push_back(
+            MacroIndent + "prefix_ template class " + m_generator.scopeForMessage(extRef, true, true) + "<TBase_, TOpt_>;");
+    }
+
+    common::ReplacementMap replacements;
+    replacements.insert(std::make_pair("GEN_COMMENT", m_generator.fileGeneratedComment()));
+    replacements.insert(std::make_pair("INCLUDES", common::includesToStatements(includes)));
+    replacements.insert(std::make_pair("MACRO", getMacroName(InstantiatePrefix + partName)));
+    replacements.insert(std::make_pair("MACRO_ARGS", MacroArgsStr));
+    replacements.insert(std::make_pair("IDX", std::to_string(idx)));
+    replacements.insert(std::make_pair("INSTANTIATIONS", common::listToString(instantiations, MacroSep, common::emptyString())));
+
+    const std::string Template(
+        "#^#GEN_COMMENT#$#\n"
+        "/// @file\n"
+        "/// @brief Contains macro for explicit instantiation of the messages, part #^#IDX#$#.\n\n"
+        "#pragma once\n\n"
+        "#^#INCLUDES#$#\n"
+        "/// @brief Explicit instantiation of the messages, part #^#IDX#$#.\n"
+        "/// @param[in] prefix_ Empty for the instantiation definition, @b extern for the declaration.\n"
+        "/// @param[in] TBase_ Interface class, must not contain commas.\n"
+        "/// @param[in] TOpt_ Protocol definition options, must not contain commas.\n"
+        "#define #^#MACRO#$##^#MACRO_ARGS#$# \\\n"
+        "#^#INSTANTIATIONS#$#\n\n"
+    );
+
+    return writeFileContents(m_generator, filePath, common::processTemplate(Template, replacements));
+}
+
+bool Instantiation::writeFramesDefinition() const
+{
+    auto startInfo = m_generator.startInstantiationProtocolWrite(FramesStr);
+    auto& filePath = startInfo.first;
+    if (filePath.empty()) {
+        return true;
+    }
+
+    auto inputScope = m_generator.scopeForInput(common::allMessagesStr(), true, true);
+    common::StringsList includes;
+    common::mergeInclude(m_generator.headerfileForInput(common::allMessagesStr(), false), includes);
+
+    common::StringsList instantiations;
+    auto allFrames = m_generator.getAllFrames();
+    for (auto* f : allFrames) {
+        auto& extRef = f->externalRef();
+        common::mergeInclude(m_generator.headerfileForFrame(extRef, false), includes);
+        instantiations.push_back(
+            MacroIndent + "prefix_ template class " + m_generator.scopeForFrame(extRef, true, true) +
+            "<TBase_, " + inputScope + "<TBase_, TOpt_>, TOpt_>;");
+    }
+
+    common::ReplacementMap replacements;
+    replacements.insert(std::make_pair("GEN_COMMENT", m_generator.fileGeneratedComment()));
+    replacements.insert(std::make_pair("INCLUDES", common::includesToStatements(includes)));
+    replacements.insert(std::make_pair("MACRO", getMacroName(InstantiatePrefix + FramesStr)));
+    replacements.insert(std::make_pair("MACRO_ARGS", MacroArgsStr));
+    replacements.insert(std::make_pair("EXTERN_MACRO", getMacroName(ExternPrefix + FramesStr)));
+    replacements.insert(std::make_pair("INPUT", inputScope));
+    replacements.insert(std::make_pair("INSTANTIATIONS", common::listToString(instantiations, MacroSep, common::emptyString())));
+
+    const std::string Template(
+        "#^#GEN_COMMENT#$#\n"
+        "/// @file\n"
+        "/// @brief Contains macros for explicit instantiation of all the frames.\n\n"
+        "#pragma once\n\n"
+        "#^#INCLUDES#$#\n"
+        "/// @brief Explicit instantiation of all the frames using @ref #^#INPUT#$#\n"
+        "///     as input messages.\n"
+        "/// @param[in] prefix_ Empty for the instantiation definition, @b extern for the declaration.\n"
+        "/// @param[in] TBase_ Interface class, must not contain commas.\n"
+        "/// @param[in] TOpt_ Protocol definition options, must not contain commas.\n"
+        "#define #^#MACRO#$##^#MACRO_ARGS#$# \\\n"
+        "#^#INSTANTIATIONS#$#\n\n"
+        "/// @brief Declare explicit instantiation of all the frames, which is\n"
+        "///     defined in the compiled sources of the \"instantiation\" library.\n"
+        "/// @param[in] TBase_ Interface class, must not contain commas.\n"
+        "/// @param[in] TOpt_ Protocol definition options, must not contain commas.\n"
+        "#define #^#EXTERN_MACRO#$#(TBase_, TOpt_) \\\n"
+        "    #^#MACRO#$#(extern, TBase_, TOpt_)\n\n"
+    );
+
+    return writeFileContents(m_generator, filePath, common::processTemplate(Template, replacements));
+}
+
+bool Instantiation::writeSources() const
+{
+    for (auto idx = 0U; idx < m_parts.size(); ++idx) {
+        auto partName = getPartName(idx);
+        auto body =
+            "#include \"" + m_generator.headerfileForInstantiation(partName, false) + "\"\n\n" +
+            getMacroName(InstantiatePrefix + partName) + "(, INTERFACE, OPTIONS)\n";
+
+        if (!writeSource(partName, body)) {
+            return false;
+        }
+    }
+
+    auto body =
+        "#include \"" + m_generator.headerfileForInstantiation(MessagesStr, false) + "\"\n"
+        "#include \"" + m_generator.headerfileForInstantiation(FramesStr, false) + "\"\n\n" +
+        getMacroName(ExternPrefix + MessagesStr) + "(INTERFACE, OPTIONS)\n" +
+        getMacroName(InstantiatePrefix + FramesStr) + "(, INTERFACE, OPTIONS)\n";
+
+    return writeSource(FramesStr, body);
+}
+
+bool Instantiation::writeSource(const std::string& name, const std::string& body) const
+{
+    auto filePath = m_generator.startInstantiationSrcWrite(name + common::srcSuffix());
+    if (filePath.empty()) {
+        return true;
+    }
+
+    common::ReplacementMap replacements;
+    replacements.insert(std::make_pair("GEN_COMMENT", m_generator.fileGeneratedComment()));
+    replacements.insert(std::make_pair("BODY", body));
+
+    const std::string Template(
+        "#^#GEN_COMMENT#$#\n"
+        "#define QUOTES_(x_) #x_\n"
+        "#define QUOTES(x_) QUOTES_(x_)\n\n"
+        "#ifndef INTERFACE_HEADER\n"
+        "#error \"Interface header needs to be defined\"\n"
+        "#endif\n\n"
+        "#ifndef INTERFACE\n"
+        "#error \"Interface type needs to be defined\"\n"
+        "#endif\n\n"
+        "#ifndef OPTIONS_HEADER\n"
+        "#error \"Options header needs to be defined\"\n"
+        "#endif\n\n"
+        "#ifndef OPTIONS\n"
+        "#error \"Options type needs to be defined\"\n"
+        "#endif\n\n"
+        "#include QUOTES(INTERFACE_HEADER)\n"
+        "#include QUOTES(OPTIONS_HEADER)\n\n"
+        "#^#BODY#$#\n"
+    );
+
+    return writeFileContents(m_generator, filePath, common::processTemplate(Template, replacements));
+}
+
+bool Instantiation::writeCmake() const
+{
+    auto filePath = m_generator.startInstantiationSrcWrite(common::cmakeListsFileStr());
+    if (filePath.empty()) {
+        return true;
+    }
+
+    common::StringsList sources;
+    for (auto idx = 0U; idx < m_parts.size(); ++idx) {
+        sources.push_back('\"' + getPartName(idx) + common::srcSuffix() + '\"');
+    }
+    sources.push_back('\"' + FramesStr + common::srcSuffix() + '\"');
+
+    common::ReplacementMap replacements;
+    replacements.insert(std::make_pair("PROJ_NAMESPACE", m_generator.mainNamespace()));
+    replacements.insert(std::make_pair("OPTIONS", m_generator.scopeForOptions(common::defaultOptionsStr(), true, true)));
+    replacements.insert(std::make_pair("SOURCES", common::listToString(sources, "\n", common::emptyString())));
+    replacements.insert(std::make_pair("APPEND", m_generator.getExtraAppendForFile(std::vector<std::string>{common::instantiationStr(), common::cmakeListsFileStr()})));
+
+    const std::string Template(
+        "if (\"${OPT_INSTANTIATION_INTERFACE}\" STREQUAL \"\")\n"
+        "    message (WARNING \"OPT_INSTANTIATION_INTERFACE is not provided, the explicit instantiation library is not built.\")\n"
+        "    return ()\n"
+        "endif ()\n\n"
+        "if (\"${OPT_INSTANTIATION_OPTIONS}\" STREQUAL \"\")\n"
+        "    set (OPT_INSTANTIATION_OPTIONS \"#^#OPTIONS#$#\")\n"
+        "endif ()\n\n"
+        "if (\"${OPT_INSTANTIATION_INTERFACE_HEADER}\" STREQUAL \"\")\n"
+        "    string (REPLACE \"::\" \"/\" OPT_INSTANTIATION_INTERFACE_HEADER \"${OPT_INSTANTIATION_INTERFACE}.h\")\n"
+        "endif ()\n\n"
+        "if (\"${OPT_INSTANTIATION_OPTIONS_HEADER}\" STREQUAL \"\")\n"
+        "    string (REPLACE \"::\" \"/\" OPT_INSTANTIATION_OPTIONS_HEADER \"${OPT_INSTANTIATION_OPTIONS}.h\")\n"
+        "endif ()\n\n"
+        "set (name \"#^#PROJ_NAMESPACE#$#_instantiation\")\n"
+        "set (src\n"
+        "    #^#SOURCES#$#\n"
+        ")\n\n"
+        "add_library (${name} STATIC ${src})\n"
+        "target_link_libraries (${name} PUBLIC cc::comms #^#PROJ_NAMESPACE#$#)\n"
+        "target_include_directories (${name} PRIVATE ${OPT_INSTANTIATION_INCLUDE_DIRS})\n"
+        "target_compile_definitions (${name} PRIVATE\n"
+        "    -DINTERFACE=${OPT_INSTANTIATION_INTERFACE}\n"
+        "    -DINTERFACE_HEADER=${OPT_INSTANTIATION_INTERFACE_HEADER}\n"
+        "    -DOPTIONS=${OPT_INSTANTIATION_OPTIONS}\n"
+        "    -DOPTIONS_HEADER=${OPT_INSTANTIATION_OPTIONS_HEADER}\n"
+        ")\n\n"
+        "if (TARGET ${CC_EXTERNAL_TGT})\n"
+        "    add_dependencies(${name} ${CC_EXTERNAL_TGT})\n"
+        "endif ()\n\n"
+        "install (\n"
+        "    TARGETS ${name}\n"
+        "    DESTINATION ${LIB_INSTALL_DIR}\n"
+        ")\n"
+        "#^#APPEND#$#\n"
+    );
+
+    return writeFileContents(m_generator, filePath, common::processTemplate(Template, replacements));
+}
+
+std::string Instantiation::getMacroName(const std::string& suffix) const
+{
+    return common::toUpperCopy(m_generator.mainNamespace()) + "_" + common::toUpperCopy(suffix);
+}
+
+std::string Instantiation::getPartName(std::size_t idx) const
+{
+    return MessagesStr + std::to_string(idx);
+}
+
+} // namespace commsdsl2comms
@@ -0,0 +1,48 @@
+//
+// Copyright 2018 - 2020 (C). Alex Robenko. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <string>
+
+#include "common.h"
+
+namespace commsdsl2comms
+{
+
+class Generator;
+class Instantiation
+{
+public:
+    static bool write(Generator& generator);
+
+private:
+    explicit Instantiation(Generator& generator) : m_generator(generator) {}
+
+    bool prepare();
+    bool writeMessagesDefinition() const;
+    bool writeMessagesPartDefinition(std::size_t idx, const common::StringsList& messages) const;
+    bool writeFramesDefinition() const;
+    bool writeSources() const;
+    bool writeSource(const std::string& name, const std::string& body) const;
+    bool writeCmake() const;
+    std::string getMacroName(const std::string& suffix) const;
+    std::string getPartName(std::size_t idx) const;
+
+    Generator& m_generator;
+    std::vector<common::StringsList> m_parts;
+};
+
+} // namespace commsdsl2comms
@@ -261,6 +261,18 @@ void IntField::updateIncludesImpl(IncludesList& includes) const
     };
 
     common::mergeIncludes(List, includes);
+
+    auto type = intFieldDslObj().type();
+    if ((type == commsdsl::IntField::Type::Intvar) ||
+        (type == commsdsl::IntField::Type::Uintvar)) {
+        static const IncludesList VarLengthList = {
+            "<type_traits>",
+            "<limits>",
+            "<iterator>"
+        };
+
+        common::mergeIncludes(VarLengthList, includes);
+    }
 }
 
 void IntField::updateIncludesCommonImpl(IncludesList& includes) const
@@ -286,7 +298,7 @@ std::string IntField::getClassDefinitionImpl(
     replacements.insert(std::make_pair("FIELD_OPTS", getFieldOpts(scope)));
     replacements.insert(std::make_pair("NAME", getNameCommonWrapFunc(adjScope)));
     replacements.insert(std::make_pair("SPECIALS", getSpecials(adjScope)));
-    replacements.insert(std::make_pair("READ", getCustomRead()));
+    replacements.insert(std::make_pair("READ", getRead()));
     replacements.insert(std::make_pair("WRITE", getCustomWrite()));
     replacements.insert(std::make_pair("LENGTH", getCustomLength()));
     replacements.insert(std::make_pair("VALID", getValid()));
@@ -538,6 +550,11 @@ std::string IntField::getCommonDefinitionImpl(const std::string& fullScope) cons
     return common::processTemplate(Templ, repl);
 }
 
+bool IntField::isFixedLayoutImpl() const
+{
+    return true;
+}
+
 std::string IntField::getFieldBaseParams() const
 {
     auto obj = intFieldDslObj();
@@ -581,6 +598,10 @@ std::string IntField::getFieldOpts(const std::string& scope, bool reduced) const
     checkScalingOpt(options);
     checkUnitsOpt(options);
 
+    if ((!reduced) && hasOptimizedRead()) {
+        common::addToList("comms::option::def::HasCustomRead", options);
+    }
+
     if (!reduced) {
         checkDefaultValueOpt(options);
         checkValidRangesOpt(options);
@@ -640,6 +661,137 @@ std::string IntField::getSpecials(const std::string& scope) const
     return result;
 }
 
+std::string IntField::getRead() const
+{
+    auto& custom = getCustomRead();
+    if (!custom.empty()) {
+        return custom;
+    }
+
+    if (!hasOptimizedRead()) {
+        return common::emptyString();
+    }
+
+    static const std::string Templ =
+        "/// @brief Read functionality optimised for variable length encoding.\n"
+        "/// @details When the available length is sufficient, the first 8 bytes\n"
+        "///     are combined into a single word, the last byte of the encoding is\n"
+        "///     located by checking all the continuation bits at once and\n"
+        "///     the 7 bit groups are merged without a loop. Longer encodings are\n"
+        "///     decoded byte by byte without checking the remaining length for\n"
+        "///     every byte. Close to the end of the buffer the default read is used.\n"
+        "template <typename TIter>\n"
+        "comms::ErrorStatus read(TIter& iter, std::size_t len)\n"
+        "{\n"
+        "    static const std::size_t MaxLen = Base::maxLength();\n"
+        "    if (len < MaxLen) {\n"
+        "        return Base::read(iter, len);\n"
+        "    }\n\n"
+        "    using SerialisedType = typename Base::SerialisedType;\n"
+        "    using UnsignedSerialisedType = typename std::make_unsigned<SerialisedType>::type;\n"
+        "    using IterCategory = typename std::iterator_traits<typename std::decay<TIter>::type>::iterator_category;\n"
+        "    static const bool MultiPass = std::is_base_of<std::forward_iterator_tag, IterCategory>::value;\n"
+        "    static const std::size_t WordLen = sizeof(std::uint64_t);\n\n"
+        "    std::size_t count = 0U;\n"
+        "    UnsignedSerialisedType serValue = 0U;\n"
+        "    do {\n"
+        "        if ((!MultiPass) || (len < WordLen)) {\n"
+        "            break;\n"
+        "        }\n\n"
+        "        // The first byte on the wire is the least significant one\n"
+        "        std::uint64_t word = 0U;\n"
+        "        auto wordIter = iter;\n"
+        "        for (std::size_t idx = 0U; idx < WordLen; ++idx) {\n"
+        "            word |= static_cast<std::uint64_t>(static_cast<std::uint8_t>(*wordIter)) << (idx * 8U);\n"
+        "            ++wordIter;\n"
+        "        }\n\n"
+        "        // Cleared continuation bit marks the last byte of the encoding\n"
+        "        std::uint64_t lastBit = (~word) & 0x8080808080808080ULL;\n"
+        "        if (lastBit == 0U) {\n"
+        "            break;\n"
+        "        }\n\n"
+        "        lastBit &= (~lastBit) + 1U;\n"
+        "        std::size_t wordCount = 1U;\n"
+        "        wordCount += ((lastBit & 0xffffffff00000000ULL) != 0U) ? 4U : 0U;\n"
+        "        wordCount += ((lastBit & 0xffff0000ffff0000ULL) != 0U) ? 2U : 0U;\n"
+        "        wordCount += ((lastBit & 0xff00ff00ff00ff00ULL) != 0U) ? 1U : 0U;\n"
+        "        if (MaxLen < wordCount) {\n"
+        "            break;\n"
+        "        }\n\n"
+        "        std::uint64_t groups = word & ((lastBit << 1U) - 1U) & 0x7f7f7f7f7f7f7f7fULL;\n"
+        "        #^#WORD_ORDER#$#\n"
+        "        groups = ((groups & 0x7f007f007f007f00ULL) >> 1U) | (groups & 0x007f007f007f007fULL);\n"
+        "        groups = ((groups & 0x3fff00003fff0000ULL) >> 2U) | (groups & 0x00003fff00003fffULL);\n"
+        "        groups = ((groups & 0x0fffffff00000000ULL) >> 4U) | (groups & 0x000000000fffffffULL);\n"
+        "        serValue = static_cast<UnsignedSerialisedType>(groups);\n"
+        "        count = wordCount;\n"
+        "        std::advance(iter, count);\n"
+        "    } while (false);\n\n"
+        "    for (std::size_t idx = 0U; (count == 0U) && (idx < MaxLen); ++idx) {\n"
+        "        auto byte = static_cast<std::uint8_t>(*iter);\n"
+        "        ++iter;\n"
+        "        #^#ACCUMULATE#$#\n"
+        "        if ((byte & 0x80U) == 0U) {\n"
+        "            count = idx + 1U;\n"
+        "        }\n"
+        "    }\n\n"
+        "    if (count == 0U) {\n"
+        "        return comms::ErrorStatus::ProtocolError;\n"
+        "    }\n\n"
+        "    #^#SIGN_EXT#$#\n"
+        "    Base::value() = Base::fromSerialised(static_cast<SerialisedType>(serValue));\n"
+        "    return comms::ErrorStatus::Success;\n"
+        "}\n";
+
+    static const std::string LittleEndianAccumulate =
+        "serValue |= static_cast<UnsignedSerialisedType>(static_cast<UnsignedSerialisedType>(byte & 0x7fU) << (idx * 7U));";
+
+    static const std::string BigEndianAccumulate =
+        "serValue = static_cast<UnsignedSerialisedType>(static_cast<UnsignedSerialisedType>(serValue << 7U) | (byte & 0x7fU));";
+
+    static const std::string BigEndianWordOrder =
+        "// The first byte on the wire is the most significant one\n"
+        "groups = ((groups & 0x00ff00ff00ff00ffULL) << 8U) | ((groups >> 8U) & 0x00ff00ff00ff00ffULL);\n"
+        "groups = ((groups & 0x0000ffff0000ffffULL) << 16U) | ((groups >> 16U) & 0x0000ffff0000ffffULL);\n"
+        "groups = ((groups << 32U) | (groups >> 32U)) >> ((WordLen - wordCount) * 8U);";
+
+    static const std::string SignExt =
+        "static const std::size_t ValueBits = std::numeric_limits<UnsignedSerialisedType>::digits;\n"
+        "auto bitsCount = count * 7U;\n"
+        "if ((bitsCount < ValueBits) && (((serValue >> (bitsCount - 1U)) & 0x1U) != 0U)) {\n"
+        "    serValue |= static_cast<UnsignedSerialisedType>(std::numeric_limits<UnsignedSerialisedType>::max() << bitsCount);\n"
+        "}\n";
+
+    auto obj = intFieldDslObj();
+    common::ReplacementMap replacements;
+    if (obj.endian() == commsdsl::Endian_Big) {
+        replacements.insert(std::make_pair("ACCUMULATE", BigEndianAccumulate));
+        replacements.insert(std::make_pair("WORD_ORDER", BigEndianWordOrder));
+    }
+    else {
+        replacements.insert(std::make_pair("ACCUMULATE", LittleEndianAccumulate));
+    }
+
+    if (obj.type() == commsdsl::IntField::Type::Intvar) {
+        replacements.insert(std::make_pair("SIGN_EXT", SignExt));
+    }
+
+    return common::processTemplate(Templ, replacements);
+}
+
+bool IntField::hasOptimizedRead() const
+{
+    if (!getCustomRead().empty()) {
+        return false;
+    }
+
+    auto type = intFieldDslObj().type();
+    return
+        ((type == commsdsl::IntField::Type::Intvar) ||
+         (type == commsdsl::IntField::Type::Uintvar)) &&
+        (!isFailOnInvalid());
+}
+
 std::string IntField::getValid() const
 {
     auto custom = getCustomValid();
@@ -55,6 +55,7 @@ protected:
         bool forcedVersionOptional) const override final;
     virtual std::string getPluginPropertiesImpl(bool serHiddenParam) const override final;
     virtual std::string getCommonDefinitionImpl(const std::string& fullScope) const override final;
+    virtual bool isFixedLayoutImpl() const override final;
 
 private:
     using StringsList = common::StringsList;
@@ -67,6 +68,8 @@ private:
     std::string getFieldOpts(const std::string& scope, bool reduced = false) const;
     std::string getSpecials(const std::string& scope) const;
     std::string getValid() const;
+    std::string getRead() const;
+    bool hasOptimizedRead() const;
     void checkDefaultValueOpt(StringsList& list) const;
     void checkLengthOpt(StringsList& list) const;
     void checkSerOffsetOpt(StringsList& list) const;
@@ -16,7 +16,6 @@
 #include "Interface.h"
 
 #include <cassert>
-#include <fstream>
 #include <map>
 #include <algorithm>
 #include <iterator>
@@ -25,6 +24,7 @@
 #include <boost/algorithm/string.hpp>
 
 #include "Generator.h"
+#include "OutputFile.h"
 #include "common.h"
 #include "EnumField.h"
 
@@ -160,6 +160,8 @@ std::string PluginSrcTemplate =
     "#^#BEGIN_NAMESPACE#$#\n"
     "namespace\n"
     "{\n\n"
+    "namespace #^#CLASS_NAME#$#Props\n"
+    "{\n\n"
     "#^#FIELDS_PROPS#$#\n"
     "QVariantList createProps()\n"
     "{\n"
@@ -167,11 +169,12 @@ std::string PluginSrcTemplate =
     "    #^#PROPS_APPENDS#$#\n"
     "    return props;\n"
     "}\n\n"
-    "} // namespace \n\n"
+    "} // namespace #^#CLASS_NAME#$#Props\n\n"
+    "} // namespace\n\n"
     "#^#ID_FUNC#$#\n"
     "const QVariantList& #^#CLASS_NAME#$#::extraTransportFieldsPropertiesImpl() const\n"
     "{\n"
-    "    static const QVariantList Props = createProps();\n"
+    "    static const QVariantList Props = #^#CLASS_NAME#$#Props::createProps();\n"
     "    return Props;\n"
     "}\n\n"
     "#^#END_NAMESPACE#$#\n"
@@ -214,11 +217,23 @@ bool Interface::prepare()
 
 bool Interface::write()
 {
+    std::uint64_t digest = 0U;
+    if (m_dslObj.valid()) {
+        digest = m_dslObj.definitionDigest();
+    }
+
     return
-        writeProtocolDefinitionCommonFile() &&
-        writeProtocol() &&
-        writePluginHeader() &&
-        writePluginSrc();
+        m_generator.writeCachedInterface(
+            m_externalRef,
+            digest,
+            [this]()
+            {
+                return
+                    writeProtocolDefinitionCommonFile() &&
+                    writeProtocol() &&
+                    writePluginHeader() &&
+                    writePluginSrc();
+            });
 }
 
 const std::string& Interface::name() const
@@ -318,13 +333,10 @@ bool Interface::writeProtocolDefinitionCommonFile()
 
     auto str = common::processTemplate(Templ, repl);
 
-    std::ofstream stream(filePath);
-    if (!stream) {
-        m_generator.logger().error("Failed to open \"" + filePath + "\" for writing.");
-        return false;
-    }
+    OutputFile stream(m_generator, filePath);
     stream << str;
 
+    stream.flush();
     if (!stream.good()) {
         m_generator.logger().error("Failed to write \"" + filePath + "\".");
         return false;
@@ -397,13 +409,10 @@ bool Interface::writeProtocol()
     
     auto str = common::processTemplate(*templ, replacements);
 
-    std::ofstream stream(filePath);
-    if (!stream) {
-        m_generator.logger().error("Failed to open \"" + filePath + "\" for writing.");
-        return false;
-    }
+    OutputFile stream(m_generator, filePath);
     stream << str;
 
+    stream.flush();
     if (!stream.good()) {
         m_generator.logger().error("Failed to write \"" + filePath + "\".");
         return false;
@@ -447,13 +456,10 @@ bool Interface::writePluginHeader()
 
     auto str = common::processTemplate(*templ, replacements);
 
-    std::ofstream stream(filePath);
-    if (!stream) {
-        m_generator.logger().error("Failed to open \"" + filePath + "\" for writing.");
-        return false;
-    }
+    OutputFile stream(m_generator, filePath);
     stream << str;
 
+    stream.flush();
     if (!stream.good()) {
         m_generator.logger().error("Failed to write \"" + filePath + "\".");
         return false;
@@ -519,13 +525,10 @@ bool Interface::writePluginSrc()
         str = common::processTemplate(PluginSrcTemplate, replacements);
     } while (false);
 
-    std::ofstream stream(filePath);
-    if (!stream) {
-        m_generator.logger().error("Failed to open \"" + filePath + "\" for writing.");
-        return false;
-    }
+    OutputFile stream(m_generator, filePath);
     stream << str;
 
+    stream.flush();
     if (!stream.good()) {
         m_generator.logger().error("Failed to write \"" + filePath + "\".");
         return false;
@@ -49,6 +49,11 @@ public:
         return m_externalRef;
     }
 
+    const commsdsl::Interface& dslObj() const
+    {
+        return m_dslObj;
+    }
+
     bool hasVersion() const;
     bool hasFields() const;
     std::vector<std::string> getVersionFields() const;
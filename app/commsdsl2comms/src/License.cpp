@@ -15,13 +15,13 @@
 
 #include "License.h"
 
-#include <fstream>
 #include <vector>
 #include <string>
 
 #include <boost/filesystem.hpp>
 
 #include "Generator.h"
+#include "OutputFile.h"
 #include "common.h"
 
 namespace bf = boost::filesystem;
@@ -45,11 +45,7 @@ bool License::writeTxt() const
         return true;
     }
 
-    std::ofstream stream(filePath);
-    if (!stream) {
-        m_generator.logger().error("Failed to open \"" + filePath + "\" for writing.");
-        return false;
-    }
+    OutputFile stream(m_generator, filePath);
 
     static const std::string Template = 
         "This code has been generated by the commsdsl2comms[1] application and has no license,\n"
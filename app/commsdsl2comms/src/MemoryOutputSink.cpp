@@ -0,0 +1,33 @@
+//
+// Copyright 2018 - 2020 (C). Alex Robenko. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "MemoryOutputSink.h"
+
+namespace commsdsl2comms
+{
+
+bool MemoryOutputSink::createDirImpl(const std::string& path)
+{
+    m_dirs.insert(path);
+    return true;
+}
+
+bool MemoryOutputSink::writeImpl(const std::string& path, const std::string& contents)
+{
+    m_files[path] = contents;
+    return true;
+}
+
+} // namespace commsdsl2comms
@@ -0,0 +1,59 @@
+//
+// Copyright 2018 - 2020 (C). Alex Robenko. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <map>
+#include <set>
+#include <string>
+
+#include "OutputSink.h"
+
+namespace commsdsl2comms
+{
+
+// Keeps the generated files in memory, mapped by their paths.
+class MemoryOutputSink : public OutputSink
+{
+public:
+    using FilesMap = std::map<std::string, std::string>;
+    using DirsSet = std::set<std::string>;
+
+    const FilesMap& files() const
+    {
+        return m_files;
+    }
+
+    const DirsSet& dirs() const
+    {
+        return m_dirs;
+    }
+
+    void clear()
+    {
+        m_files.clear();
+        m_dirs.clear();
+    }
+
+protected:
+    virtual bool createDirImpl(const std::string& path) override final;
+    virtual bool writeImpl(const std::string& path, const std::string& contents) override final;
+
+private:
+    FilesMap m_files;
+    DirsSet m_dirs;
+};
+
+} // namespace commsdsl2comms
@@ -16,7 +16,6 @@
 #include "Message.h"
 
 #include <cassert>
-#include <fstream>
 #include <map>
 #include <algorithm>
 #include <iterator>
@@ -25,6 +24,7 @@
 #include <boost/algorithm/string.hpp>
 
 #include "Generator.h"
+#include "OutputFile.h"
 #include "common.h"
 
 namespace ba = boost::algorithm;
@@ -200,6 +200,8 @@ static const std::string PluginSingleInterfacePimplSrcTemplate(
     "#^#BEGIN_NAMESPACE#$#\n"
     "namespace\n"
     "{\n\n"
+    "namespace #^#CLASS_NAME#$#Props\n"
+    "{\n\n"
     "#^#FIELDS_PROPS#$#\n"
     "QVariantList createProps()\n"
     "{\n"
@@ -207,6 +209,7 @@ static const std::string PluginSingleInterfacePimplSrcTemplate(
     "    #^#PROPS_APPENDS#$#\n"
     "    return props;\n"
     "}\n\n"
+    "} // namespace #^#CLASS_NAME#$#Props\n\n"
     "} // namespace\n\n"
     "class #^#CLASS_NAME#$#Impl : public\n"
     "    comms_champion::ProtocolMessageBase<\n"
@@ -224,7 +227,7 @@ static const std::string PluginSingleInterfacePimplSrcTemplate(
     "protected:\n"
     "    virtual const QVariantList& fieldsPropertiesImpl() const override\n"
     "    {\n"
-    "        static const QVariantList Props = createProps();\n"
+    "        static const QVariantList Props = #^#CLASS_NAME#$#Props::createProps();\n"
     "        return Props;\n"
     "    }\n"
     "};\n\n"
@@ -301,6 +304,8 @@ static const std::string PluginSingleInterfaceSrcTemplate(
     "#^#BEGIN_NAMESPACE#$#\n"
     "namespace\n"
     "{\n\n"
+    "namespace #^#CLASS_NAME#$#Props\n"
+    "{\n\n"
     "#^#FIELDS_PROPS#$#\n"
     "QVariantList createProps()\n"
     "{\n"
@@ -308,6 +313,7 @@ static const std::string PluginSingleInterfaceSrcTemplate(
     "    #^#PROPS_APPENDS#$#\n"
     "    return props;\n"
     "}\n\n"
+    "} // namespace #^#CLASS_NAME#$#Props\n\n"
     "} // namespace\n\n"
     "#^#CLASS_NAME#$#::#^#CLASS_NAME#$#() = default;\n"
     "#^#CLASS_NAME#$#::~#^#CLASS_NAME#$#() = default;\n"
@@ -315,7 +321,7 @@ static const std::string PluginSingleInterfaceSrcTemplate(
     "#^#CLASS_NAME#$#& #^#CLASS_NAME#$#::operator=(#^#CLASS_NAME#$#&&) = default;\n\n"
     "const QVariantList& #^#CLASS_NAME#$#::fieldsPropertiesImpl() const\n"
     "{\n"
-    "    static const QVariantList Props = createProps();\n"
+    "    static const QVariantList Props = #^#CLASS_NAME#$#Props::createProps();\n"
     "    return Props;\n"
     "}\n\n"
     "#^#END_NAMESPACE#$#\n"
@@ -330,6 +336,8 @@ static const std::string PluginMultiInterfaceSrcTemplate(
     "#^#BEGIN_NAMESPACE#$#\n"
     "namespace\n"
     "{\n\n"
+    "namespace #^#CLASS_NAME#$#Props\n"
+    "{\n\n"
     "#^#FIELDS_PROPS#$#\n"
     "QVariantList createProps()\n"
     "{\n"
@@ -337,10 +345,11 @@ static const std::string PluginMultiInterfaceSrcTemplate(
     "    #^#PROPS_APPENDS#$#\n"
     "    return props;\n"
     "}\n\n"
+    "} // namespace #^#CLASS_NAME#$#Props\n\n"
     "} // namespace\n\n"
     "const QVariantList& #^#CLASS_NAME#$#Fields::props()\n"
     "{\n"
-    "    static const QVariantList Props = createProps();\n"
+    "    static const QVariantList Props = #^#CLASS_NAME#$#Props::createProps();\n"
     "    return Props;\n"
     "}\n\n"
     "#^#END_NAMESPACE#$#\n"
@@ -389,6 +398,40 @@ bool Message::doesExist() const
     return exists;
 }
 
+std::size_t Message::minLength() const
+{
+    return
+        std::accumulate(
+            m_fields.begin(), m_fields.end(), std::size_t(0),
+            [](std::size_t soFar, auto& f)
+            {
+                return soFar + f->minLength();
+            });
+}
+
+std::size_t Message::maxLength() const
+{
+    static const std::size_t MaxLen =
+        std::numeric_limits<std::size_t>::max();
+
+    return
+        std::accumulate(
+            m_fields.begin(), m_fields.end(), std::size_t(0),
+            [](std::size_t soFar, auto& f)
+            {
+                if (soFar == MaxLen) {
+                    return MaxLen;
+                }
+
+                auto fLen = f->maxLength();
+                if ((MaxLen - soFar) <= fLen) {
+                    return MaxLen;
+                }
+
+                return soFar + fLen;
+            });
+}
+
 bool Message::write()
 {
     if (!doesExist()) {
@@ -396,10 +439,17 @@ bool Message::write()
     }
 
     return
-        writeProtocolDefinitionCommonFile() &&
-        writeProtocol() &&
-        writePluginHeader() &&
-        writePluginSrc();
+        m_generator.writeCachedMessage(
+            m_externalRef,
+            m_dslObj.definitionDigest(),
+            [this]()
+            {
+                return
+                    writeProtocolDefinitionCommonFile() &&
+                    writeProtocol() &&
+                    writePluginHeader() &&
+                    writePluginSrc();
+            });
 }
 
 std::string Message::getDefaultOptions() const
@@ -518,6 +568,8 @@ bool Message::writeProtocolDefinitionCommonFile()
         fieldsCommon = common::processTemplate(Templ, repl);
     }
 
+    common::mergeIncludes(common::lengthBoundsIncludes(), includes);
+
     auto adjName = m_externalRef + common::commonSuffixStr();
     auto names = m_generator.startMessageProtocolWrite(adjName);
     auto& filePath = names.first;
@@ -545,6 +597,7 @@ bool Message::writeProtocolDefinitionCommonFile()
         "struct #^#NAME#$#Common\n"
         "{\n"
         "    #^#NAME_FUNC#$#\n"
+        "    #^#LENGTH_FUNCS#$#\n"
         "};\n\n"
         "#^#END_NAMESPACE#$#\n";
 
@@ -552,19 +605,17 @@ bool Message::writeProtocolDefinitionCommonFile()
     repl.insert(std::make_pair("GEN_COMMENT", m_generator.fileGeneratedComment()));
     repl.insert(std::make_pair("FIELDS_COMMON", std::move(fieldsCommon)));
     repl.insert(std::make_pair("NAME_FUNC", getCommonNameFunc(msgScope)));
+    repl.insert(std::make_pair("LENGTH_FUNCS", common::lengthBoundsFuncs(minLength(), maxLength(), "the @ref " + msgScope + " message payload")));
     repl.insert(std::make_pair("INCLUDES", common::includesToStatements(includes)));
     repl.insert(std::make_pair("BEGIN_NAMESPACE", std::move(namespaces.first)));
     repl.insert(std::make_pair("END_NAMESPACE", std::move(namespaces.second)));
 
     auto str = common::processTemplate(Templ, repl);
 
-    std::ofstream stream(filePath);
-    if (!stream) {
-        m_generator.logger().error("Failed to open \"" + filePath + "\" for writing.");
-        return false;
-    }
+    OutputFile stream(m_generator, filePath);
     stream << str;
 
+    stream.flush();
     if (!stream.good()) {
         m_generator.logger().error("Failed to write \"" + filePath + "\".");
         return false;
@@ -618,13 +669,10 @@ bool Message::writeProtocol()
 
     auto str = common::processTemplate(Template, replacements);
 
-    std::ofstream stream(filePath);
-    if (!stream) {
-        m_generator.logger().error("Failed to open \"" + filePath + "\" for writing.");
-        return false;
-    }
+    OutputFile stream(m_generator, filePath);
     stream << str;
 
+    stream.flush();
     if (!stream.good()) {
         m_generator.logger().error("Failed to write \"" + filePath + "\".");
         return false;
@@ -672,13 +720,10 @@ bool Message::writePluginHeader()
 
     auto str = common::processTemplate(*templ, replacements);
 
-    std::ofstream stream(filePath);
-    if (!stream) {
-        m_generator.logger().error("Failed to open \"" + filePath + "\" for writing.");
-        return false;
-    }
+    OutputFile stream(m_generator, filePath);
     stream << str;
 
+    stream.flush();
     if (!stream.good()) {
         m_generator.logger().error("Failed to write \"" + filePath + "\".");
         return false;
@@ -741,13 +786,10 @@ bool Message::writePluginSrc()
 
     auto str = common::processTemplate(*templ, replacements);
 
-    std::ofstream stream(filePath);
-    if (!stream) {
-        m_generator.logger().error("Failed to open \"" + filePath + "\" for writing.");
-        return false;
-    }
+    OutputFile stream(m_generator, filePath);
     stream << str;
 
+    stream.flush();
     if (!stream.good()) {
         m_generator.logger().error("Failed to write \"" + filePath + "\".");
         return false;
@@ -801,6 +843,10 @@ std::string Message::getIncludes() const
     };
     common::mergeIncludes(MessageIncludes, includes);
 
+    if (isFixedLayout()) {
+        common::mergeInclude("<iterator>", includes);
+    }
+
     auto commonRefStr = m_externalRef + common::commonSuffixStr();
     common::mergeInclude(m_generator.headerfileForMessage(commonRefStr, false), includes);
 
@@ -1007,43 +1053,22 @@ std::string Message::getLengthCheck() const
     static const std::size_t MaxLen =
         std::numeric_limits<std::size_t>::max();
 
-    auto minLength =
-        std::accumulate(
-            m_fields.begin(), m_fields.end(), std::size_t(0),
-            [](std::size_t soFar, auto& f)
-            {
-                return soFar + f->minLength();
-            });
-    auto maxLength =
-        std::accumulate(
-            m_fields.begin(), m_fields.end(), std::size_t(0),
-            [](std::size_t soFar, auto& f)
-            {
-                if (soFar == MaxLen) {
-                    return MaxLen;
-                }
-
-                auto fLen = f->maxLength();
-                if ((MaxLen - soFar) <= fLen) {
-                    return MaxLen;
-                }
-
-                return soFar + fLen;
-            });
+    auto minLen = minLength();
+    auto maxLen = maxLength();
 
     std::string result =
             "// Compile time check for serialisation length.\n"
             "static const std::size_t MsgMinLen = Base::doMinLength();\n";
-    if (maxLength != MaxLen) {
+    if (maxLen != MaxLen) {
         result += "static const std::size_t MsgMaxLen = Base::doMaxLength();\n";
     }
     result += "static_assert(MsgMinLen == ";
-    result += common::numToString(minLength);
+    result += common::numToString(minLen);
     result += ", \"Unexpected min serialisation length\");\n";
 
-    if (maxLength != MaxLen) {
+    if (maxLen != MaxLen) {
         result += "static_assert(MsgMaxLen == ";
-        result += common::numToString(maxLength);
+        result += common::numToString(maxLen);
         result += ", \"Unexpected max serialisation length\");\n";
     }
     return result;
@@ -1112,6 +1137,10 @@ std::string Message::getReadFunc() const
         return str;
     }
 
+    if (isFixedLayout()) {
+        return Field::getFixedLayoutForFields(m_fields, true, m_generator.versionDependentCode());
+    }
+
     return Field::getReadForFields(m_fields, true, m_generator.versionDependentCode());
 }
 
@@ -1153,6 +1182,14 @@ bool Message::mustImplementReadRefresh() const
     return false;
 }
 
+bool Message::isFixedLayout() const
+{
+    return
+        m_generator.getCustomReadForMessage(m_externalRef).empty() &&
+        m_generator.getCustomWriteForMessage(m_externalRef).empty() &&
+        Field::isFixedLayoutForFields(m_fields);
+}
+
 bool Message::isCustomizable() const
 {
     if (m_generator.customizationLevel() == CustomizationLevel::Full) {
@@ -65,6 +65,14 @@ public:
         return m_externalRef;
     }
 
+    const commsdsl::Message& dslObj() const
+    {
+        return m_dslObj;
+    }
+
+    std::size_t minLength() const;
+    std::size_t maxLength() const;
+
 private:
 
     using GetFieldOptionsFunc = std::string (Field::*)(const std::string&) const;
@@ -94,6 +102,7 @@ private:
     std::string getExtraPublic() const;
 
     bool mustImplementReadRefresh() const;
+    bool isFixedLayout() const;
     bool isCustomizable() const;
     std::string getOptions(GetFieldOptionsFunc func) const;
 
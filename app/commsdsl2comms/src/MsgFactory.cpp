@@ -0,0 +1,327 @@
+//
+// Copyright 2020 (C). Alex Robenko. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "MsgFactory.h"
+
+#include <map>
+#include <algorithm>
+
+#include "Generator.h"
+#include "OutputFile.h"
+#include "common.h"
+
+namespace commsdsl2comms
+{
+
+bool MsgFactory::write(Generator& generator)
+{
+    MsgFactory obj(generator);
+    return obj.writeProtocolDefinition();
+}
+
+MsgFactory::FactoriesList MsgFactory::factories(Generator& generator)
+{
+    FactoriesList result;
+    auto platformsMap = generator.getPlatformsMessages();
+    for (auto& p : platformsMap) {
+        result.emplace_back(p.second.m_all.m_inputName, factoryClassName(p.first, common::emptyString()));
+        result.emplace_back(p.second.m_serverInput.m_inputName, factoryClassName(p.first, common::serverInputStr()));
+        result.emplace_back(p.second.m_clientInput.m_inputName, factoryClassName(p.first, common::clientInputStr()));
+    }
+    return result;
+}
+
+std::string MsgFactory::factoryClassName(const std::string& platform, const std::string& input)
+{
+    return common::nameToClassCopy(platform) + input + "MsgFactory";
+}
+
+bool MsgFactory::writeProtocolDefinition() const
+{
+    auto platformsMap = m_generator.getPlatformsMessages();
+
+    auto writeFileFunc =
+        [this](const Generator::InputMessages& info,
+               const std::string& className,
+               const std::string& platName,
+               const std::string& inputName)
+        {
+            auto startInfo = m_generator.startFactoryProtocolWrite(className);
+            auto& filePath = startInfo.first;
+
+            if (filePath.empty()) {
+                return true;
+            }
+
+            OutputFile stream(m_generator, filePath);
+
+            common::StringsList includes;
+            common::mergeInclude("<cstddef>", includes);
+            common::mergeInclude("<memory>", includes);
+            common::mergeInclude("<new>", includes);
+            common::mergeInclude("comms/util/Tuple.h", includes);
+            common::mergeInclude(m_generator.headerfileForInput(info.m_inputName, false), includes);
+            common::mergeInclude(m_generator.headerfileForRoot(common::msgIdEnumNameStr(), false), includes);
+
+            common::ReplacementMap replacements;
+            auto namespaces = m_generator.namespacesForFactory();
+            replacements.insert(std::make_pair("GEN_COMMENT", m_generator.fileGeneratedComment()));
+            replacements.insert(std::make_pair("BEG_NAMESPACE", std::move(namespaces.first)));
+            replacements.insert(std::make_pair("END_NAMESPACE", std::move(namespaces.second)));
+            replacements.insert(std::make_pair("INCLUDES", common::includesToStatements(includes)));
+            replacements.insert(std::make_pair("CLASS", getFactoryClass(className, info.m_inputName, info.m_messages)));
+
+            if (!platName.empty()) {
+                replacements.insert(std::make_pair("PLAT_NAME", '\"' + platName + "\" "));
+            }
+
+            replacements.insert(std::make_pair("INPUT", inputName + " input "));
+
+            static const std::string Templ =
+                "#^#GEN_COMMENT#$#\n"
+                "/// @file\n"
+                "/// @brief Contains factory of #^#PLAT_NAME#$##^#INPUT#$#messages.\n\n"
+                "#pragma once\n\n"
+                "#^#INCLUDES#$#\n"
+                "#^#BEG_NAMESPACE#$#\n"
+                "#^#CLASS#$#\n"
+                "#^#END_NAMESPACE#$#\n";
+
+            auto str = common::processTemplate(Templ, replacements);
+            stream << str;
+
+            stream.flush();
+            if (!stream.good()) {
+                m_generator.logger().error("Failed to write \"" + filePath + "\".");
+                return false;
+            }
+            return true;
+        };
+
+    for (auto& p : platformsMap) {
+        auto allName = factoryClassName(p.first, common::emptyString());
+        auto serverName = factoryClassName(p.first, common::serverInputStr());
+        auto clientName = factoryClassName(p.first, common::clientInputStr());
+
+        if (!writeFileFunc(p.second.m_all, allName, p.first, "all")) {
+            return false;
+        }
+
+        if (!writeFileFunc(p.second.m_serverInput, serverName, p.first, "server")) {
+            return false;
+        }
+
+        if (!writeFileFunc(p.second.m_clientInput, clientName, p.first, "client")) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+std::string MsgFactory::getFactoryClass(
+    const std::string& className,
+    const std::string& inputName,
+    const DslMessagesList& messages) const
+{
+    using MsgMap = std::map<std::uintmax_t, DslMessagesList>;
+    MsgMap msgMap;
+    for (auto& m : messages) {
+        msgMap[m.id()].push_back(m);
+    }
+
+    bool hasUniqueIds =
+        std::all_of(
+            msgMap.begin(), msgMap.end(),
+            [](auto& elem)
+            {
+                return elem.second.size() == 1U;
+            });
+
+    common::StringsList createCases;
+    common::StringsList inPlaceCases;
+    common::StringsList countCases;
+    for (auto& elem : msgMap) {
+        auto& msgList = elem.second;
+        assert(!msgList.empty());
+        auto idStr = m_generator.messageIdStr(elem.first);
+
+        common::StringsList idxCases;
+        common::StringsList inPlaceIdxCases;
+        for (auto idx = 0U; idx < msgList.size(); ++idx) {
+            static const std::string IdxCaseTempl =
+                "case #^#IDX#$#: return MsgPtr(new #^#MSG_TYPE#$#<TInterface, TProtOptions>);";
+
+            static const std::string InPlaceIdxCaseTempl =
+                "case #^#IDX#$#: return new (place) #^#MSG_TYPE#$#<TInterface, TProtOptions>;";
+
+            common::ReplacementMap repl;
+            repl.insert(std::make_pair("IDX", common::numToString(idx)));
+            repl.insert(std::make_pair("MSG_TYPE", m_generator.scopeForMessage(msgList[idx].externalRef(), true, true)));
+            idxCases.push_back(common::processTemplate(IdxCaseTempl, repl));
+            inPlaceIdxCases.push_back(common::processTemplate(InPlaceIdxCaseTempl, repl));
+        }
+
+        static const std::string CreateCaseTempl =
+            "case #^#MSG_ID#$#:\n"
+            "    switch (idx) {\n"
+            "    #^#IDX_CASES#$#\n"
+            "    default: break;\n"
+            "    };\n"
+            "    break;";
+
+        common::ReplacementMap repl;
+        repl.insert(std::make_pair("MSG_ID", idStr));
+        repl.insert(std::make_pair("IDX_CASES", common::listToString(idxCases, "\n", common::emptyString())));
+        createCases.push_back(common::processTemplate(CreateCaseTempl, repl));
+
+        repl["IDX_CASES"] = common::listToString(inPlaceIdxCases, "\n", common::emptyString());
+        inPlaceCases.push_back(common::processTemplate(CreateCaseTempl, repl));
+
+        countCases.push_back(
+            "case " + idStr + ": return " + common::numToString(msgList.size()) + ";");
+    }
+
+    static const std::string Templ =
+        "/// @brief Message factory class for #^#NAME#$#.\n"
+        "/// @details Creates message objects using @b switch statement (on message ID),\n"
+        "///     without any compile time meta-programming over the messages bundle\n"
+        "///     and without any runtime search of the right constructor.\n"
+        "///     Exposes the same API as @b comms::MsgFactory so it can be used as\n"
+        "///     its replacement.\n"
+        "///     The ID layers of the generated frames use it to create the\n"
+        "///     messages when the frame is defined with the same messages bundle\n"
+        "///     and the messages are dynamically allocated.\n"
+        "///     The createMsgInPlace() function constructs the message in the\n"
+        "///     provided storage instead of allocating it.\n"
+        "/// @tparam TInterface Interface class of all the messages.\n"
+        "/// @tparam TProtOptions Protocol options struct used for the application,\n"
+        "///     like @ref #^#DEFAULT_OPTIONS#$#.\n"
+        "/// @headerfile #^#HEADERFILE#$#\n"
+        "template <typename TInterface, typename TProtOptions = #^#DEFAULT_OPTIONS#$#>\n"
+        "class #^#CLASS_NAME#$#\n"
+        "{\n"
+        "public:\n"
+        "    /// @brief Type of the common base class of all the messages.\n"
+        "    using Message = TInterface;\n\n"
+        "    /// @brief Type of the message ID when passed as a parameter.\n"
+        "    using MsgIdParamType = typename Message::MsgIdParamType;\n\n"
+        "    /// @brief Smart pointer to the created message object.\n"
+        "    using MsgPtr = std::unique_ptr<Message>;\n\n"
+        "    /// @brief Create message object given the ID of the message.\n"
+        "    /// @param[in] id ID of the message.\n"
+        "    /// @param[in] idx Index of the message among messages with the same ID.\n"
+        "    /// @return Smart pointer to the created object, empty in case the\n"
+        "    ///     message with provided ID and index is not known.\n"
+        "    static MsgPtr createMsg(MsgIdParamType id, unsigned idx = 0U)\n"
+        "    {\n"
+        "        static_cast<void>(idx);\n"
+        "        switch (id) {\n"
+        "        #^#CREATE_CASES#$#\n"
+        "        default: break;\n"
+        "        };\n\n"
+        "        return MsgPtr();\n"
+        "    }\n\n"
+        "    #^#IN_PLACE#$#\n"
+        "    /// @brief Get number of message types with the same ID.\n"
+        "    static std::size_t msgCount(MsgIdParamType id)\n"
+        "    {\n"
+        "        switch (id) {\n"
+        "        #^#COUNT_CASES#$#\n"
+        "        default: break;\n"
+        "        };\n\n"
+        "        return 0U;\n"
+        "    }\n\n"
+        "    /// @brief Compile time inquiry whether all the message types have unique IDs.\n"
+        "    static constexpr bool hasUniqueIds()\n"
+        "    {\n"
+        "        return #^#UNIQUE_IDS#$#;\n"
+        "    }\n"
+        "};\n\n"
+        "/// @brief Message factory class for #^#NAME#$#.\n"
+        "/// @details Same as @ref #^#CLASS_NAME#$#, but passing\n"
+        "///     @ref #^#DEFAULT_OPTIONS#$# as template parameter.\n"
+        "/// @note Defined in #^#HEADERFILE#$#\n"
+        "template <typename TInterface>\n"
+        "using #^#CLASS_NAME#$#DefaultOptions =\n"
+        "    #^#CLASS_NAME#$#<TInterface, #^#DEFAULT_OPTIONS#$#>;\n"
+        "#^#IN_PLACE_STORAGE#$#";
+
+    std::string inPlace;
+    std::string inPlaceStorage;
+    if (!messages.empty()) {
+        static const std::string InPlaceTempl =
+            "/// @brief Construct message object in the provided storage.\n"
+            "/// @details Same as createMsg(), but uses placement @b new instead\n"
+            "///     of dynamic memory allocation. The caller is responsible to\n"
+            "///     destruct the returned object before the storage is reused.\n"
+            "/// @param[in] id ID of the message.\n"
+            "/// @param[in] idx Index of the message among messages with the same ID.\n"
+            "/// @param[in] place Storage to construct the message in, expected to be\n"
+            "///     @ref #^#CLASS_NAME#$#InPlaceStorage or suitable for any of the messages.\n"
+            "/// @return Pointer to the constructed object, @b nullptr in case the\n"
+            "///     message with provided ID and index is not known.\n"
+            "static Message* createMsgInPlace(MsgIdParamType id, unsigned idx, void* place)\n"
+            "{\n"
+            "    static_cast<void>(idx);\n"
+            "    switch (id) {\n"
+            "    #^#IN_PLACE_CASES#$#\n"
+            "    default: break;\n"
+            "    };\n\n"
+            "    return nullptr;\n"
+            "}\n";
+
+        static const std::string StorageTempl =
+            "/// @brief Storage suitable for in-place construction of any message\n"
+            "///     created by @ref #^#CLASS_NAME#$#.\n"
+            "/// @see #^#CLASS_NAME#$#::createMsgInPlace()\n"
+            "/// @note Defined in #^#HEADERFILE#$#\n"
+            "template <typename TInterface, typename TProtOptions = #^#DEFAULT_OPTIONS#$#>\n"
+            "using #^#CLASS_NAME#$#InPlaceStorage =\n"
+            "    typename comms::util::TupleAsAlignedUnion<\n"
+            "        #^#INPUT#$#<TInterface, TProtOptions>\n"
+            "    >::Type;\n";
+
+        common::ReplacementMap repl;
+        repl.insert(std::make_pair("INPUT", m_generator.scopeForInput(inputName, true, true)));
+        repl.insert(std::make_pair("IN_PLACE_CASES", common::listToString(inPlaceCases, "\n", common::emptyString())));
+        repl.insert(std::make_pair("CLASS_NAME", className));
+        repl.insert(std::make_pair("DEFAULT_OPTIONS", m_generator.scopeForOptions(common::defaultOptionsStr(), true, true)));
+        repl.insert(std::make_pair("HEADERFILE", m_generator.headerfileForFactory(className)));
+        inPlace = common::processTemplate(InPlaceTempl, repl);
+        inPlaceStorage = '\n' + common::processTemplate(StorageTempl, repl);
+    }
+
+    std::string name = className;
+    name.resize(name.size() - std::string("MsgFactory").size());
+    if (name.empty()) {
+        name = "all the";
+    }
+    name += " messages";
+
+    common::ReplacementMap repl;
+    repl.insert(std::make_pair("NAME", std::move(name)));
+    repl.insert(std::make_pair("CLASS_NAME", className));
+    repl.insert(std::make_pair("CREATE_CASES", common::listToString(createCases, "\n", common::emptyString())));
+    repl.insert(std::make_pair("COUNT_CASES", common::listToString(countCases, "\n", common::emptyString())));
+    repl.insert(std::make_pair("UNIQUE_IDS", common::boolToString(hasUniqueIds)));
+    repl.insert(std::make_pair("IN_PLACE", std::move(inPlace)));
+    repl.insert(std::make_pair("IN_PLACE_STORAGE", std::move(inPlaceStorage)));
+    repl.insert(std::make_pair("DEFAULT_OPTIONS", m_generator.scopeForOptions(common::defaultOptionsStr(), true, true)));
+    repl.insert(std::make_pair("HEADERFILE", m_generator.headerfileForFactory(className)));
+    return common::processTemplate(Templ, repl);
+}
+
+} // namespace commsdsl2comms
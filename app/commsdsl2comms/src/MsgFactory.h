@@ -0,0 +1,55 @@
+//
+// Copyright 2020 (C). Alex Robenko. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "commsdsl/Message.h"
+
+#include "common.h"
+
+namespace commsdsl2comms
+{
+
+class Generator;
+class MsgFactory
+{
+public:
+    // Pairs of input messages name (as used by Generator::headerfileForInput())
+    // and name of the generated factory class for them.
+    using FactoriesList = std::vector<std::pair<std::string, std::string> >;
+
+    static bool write(Generator& generator);
+    static FactoriesList factories(Generator& generator);
+
+private:
+    using DslMessagesList = std::vector<commsdsl::Message>;
+
+    explicit MsgFactory(Generator& generator) : m_generator(generator) {}
+
+    static std::string factoryClassName(const std::string& platform, const std::string& input);
+    bool writeProtocolDefinition() const;
+    std::string getFactoryClass(
+        const std::string& className,
+        const std::string& inputName,
+        const DslMessagesList& messages) const;
+
+    Generator& m_generator;
+};
+
+} // namespace commsdsl2comms
@@ -15,12 +15,11 @@
 
 #include "MsgId.h"
 
-#include <fstream>
-
 #include <boost/filesystem.hpp>
 #include <boost/algorithm/string.hpp>
 
 #include "Generator.h"
+#include "OutputFile.h"
 #include "common.h"
 #include "EnumField.h"
 
@@ -67,11 +66,7 @@ bool MsgId::writeDefinition() const
         return true;
     }
 
-    std::ofstream stream(filePath);
-    if (!stream) {
-        m_generator.logger().error("Failed to open \"" + filePath + "\" for writing.");
-        return false;
-    }
+    OutputFile stream(m_generator, filePath);
 
 
     common::ReplacementMap replacements;
@@ -445,6 +445,7 @@ common::StringsList Namespace::pluginCommonSources() const
     }
 
     result.reserve(result.size() + m_accessedFields.size() + m_messages.size());
+    auto fieldsBegin = result.size();
     std::transform(
         m_accessedFields.begin(), m_accessedFields.end(), std::back_inserter(result),
         [&prefix](auto& f)
@@ -452,6 +453,9 @@ common::StringsList Namespace::pluginCommonSources() const
             return prefix + common::fieldStr() + '/' + common::nameToClassCopy(f.first->name()) + common::srcSuffix();
         });
 
+    // The accessed fields are ordered by their addresses, sort them to keep the output stable
+    std::sort(result.begin() + fieldsBegin, result.end());
+
     for (auto& i : m_interfaces) {
         result.push_back(prefix + common::nameToClassCopy(i->name()) + common::srcSuffix());
     }
@@ -0,0 +1,59 @@
+//
+// Copyright 2018 - 2020 (C). Alex Robenko. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "OutputFile.h"
+
+#include "Generator.h"
+
+namespace commsdsl2comms
+{
+
+OutputFile::OutputFile(Generator& generator, const std::string& path)
+  : std::ostream(nullptr),
+    m_path(path),
+    m_buf(generator, m_path)
+{
+    rdbuf(&m_buf);
+}
+
+OutputFile::~OutputFile()
+{
+    if (!m_buf.written()) {
+        flush();
+    }
+}
+
+OutputFile::Buf::Buf(Generator& generator, const std::string& path)
+  : m_generator(generator),
+    m_path(path)
+{
+}
+
+int OutputFile::Buf::sync()
+{
+    auto contents = str();
+    if (m_writtenSize == contents.size()) {
+        return 0;
+    }
+
+    m_writtenSize = contents.size();
+    if (!m_generator.writeOutput(m_path, contents)) {
+        return -1;
+    }
+
+    return 0;
+}
+
+} // namespace commsdsl2comms
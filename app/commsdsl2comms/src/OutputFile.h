@@ -0,0 +1,60 @@
+//
+// Copyright 2018 - 2020 (C). Alex Robenko. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <ostream>
+#include <sstream>
+#include <string>
+
+namespace commsdsl2comms
+{
+
+class Generator;
+
+// Stream accumulating the contents of the output file. The contents are
+// passed to the output sink on flush() (and on destruction if not flushed
+// yet), the failure of the sink sets the badbit of the stream.
+class OutputFile : public std::ostream
+{
+public:
+    OutputFile(Generator& generator, const std::string& path);
+    ~OutputFile();
+
+private:
+    class Buf : public std::stringbuf
+    {
+    public:
+        Buf(Generator& generator, const std::string& path);
+
+        bool written() const
+        {
+            return m_writtenSize == str().size();
+        }
+
+    protected:
+        virtual int sync() override;
+
+    private:
+        Generator& m_generator;
+        const std::string& m_path;
+        std::size_t m_writtenSize = static_cast<std::size_t>(-1);
+    };
+
+    std::string m_path;
+    Buf m_buf;
+};
+
+} // namespace commsdsl2comms
@@ -0,0 +1,44 @@
+//
+// Copyright 2018 - 2020 (C). Alex Robenko. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <string>
+
+namespace commsdsl2comms
+{
+
+// Destination of all the files emitted by the generator.
+class OutputSink
+{
+public:
+    virtual ~OutputSink() = default;
+
+    bool createDir(const std::string& path)
+    {
+        return createDirImpl(path);
+    }
+
+    bool write(const std::string& path, const std::string& contents)
+    {
+        return writeImpl(path, contents);
+    }
+
+protected:
+    virtual bool createDirImpl(const std::string& path) = 0;
+    virtual bool writeImpl(const std::string& path, const std::string& contents) = 0;
+};
+
+} // namespace commsdsl2comms
@@ -16,12 +16,12 @@
 #include "Plugin.h"
 
 #include <cassert>
-#include <fstream>
 
 #include <boost/algorithm/string.hpp>
 #include <boost/filesystem.hpp>
 
 #include "Generator.h"
+#include "OutputFile.h"
 
 namespace ba = boost::algorithm;
 namespace bf = boost::filesystem;
@@ -142,13 +142,10 @@ bool Plugin::writeProtocolHeader()
 
     std::string str = common::processTemplate(Templ, replacements);
 
-    std::ofstream stream(filePath);
-    if (!stream) {
-        m_generator.logger().error("Failed to open \"" + filePath + "\" for writing.");
-        return false;
-    }
+    OutputFile stream(m_generator, filePath);
     stream << str;
 
+    stream.flush();
     if (!stream.good()) {
         m_generator.logger().error("Failed to write \"" + filePath + "\".");
         return false;
@@ -388,13 +385,10 @@ bool Plugin::writeProtocolSrc()
 
     std::string str = common::processTemplate(Templ, replacements);
 
-    std::ofstream stream(filePath);
-    if (!stream) {
-        m_generator.logger().error("Failed to open \"" + filePath + "\" for writing.");
-        return false;
-    }
+    OutputFile stream(m_generator, filePath);
     stream << str;
 
+    stream.flush();
     if (!stream.good()) {
         m_generator.logger().error("Failed to write \"" + filePath + "\".");
         return false;
@@ -455,13 +449,10 @@ bool Plugin::writePluginHeader()
 
     std::string str = common::processTemplate(Templ, replacements);
 
-    std::ofstream stream(filePath);
-    if (!stream) {
-        m_generator.logger().error("Failed to open \"" + filePath + "\" for writing.");
-        return false;
-    }
+    OutputFile stream(m_generator, filePath);
     stream << str;
 
+    stream.flush();
     if (!stream.good()) {
         m_generator.logger().error("Failed to write \"" + filePath + "\".");
         return false;
@@ -539,13 +530,10 @@ bool Plugin::writePluginSrc()
 
     std::string str = common::processTemplate(Templ, replacements);
 
-    std::ofstream stream(filePath);
-    if (!stream) {
-        m_generator.logger().error("Failed to open \"" + filePath + "\" for writing.");
-        return false;
-    }
+    OutputFile stream(m_generator, filePath);
     stream << str;
 
+    stream.flush();
     if (!stream.good()) {
         m_generator.logger().error("Failed to write \"" + filePath + "\".");
         return false;
@@ -583,13 +571,10 @@ bool Plugin::writePluginJson()
 
     std::string str = common::processTemplate(Templ, replacements);
 
-    std::ofstream stream(filePath);
-    if (!stream) {
-        m_generator.logger().error("Failed to open \"" + filePath + "\" for writing.");
-        return false;
-    }
+    OutputFile stream(m_generator, filePath);
     stream << str;
 
+    stream.flush();
     if (!stream.good()) {
         m_generator.logger().error("Failed to write \"" + filePath + "\".");
         return false;
@@ -618,13 +603,10 @@ bool Plugin::writePluginConfig()
     replacements.insert(std::make_pair("ID", pluginId()));
     std::string str = common::processTemplate(Templ, replacements);
 
-    std::ofstream stream(filePath);
-    if (!stream) {
-        m_generator.logger().error("Failed to open \"" + filePath + "\" for writing.");
-        return false;
-    }
+    OutputFile stream(m_generator, filePath);
     stream << str;
 
+    stream.flush();
     if (!stream.good()) {
         m_generator.logger().error("Failed to write \"" + filePath + "\".");
         return false;
@@ -685,13 +667,10 @@ bool Plugin::writeVersionConfigWidgetHeader()
 
     std::string str = common::processTemplate(Templ, replacements);
 
-    std::ofstream stream(filePath);
-    if (!stream) {
-        m_generator.logger().error("Failed to open \"" + filePath + "\" for writing.");
-        return false;
-    }
+    OutputFile stream(m_generator, filePath);
     stream << str;
 
+    stream.flush();
     if (!stream.good()) {
         m_generator.logger().error("Failed to write \"" + filePath + "\".");
         return false;
@@ -765,13 +744,10 @@ bool Plugin::writeVersionConfigWidgetSrc()
 
     std::string str = common::processTemplate(Templ, replacements);
 
-    std::ofstream stream(filePath);
-    if (!stream) {
-        m_generator.logger().error("Failed to open \"" + filePath + "\" for writing.");
-        return false;
-    }
+    OutputFile stream(m_generator, filePath);
     stream << str;
 
+    stream.flush();
     if (!stream.good()) {
         m_generator.logger().error("Failed to write \"" + filePath + "\".");
         return false;
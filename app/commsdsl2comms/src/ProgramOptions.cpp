@@ -17,6 +17,7 @@
 #include <iostream>
 #include <cassert>
 #include <vector>
+#include <algorithm>
 
 namespace po = boost::program_options;
 namespace commsdsl2comms
@@ -52,6 +53,7 @@ const std::string ProtocolVerStr("protocol-version");
 const std::string FullProtocolVerStr(ProtocolVerStr + ",V");
 const std::string MinRemoteVerStr("min-remote-version");
 const std::string FullMinRemoteVerStr(MinRemoteVerStr + ",m");
+const std::string FixedVerStr("fixed-version");
 const std::string InputFileStr("input-file");
 const std::string CommsChampionTagStr("cc-tag");
 const std::string WarnAsErrStr("warn-as-err");
@@ -61,6 +63,14 @@ const std::string CustomizationStr("customization");
 const std::string GeneratedPluginBuildEnableStr("enable-plugin-build-by-default");
 const std::string GeneratedTestsBuildEnableStr("enable-tests-build-by-default");
 const std::string ExtraMessagesBundleStr("extra-messages-bundle");
+const std::string VariantDispatchStr("variant-dispatch");
+const std::string ExplicitInstantiationStr("explicit-instantiation");
+const std::string IncludeReportStr("include-report");
+const std::string RenderCacheStr("render-cache");
+const std::string WatchStr("watch");
+const std::string WatchIntervalStr("watch-interval");
+const std::string WatchMaxRunsStr("watch-max-runs");
+const std::string PerfReportStr("perf-report");
 
 po::options_description createDescription()
 {
@@ -86,6 +96,11 @@ po::options_description createDescription()
             "make this information available in the generated code")
         (FullMinRemoteVerStr.c_str(), po::value<unsigned>()->default_value(0U),
             "Set minimal supported remote version. Defaults to 0.")
+        (FixedVerStr.c_str(), po::value<unsigned>(),
+            "Generate code for a single protocol version. All the version dependent existence and "
+            "validity checks are resolved at generation time and the generated code doesn't "
+            "carry any runtime version information. Cannot be used together with "
+            "\"force-schema-version\" and \"min-remote-version\" options.")
         (CustomizationStr.c_str(), po::value<std::string>()->default_value("limited"),
             "Allowed customization level of generated code. Supported values are:\n"
             "  * \"full\" - for full customization of all fields and messages\n"
@@ -117,6 +132,44 @@ po::options_description createDescription()
             "as defined in the CommsDSL. In case the message resides in a namespace its name must be "
             "specified in the same way as being referenced in CommsDSL (\'Namespace.MessageName\'). This "
             "option can be used multiple times for multiple definitions of such bundles.")
+        (VariantDispatchStr.c_str(),
+            "Generate extra \"dispatch\" protocol definition headers, which read the input messages "
+            "into std::variant and dispatch them to the handler using static visitation. Allows "
+            "message handling without virtual functions and dynamic memory allocation. The "
+            "generated headers require C++17.")
+        (ExplicitInstantiationStr.c_str(),
+            "Generate extra \"instantiation\" protocol definition headers with macros declaring "
+            "(extern template) and defining explicit instantiations of all the messages and frames "
+            "for the interface and options chosen by the application, as well as optional "
+            "\"instantiation\" static library target in the generated CMake project, which compiles "
+            "them in multiple source files.")
+        (IncludeReportStr.c_str(),
+            "Generate extra \"include_report\" target in the generated CMake project, which "
+            "preprocesses every protocol definition header and reports its preprocessed size "
+            "to allow tracking of the compilation cost over time.")
+        (RenderCacheStr.c_str(), po::value<std::string>()->default_value(std::string()),
+            "Directory of the persistent cache of the rendered field, message and frame files. "
+            "The elements whose definitions, as well as the definitions they depend on, options "
+            "and code input files, haven't changed since the previous run reuse the cached files "
+            "instead of being rendered again. The cache entries not used by the run are removed. "
+            "Empty means no caching.")
+        (WatchStr.c_str(),
+            "Don't exit after the generation, keep watching the schema files and code input "
+            "directories, and generate again on every change of their contents. All the schema "
+            "files are parsed again, but only the messages affected by the change are rendered "
+            "again and only the output files whose contents have changed are rewritten. Unless "
+            "\"--render-cache\" is used, the render cache is kept in a temporary directory for "
+            "the watch session.")
+        (WatchIntervalStr.c_str(), po::value<unsigned>()->default_value(500U),
+            "Interval in milliseconds between checks for changes in watch mode.")
+        (WatchMaxRunsStr.c_str(), po::value<unsigned>()->default_value(0U),
+            "Exit watch mode after the specified number of generations, the exit status "
+            "reflects the result of the last one. 0 means watching until interrupted.")
+        (PerfReportStr.c_str(),
+            "Print report of the schema constructs which are expensive to handle at runtime, "
+            "such as variants without key fields, lists of variable length elements, "
+            "nested optional fields, fields and messages of unlimited length, and frames "
+            "with message ID at variable offset, together with suggested alternatives.")
     ;
     return desc;
 }
@@ -168,6 +221,31 @@ void ProgramOptions::parse(int argc, const char* argv[])
             .run();
     po::store(parseResult, m_vm);
     po::notify(m_vm);
+
+    // Options which don't influence the contents of the generated files
+    static const std::vector<std::string> KeyIgnoredOptions = {
+        OutputDirStr,
+        RenderCacheStr,
+        QuietStr,
+        WatchStr,
+        WatchIntervalStr,
+        WatchMaxRunsStr,
+        PerfReportStr,
+    };
+
+    m_renderCacheKey.clear();
+    for (auto& o : parseResult.options) {
+        if (std::find(KeyIgnoredOptions.begin(), KeyIgnoredOptions.end(), o.string_key) != KeyIgnoredOptions.end()) {
+            continue;
+        }
+
+        m_renderCacheKey += o.string_key;
+        for (auto& v : o.value) {
+            m_renderCacheKey += '=';
+            m_renderCacheKey += v;
+        }
+        m_renderCacheKey += '\n';
+    }
 }
 
 void ProgramOptions::printHelp(std::ostream& out)
@@ -200,6 +278,41 @@ bool ProgramOptions::versionIndependentCodeRequested() const
     return 0 < m_vm.count(VersionIndependentCodeStr);
 }
 
+bool ProgramOptions::variantDispatchRequested() const
+{
+    return 0 < m_vm.count(VariantDispatchStr);
+}
+
+bool ProgramOptions::explicitInstantiationRequested() const
+{
+    return 0 < m_vm.count(ExplicitInstantiationStr);
+}
+
+bool ProgramOptions::includeReportRequested() const
+{
+    return 0 < m_vm.count(IncludeReportStr);
+}
+
+bool ProgramOptions::watchRequested() const
+{
+    return 0 < m_vm.count(WatchStr);
+}
+
+unsigned ProgramOptions::getWatchInterval() const
+{
+    return m_vm[WatchIntervalStr].as<unsigned>();
+}
+
+unsigned ProgramOptions::getWatchMaxRuns() const
+{
+    return m_vm[WatchMaxRunsStr].as<unsigned>();
+}
+
+bool ProgramOptions::perfReportRequested() const
+{
+    return 0 < m_vm.count(PerfReportStr);
+}
+
 bool ProgramOptions::pluginBuildEnabledByDefault() const
 {
     return m_vm[GeneratedPluginBuildEnableStr].as<bool>();
@@ -236,6 +349,16 @@ std::string ProgramOptions::getOutputDirectory() const
     return m_vm[OutputDirStr].as<std::string>();
 }
 
+std::string ProgramOptions::getRenderCacheDirectory() const
+{
+    return m_vm[RenderCacheStr].as<std::string>();
+}
+
+const std::string& ProgramOptions::renderCacheKey() const
+{
+    return m_renderCacheKey;
+}
+
 std::vector<std::string> ProgramOptions::getCodeInputDirectories() const
 {
     if (m_vm.count(CodeInputDirStr) == 0U) {
@@ -270,6 +393,16 @@ unsigned ProgramOptions::getMinRemoteVersion() const
     return m_vm[MinRemoteVerStr].as<unsigned>();
 }
 
+bool ProgramOptions::hasFixedVersion() const
+{
+    return 0U < m_vm.count(FixedVerStr);
+}
+
+unsigned ProgramOptions::getFixedVersion() const
+{
+    return m_vm[FixedVerStr].as<unsigned>();
+}
+
 std::string ProgramOptions::getCommsChampionTag() const
 {
     return m_vm[CommsChampionTagStr].as<std::string>();
@@ -34,6 +34,13 @@ public:
     bool versionRequested() const;
     bool warnAsErrRequested() const;
     bool versionIndependentCodeRequested() const;
+    bool variantDispatchRequested() const;
+    bool explicitInstantiationRequested() const;
+    bool includeReportRequested() const;
+    bool watchRequested() const;
+    unsigned getWatchInterval() const;
+    unsigned getWatchMaxRuns() const;
+    bool perfReportRequested() const;
     bool pluginBuildEnabledByDefault() const;
     bool testsBuildEnabledByDefault() const;
 
@@ -42,11 +49,15 @@ public:
     std::vector<std::string> getFiles() const;
     std::string getOutputDirectory() const;
     std::vector<std::string> getCodeInputDirectories() const;
+    std::string getRenderCacheDirectory() const;
+    const std::string& renderCacheKey() const;
     bool hasNamespaceOverride() const;
     std::string getNamespace() const;
     bool hasForcedSchemaVersion() const;
     unsigned getForcedSchemaVersion() const;
     unsigned getMinRemoteVersion() const;
+    bool hasFixedVersion() const;
+    unsigned getFixedVersion() const;
     std::string getCommsChampionTag() const;
     std::vector<std::string> getPlugins() const;
     std::string getCustomizationLevel() const;
@@ -56,6 +67,7 @@ public:
     
 private:
     boost::program_options::variables_map m_vm;
+    std::string m_renderCacheKey;
 };
 
 } // namespace commsdsl2comms
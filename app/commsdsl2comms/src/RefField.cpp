@@ -395,6 +395,18 @@ std::string RefField::getExtraRefToCommonDefinitionImpl(const std::string& fullS
     return fieldPtr->getExtraRefToCommonDefinition(fullScope);
 }
 
+bool RefField::isFixedLayoutImpl() const
+{
+    auto refObj = refFieldDslObj().field();
+    auto fieldPtr = generator().findField(refObj.externalRef());
+    if (fieldPtr == nullptr) {
+        assert(!"Unexpected");
+        return false;
+    }
+
+    return fieldPtr->isFixedLayout();
+}
+
 std::string RefField::getOpts(const std::string& scope) const
 {
     StringsList options;
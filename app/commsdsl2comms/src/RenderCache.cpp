@@ -0,0 +1,393 @@
+//
+// Copyright 2018 - 2020 (C). Alex Robenko. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "RenderCache.h"
+
+#include <fstream>
+#include <iomanip>
+#include <iterator>
+#include <sstream>
+#include <algorithm>
+#include <cassert>
+#include <cctype>
+
+#include "commsdsl/version.h"
+#include "Generator.h"
+
+namespace bf = boost::filesystem;
+
+namespace commsdsl2comms
+{
+
+namespace
+{
+
+const std::uint64_t InitialDigest = 14695981039346656037ULL;
+const std::uint64_t DigestPrime = 1099511628211ULL;
+const std::string FilesDirStr("files");
+const std::string ManifestFileStr("manifest.txt");
+const std::string FileEntryStr("file ");
+const std::string FieldEntryStr("field ");
+const std::string DependsEntryStr("depends ");
+
+std::uint64_t updateDigest(std::uint64_t digest, const char* data, std::size_t len)
+{
+    for (std::size_t idx = 0U; idx < len; ++idx) {
+        digest ^= static_cast<std::uint8_t>(data[idx]);
+        digest *= DigestPrime;
+    }
+
+    // Separator to distinguish between "ab" + "c" and "a" + "bc"
+    digest ^= 0xffU;
+    digest *= DigestPrime;
+    return digest;
+}
+
+std::uint64_t updateDigest(std::uint64_t digest, const std::string& str)
+{
+    return updateDigest(digest, str.c_str(), str.size());
+}
+
+std::uint64_t updateDigest(std::uint64_t digest, std::uint64_t value)
+{
+    char data[sizeof(value)];
+    for (auto& b : data) {
+        b = static_cast<char>(value & 0xffU);
+        value >>= 8U;
+    }
+    return updateDigest(digest, &data[0], sizeof(data));
+}
+
+bool readFile(const bf::path& path, std::string& data)
+{
+    std::ifstream stream(path.string(), std::ios_base::binary);
+    if (!stream) {
+        return false;
+    }
+
+    data.assign(std::istreambuf_iterator<char>(stream), std::istreambuf_iterator<char>());
+    return true;
+}
+
+bool isEntryName(const std::string& name)
+{
+    static const std::size_t EntryNameLen = 16U;
+    return
+        (name.size() == EntryNameLen) &&
+        std::all_of(
+            name.begin(), name.end(),
+            [](char c)
+            {
+                return std::isxdigit(static_cast<unsigned char>(c)) != 0;
+            });
+}
+
+bool writeFile(const bf::path& path, const std::string& data)
+{
+    boost::system::error_code ec;
+    bf::create_directories(path.parent_path(), ec);
+    if (ec) {
+        return false;
+    }
+
+    std::ofstream stream(path.string(), std::ios_base::binary | std::ios_base::trunc);
+    stream << data;
+    stream.flush();
+    return stream.good();
+}
+
+} // namespace
+
+RenderCache::RenderCache(
+    Generator& generator,
+    const bf::path& dir,
+    const bf::path& outputDir)
+  : m_generator(generator),
+    m_dir(dir),
+    m_outputDir(outputDir)
+{
+}
+
+bool RenderCache::prepare(
+    std::uint64_t commonDigest,
+    const std::string& optionsKey,
+    const std::vector<bf::path>& codeInputDirs)
+{
+    auto digest = InitialDigest;
+    digest = updateDigest(digest, static_cast<std::uint64_t>(commsdsl::versionMajor()));
+    digest = updateDigest(digest, static_cast<std::uint64_t>(commsdsl::versionMinor()));
+    digest = updateDigest(digest, static_cast<std::uint64_t>(commsdsl::versionPatch()));
+    digest = updateDigest(digest, commonDigest);
+    digest = updateDigest(digest, optionsKey);
+
+    // The code input files may be injected into any of the rendered files
+    for (auto& d : codeInputDirs) {
+        std::vector<bf::path> files;
+        boost::system::error_code ec;
+        for (bf::recursive_directory_iterator iter(d, ec), end; (!ec) && (iter != end); iter.increment(ec)) {
+            if (bf::is_regular_file(iter->status())) {
+                files.push_back(iter->path());
+            }
+        }
+
+        if (ec) {
+            m_generator.logger().error("Failed to scan code input directory \"" + d.string() + "\": " + ec.message());
+            return false;
+        }
+
+        std::sort(files.begin(), files.end());
+        digest = updateDigest(digest, d.string());
+        for (auto& f : files) {
+            std::string data;
+            if (!readFile(f, data)) {
+                m_generator.logger().error("Failed to read \"" + f.string() + "\"");
+                return false;
+            }
+
+            digest = updateDigest(digest, f.string());
+            digest = updateDigest(digest, data);
+        }
+    }
+
+    boost::system::error_code ec;
+    bf::create_directories(m_dir, ec);
+    if (ec) {
+        m_generator.logger().error("Failed to create render cache directory \"" + m_dir.string() + "\": " + ec.message());
+        return false;
+    }
+
+    m_baseKey = digest;
+    return true;
+}
+
+bool RenderCache::write(const std::string& externalRef, std::uint64_t digest, const WriteFunc& func)
+{
+    auto key = updateDigest(m_baseKey, externalRef);
+    key = updateDigest(key, digest);
+
+    std::ostringstream keyStream;
+    keyStream << std::hex << std::setfill('0') << std::setw(16) << key;
+    auto entryName = keyStream.str();
+    m_usedEntries.insert(entryName);
+    auto entryDir = m_dir / entryName;
+
+    if (reuse(entryDir)) {
+        return true;
+    }
+
+    EntryInfo info;
+    assert(m_capture == nullptr);
+    m_capture = &info;
+    bool result = func();
+    m_capture = nullptr;
+
+    if (!result) {
+        return false;
+    }
+
+    if (!store(entryDir, info)) {
+        // Failure to cache must not fail the generation
+        m_generator.logger().warning("Failed to store \"" + externalRef + "\" in render cache");
+    }
+    return true;
+}
+
+void RenderCache::evictUnused()
+{
+    // Only the entry directories are removed, other files which might be
+    // placed into the cache directory are left intact.
+    std::vector<bf::path> stale;
+    boost::system::error_code ec;
+    for (bf::directory_iterator iter(m_dir, ec), end; (!ec) && (iter != end); iter.increment(ec)) {
+        auto name = iter->path().filename().string();
+        if ((!isEntryName(name)) ||
+            (!bf::is_directory(iter->status())) ||
+            (m_usedEntries.find(name) != m_usedEntries.end())) {
+            continue;
+        }
+
+        stale.push_back(iter->path());
+    }
+
+    for (auto& p : stale) {
+        m_generator.logger().info("Evicting unused render cache entry " + p.string());
+        bf::remove_all(p, ec);
+        if (ec) {
+            // Failure to evict must not fail the generation
+            m_generator.logger().warning("Failed to remove \"" + p.string() + "\": " + ec.message());
+        }
+    }
+}
+
+std::uint64_t RenderCache::combineDigests(std::uint64_t digest, std::uint64_t value)
+{
+    return updateDigest(digest, value);
+}
+
+std::uint64_t RenderCache::combineDigests(std::uint64_t digest, const std::string& value)
+{
+    return updateDigest(digest, value);
+}
+
+void RenderCache::recordWrittenFile(const std::string& path, const std::string& contents)
+{
+    if (m_capture == nullptr) {
+        return;
+    }
+
+    m_capture->m_files.emplace_back(relativePath(path), contents);
+}
+
+void RenderCache::recordAccessedField(const std::string& externalRef, std::uint64_t digest, bool generate)
+{
+    if (m_capture == nullptr) {
+        return;
+    }
+
+    if (generate) {
+        m_capture->m_fields.push_back(externalRef);
+    }
+
+    auto iter =
+        std::find_if(
+            m_capture->m_deps.begin(), m_capture->m_deps.end(),
+            [&externalRef](auto& elem)
+            {
+                return elem.first == externalRef;
+            });
+
+    if (iter == m_capture->m_deps.end()) {
+        m_capture->m_deps.emplace_back(externalRef, digest);
+    }
+}
+
+bool RenderCache::reuse(const bf::path& entryDir)
+{
+    std::ifstream manifest((entryDir / ManifestFileStr).string());
+    if (!manifest) {
+        return false;
+    }
+
+    StringsList files;
+    StringsList fields;
+    std::string line;
+    while (std::getline(manifest, line)) {
+        if (line.compare(0, FileEntryStr.size(), FileEntryStr) == 0) {
+            files.push_back(line.substr(FileEntryStr.size()));
+            continue;
+        }
+
+        if (line.compare(0, FieldEntryStr.size(), FieldEntryStr) == 0) {
+            fields.push_back(line.substr(FieldEntryStr.size()));
+            continue;
+        }
+
+        if (line.compare(0, DependsEntryStr.size(), DependsEntryStr) == 0) {
+            // The rendering depends on the global fields accessed by the
+            // generator, the entry is stale when any of them has changed.
+            std::istringstream stream(line.substr(DependsEntryStr.size()));
+            std::uint64_t digest = 0U;
+            std::string externalRef;
+            stream >> std::hex >> digest >> externalRef;
+            if (stream.fail() || (m_generator.fieldDefinitionDigest(externalRef) != digest)) {
+                return false;
+            }
+            continue;
+        }
+    }
+
+    FilesList contents;
+    contents.reserve(files.size());
+    for (auto& f : files) {
+        std::string data;
+        if (!readFile(entryDir / FilesDirStr / f, data)) {
+            m_generator.logger().warning("Failed to read cached \"" + f + "\", rendering again");
+            return false;
+        }
+
+        contents.emplace_back(f, std::move(data));
+    }
+
+    for (auto& f : contents) {
+        auto path = m_outputDir / f.first;
+        m_generator.logger().info("Reusing cached " + path.string());
+        if ((!m_generator.createDir(path.parent_path())) ||
+            (!m_generator.writeOutput(path.string(), f.second))) {
+            return false;
+        }
+    }
+
+    for (auto& f : fields) {
+        m_generator.findField(f, true);
+    }
+    return true;
+}
+
+bool RenderCache::store(const bf::path& entryDir, const EntryInfo& info)
+{
+    // The stale entry is invalidated before its files are replaced
+    boost::system::error_code ec;
+    bf::remove(entryDir / ManifestFileStr, ec);
+    if (ec) {
+        return false;
+    }
+
+    // The elements which don't produce any files are cached as well
+    bf::create_directories(entryDir, ec);
+    if (ec) {
+        return false;
+    }
+
+    for (auto& f : info.m_files) {
+        if (!writeFile(entryDir / FilesDirStr / f.first, f.second)) {
+            return false;
+        }
+    }
+
+    // The manifest is written last to mark the entry as complete
+    std::ofstream manifest((entryDir / ManifestFileStr).string(), std::ios_base::trunc);
+    for (auto& f : info.m_files) {
+        manifest << FileEntryStr << f.first << '\n';
+    }
+
+    for (auto& f : info.m_fields) {
+        manifest << FieldEntryStr << f << '\n';
+    }
+
+    for (auto& d : info.m_deps) {
+        manifest << DependsEntryStr << std::hex << d.second << std::dec << ' ' << d.first << '\n';
+    }
+
+    manifest.flush();
+    return manifest.good();
+}
+
+std::string RenderCache::relativePath(const std::string& path) const
+{
+    auto prefix = m_outputDir.string();
+    if ((prefix.size() < path.size()) &&
+        (path.compare(0, prefix.size(), prefix) == 0)) {
+        auto pos = prefix.size();
+        while ((pos < path.size()) && ((path[pos] == '/') || (path[pos] == '\\'))) {
+            ++pos;
+        }
+        return path.substr(pos);
+    }
+
+    assert(!"Should not happen");
+    return path;
+}
+
+} // namespace commsdsl2comms
@@ -0,0 +1,92 @@
+//
+// Copyright 2018 - 2020 (C). Alex Robenko. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <set>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <boost/filesystem.hpp>
+
+namespace commsdsl2comms
+{
+
+class Generator;
+
+// Persistent cache of the files rendered for a single element (message,
+// global field or frame). The entry key combines the digest of the element
+// definition (including the global fields it references and the other
+// definitions it depends on, see Generator::writeCached*()) with the digest
+// of everything else the rendering depends on: the definitions other than
+// messages, global fields, interfaces and frames, generator version, program
+// options and code input files. The global fields accessed during rendering
+// are stored with the entry together with their digests. The entry is reused
+// only when none of them has changed, the fields to be generated are reported
+// again to get them generated as well. The entries not used by the current
+// run are evicted after successful generation.
+class RenderCache
+{
+public:
+    using WriteFunc = std::function<bool ()>;
+
+    RenderCache(
+        Generator& generator,
+        const boost::filesystem::path& dir,
+        const boost::filesystem::path& outputDir);
+
+    bool prepare(
+        std::uint64_t commonDigest,
+        const std::string& optionsKey,
+        const std::vector<boost::filesystem::path>& codeInputDirs);
+
+    bool write(const std::string& externalRef, std::uint64_t digest, const WriteFunc& func);
+    void evictUnused();
+
+    void recordWrittenFile(const std::string& path, const std::string& contents);
+    void recordAccessedField(const std::string& externalRef, std::uint64_t digest, bool generate);
+
+    static std::uint64_t combineDigests(std::uint64_t digest, std::uint64_t value);
+    static std::uint64_t combineDigests(std::uint64_t digest, const std::string& value);
+
+private:
+    using StringsList = std::vector<std::string>;
+
+    using FilesList = std::vector<std::pair<std::string, std::string> >;
+    using DigestsList = std::vector<std::pair<std::string, std::uint64_t> >;
+
+    struct EntryInfo
+    {
+        FilesList m_files;
+        StringsList m_fields;
+        DigestsList m_deps;
+    };
+
+    bool reuse(const boost::filesystem::path& entryDir);
+    bool store(const boost::filesystem::path& entryDir, const EntryInfo& info);
+    std::string relativePath(const std::string& path) const;
+
+    Generator& m_generator;
+    boost::filesystem::path m_dir;
+    boost::filesystem::path m_outputDir;
+    std::uint64_t m_baseKey = 0U;
+    EntryInfo* m_capture = nullptr;
+    std::set<std::string> m_usedEntries;
+};
+
+} // namespace commsdsl2comms
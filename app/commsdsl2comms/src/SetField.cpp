@@ -201,6 +201,11 @@ std::string SetField::getCommonDefinitionImpl(const std::string& fullScope) cons
     return common::processTemplate(Templ, repl);
 }
 
+bool SetField::isFixedLayoutImpl() const
+{
+    return true;
+}
+
 std::string SetField::getExtraDoc() const
 {
     common::StringsList extraDocList;
@@ -15,11 +15,10 @@
 
 #include "Test.h"
 
-#include <fstream>
-
 #include <boost/filesystem.hpp>
 
 #include "Generator.h"
+#include "OutputFile.h"
 #include "common.h"
 #include "EnumField.h"
 #include "IntField.h"
@@ -51,11 +50,7 @@ bool Test::writeInputTest() const
     std::string filePathStr(filePath.string());
 
     m_generator.logger().info("Generating " + filePathStr);
-    std::ofstream stream(filePathStr);
-    if (!stream) {
-        m_generator.logger().error("Failed to open \"" + filePathStr + "\" for writing.");
-        return false;
-    }
+    OutputFile stream(m_generator, filePathStr);
 
     common::ReplacementMap replacements;
     replacements.insert(std::make_pair("GEN_COMMENT", m_generator.fileGeneratedComment()));
@@ -94,6 +89,7 @@ bool Test::writeInputTest() const
 
     static const std::string Template = 
         "#^#GEN_COMMENT#$#\n"
+        "#include <algorithm>\n"
         "#include <iostream>\n"
         "#include <fstream>\n"
         "#include <cstring>\n"
@@ -140,12 +136,21 @@ bool Test::writeInputTest() const
         "    INTERFACE<\n"
         "        comms::option::app::ReadIterator<const char*>,\n"
         "        comms::option::app::WriteIterator<char*>,\n"
-        "        comms::option::app::LengthInfoInterface,\n"
         "        comms::option::app::Handler<Handler>\n"
         "    >;\n\n"
+        "// Interface with length information used to verify the single pass write\n"
+        "using LengthMessage = \n"
+        "    INTERFACE<\n"
+        "        comms::option::app::IdInfoInterface,\n"
+        "        comms::option::app::ReadIterator<const char*>,\n"
+        "        comms::option::app::WriteIterator<char*>,\n"
+        "        comms::option::app::LengthInfoInterface\n"
+        "    >;\n\n"
         "using AppOptions = OPTIONS;\n"
         "using InputMessages = INPUT_MESSAGES<Message, AppOptions>;\n"
-        "using Frame = FRAME<Message, InputMessages, AppOptions>;\n\n"
+        "using Frame = FRAME<Message, InputMessages, AppOptions>;\n"
+        "using LengthInputMessages = INPUT_MESSAGES<LengthMessage, AppOptions>;\n"
+        "using LengthFrame = FRAME<LengthMessage, LengthInputMessages, AppOptions>;\n\n"
         "void printIndent(unsigned indent)\n"
         "{\n"
         "    while (0U < indent) {\n"
@@ -359,22 +364,18 @@ bool Test::writeInputTest() const
         "        std::cout << \'\\n\' << msg.doName() << \" (\"#^#BEFORE_ID#$# << static_cast<#^#ID_TYPE#$#>(msg.doGetId())#^#AFTER_ID#$# << \"):\\n\";\n"
         "        comms::util::tupleForEach(msg.fields(), FieldPrinter(1));\n"
         "        std::cout << std::endl;\n\n"
-        "        // Check write is correct\n"
-        "        std::size_t len = m_frame.length(msg);\n"
-        "        assert(0U < len);\n"
-        "        std::unique_ptr<char []> outBuf(new char[len]);\n"
-        "        auto writeIter = &(outBuf[0]);\n"
-        "        auto es = m_frame.write(msg, writeIter, len);\n"
+        "        // Check write is correct. The interface doesn't provide length information,\n"
+        "        // the payload is written once and the size and checksum values are\n"
+        "        // written after it.\n"
+        "        std::size_t len = 0U;\n"
+        "        auto es = m_frame.writeSinglePass(msg, m_outBuf, len, MaxOutBufSize);\n"
         "        if (es != comms::ErrorStatus::Success) {\n"
         "            std::cerr << \"ERROR: Failed to write\" << std::endl;\n"
         "            assert(!\"Should not happen\");\n"
         "            exit(-1);\n"
         "        }\n\n"
-        "        if (writeIter != (&outBuf[0] + len)) {\n"
-        "            std::cerr << \"ERROR: Unexpected pos of write iterator\" << std::endl;\n"
-        "            assert(!\"Should not happen\");\n"
-        "            exit(-1);\n"            
-        "        }\n"
+        "        assert(0U < len);\n"
+        "        checkWrite(len);\n"
         "    }\n\n"
         "    // Handle unexpected messages\n"
         "    void handle(Message&)\n"
@@ -383,7 +384,39 @@ bool Test::writeInputTest() const
         "        assert(!\"Should not happen\");\n"
         "    }\n\n"
         "private:\n"
+        "    static const std::size_t MaxOutBufSize = 16U * 1024U * 1024U;\n\n"
+        "    // Read the output back with the interface providing length information,\n"
+        "    // its length must be equal to the number of written bytes and the\n"
+        "    // length-first write must produce the same output.\n"
+        "    void checkWrite(std::size_t len)\n"
+        "    {\n"
+        "        LengthFrame::MsgPtr msg;\n"
+        "        const char* readIter = m_outBuf.data();\n"
+        "        auto es = m_lengthFrame.read(msg, readIter, len);\n"
+        "        if ((es != comms::ErrorStatus::Success) || (!msg)) {\n"
+        "            std::cerr << \"ERROR: Failed to read written message\" << std::endl;\n"
+        "            assert(!\"Should not happen\");\n"
+        "            exit(-1);\n"
+        "        }\n\n"
+        "        if (m_lengthFrame.length(*msg) != len) {\n"
+        "            std::cerr << \"ERROR: Unexpected length of written message\" << std::endl;\n"
+        "            assert(!\"Should not happen\");\n"
+        "            exit(-1);\n"
+        "        }\n\n"
+        "        std::vector<char> lengthOutBuf(len);\n"
+        "        auto writeIter = lengthOutBuf.data();\n"
+        "        es = m_lengthFrame.write(*msg, writeIter, len);\n"
+        "        if ((es != comms::ErrorStatus::Success) ||\n"
+        "            (writeIter != (lengthOutBuf.data() + len)) ||\n"
+        "            (!std::equal(lengthOutBuf.begin(), lengthOutBuf.end(), m_outBuf.begin()))) {\n"
+        "            std::cerr << \"ERROR: Length-first write produced different output\" << std::endl;\n"
+        "            assert(!\"Should not happen\");\n"
+        "            exit(-1);\n"
+        "        }\n"
+        "    }\n\n"
         "    Frame& m_frame;\n"
+        "    LengthFrame m_lengthFrame;\n"
+        "    std::vector<char> m_outBuf = std::vector<char>(1024U);\n"
         "};\n\n"
         "} // namespace\n\n"
         "int main(int argc, const char* argv[])\n"
@@ -15,13 +15,13 @@
 
 #include "Version.h"
 
-#include <fstream>
 #include <vector>
 
 #include <boost/filesystem.hpp>
 #include <boost/algorithm/string.hpp>
 
 #include "Generator.h"
+#include "OutputFile.h"
 #include "common.h"
 #include "EnumField.h"
 
@@ -83,11 +83,7 @@ bool Version::writeDefinition() const
         return true;
     }
 
-    std::ofstream stream(filePath);
-    if (!stream) {
-        m_generator.logger().error("Failed to open \"" + filePath + "\" for writing.");
-        return false;
-    }
+    OutputFile stream(m_generator, filePath);
 
     auto versionHeaderFileName = 
         common::nameToClassCopy(common::versionStr()) + common::headerSuffix();
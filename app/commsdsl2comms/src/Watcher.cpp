@@ -0,0 +1,303 @@
+//
+// Copyright 2018 - 2020 (C). Alex Robenko. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "Watcher.h"
+
+#include <chrono>
+#include <cstddef>
+#include <csignal>
+#include <fstream>
+#include <iterator>
+#include <thread>
+#include <algorithm>
+
+#include "Generator.h"
+#include "MemoryOutputSink.h"
+
+namespace bf = boost::filesystem;
+
+namespace commsdsl2comms
+{
+
+namespace
+{
+
+volatile std::sig_atomic_t InterruptRequested = 0;
+
+void interruptHandler(int)
+{
+    InterruptRequested = 1;
+}
+
+bool sameContents(const bf::path& path, const std::string& contents)
+{
+    std::ifstream stream(path.string());
+    if (!stream) {
+        return false;
+    }
+
+    std::string existing((std::istreambuf_iterator<char>(stream)), std::istreambuf_iterator<char>());
+    return existing == contents;
+}
+
+// FNV-1a of the file contents. The modification time has a granularity of
+// one second on some filesystems, quick same size edits are detected only
+// by the contents.
+std::uint64_t contentsDigest(const bf::path& path)
+{
+    static const std::uint64_t InitialDigest = 14695981039346656037ULL;
+    static const std::uint64_t DigestPrime = 1099511628211ULL;
+
+    std::ifstream stream(path.string(), std::ios_base::binary);
+    if (!stream) {
+        return 0U;
+    }
+
+    auto digest = InitialDigest;
+    char buf[4096];
+    while (stream) {
+        stream.read(buf, sizeof(buf));
+        auto count = static_cast<std::size_t>(stream.gcount());
+        for (std::size_t idx = 0U; idx < count; ++idx) {
+            digest ^= static_cast<std::uint8_t>(buf[idx]);
+            digest *= DigestPrime;
+        }
+    }
+
+    return digest;
+}
+
+void addFileState(const bf::path& path, std::map<std::string, std::tuple<std::time_t, std::uintmax_t, std::uint64_t> >& snapshot)
+{
+    boost::system::error_code ec;
+    auto time = bf::last_write_time(path, ec);
+    if (ec) {
+        time = static_cast<std::time_t>(-1);
+    }
+
+    auto size = bf::file_size(path, ec);
+    if (ec) {
+        size = static_cast<std::uintmax_t>(-1);
+    }
+
+    snapshot[path.string()] = std::make_tuple(time, size, contentsDigest(path));
+}
+
+} // namespace
+
+Watcher::Watcher(ProgramOptions& options, const FilesList& files)
+  : m_options(options),
+    m_files(files)
+{
+    configureLogger(m_logger);
+}
+
+Watcher::~Watcher()
+{
+    if (m_tempDir.empty()) {
+        return;
+    }
+
+    boost::system::error_code ec;
+    bf::remove_all(m_tempDir, ec);
+}
+
+bool Watcher::run()
+{
+    if (!prepare()) {
+        return false;
+    }
+
+    std::signal(SIGINT, &interruptHandler);
+    std::signal(SIGTERM, &interruptHandler);
+
+    auto maxRuns = m_options.getWatchMaxRuns();
+    unsigned runs = 1U;
+    m_snapshot = takeSnapshot();
+    bool result = generate();
+    while (((maxRuns == 0U) || (runs < maxRuns)) && waitForChange()) {
+        m_logger.info("Change detected, generating again");
+        result = generate();
+        ++runs;
+    }
+
+    if ((0U < maxRuns) && (maxRuns <= runs)) {
+        m_logger.info("Watch mode is finished after " + std::to_string(runs) + " generations");
+        return result;
+    }
+
+    m_logger.info("Watch mode is interrupted");
+    return true;
+}
+
+bool Watcher::prepare()
+{
+    auto stdinIter = std::find(m_files.begin(), m_files.end(), "-");
+    if (stdinIter != m_files.end()) {
+        m_logger.error("Watch mode doesn't support reading schema files from standard input");
+        return false;
+    }
+
+    boost::system::error_code ec;
+    m_outputDir = m_options.getOutputDirectory();
+    if (m_outputDir.empty()) {
+        m_outputDir = bf::current_path(ec);
+        if (ec) {
+            m_logger.error("Failed to retrieve current directory with reason: " + ec.message());
+            return false;
+        }
+    }
+
+    m_tempDir = bf::temp_directory_path(ec) / bf::unique_path("commsdsl2comms-%%%%-%%%%-%%%%-%%%%");
+    if (ec) {
+        m_logger.error("Failed to retrieve temporary directory with reason: " + ec.message());
+        m_tempDir.clear();
+        return false;
+    }
+
+    m_renderCacheDir = m_options.getRenderCacheDirectory();
+    if (m_renderCacheDir.empty()) {
+        m_renderCacheDir = (m_tempDir / "cache").string();
+    }
+
+    return true;
+}
+
+void Watcher::configureLogger(Logger& logger) const
+{
+    if (m_options.quietRequested()) {
+        logger.setMinLevel(commsdsl::ErrorLevel_Warning);
+    }
+
+    if (m_options.warnAsErrRequested()) {
+        logger.setWarnAsError();
+    }
+}
+
+bool Watcher::generate()
+{
+    // Every generation starts with fresh model and generator state
+    Logger logger;
+    configureLogger(logger);
+    MemoryOutputSink sink;
+    Generator generator(m_options, logger);
+    generator.setOutputDir(m_outputDir.string());
+    generator.setRenderCacheDir(m_renderCacheDir);
+    generator.setOutputSink(sink);
+    if (!generator.generate(m_files)) {
+        m_logger.error("Generation failed, output is not updated");
+        return false;
+    }
+
+    return sync(sink);
+}
+
+bool Watcher::sync(const MemoryOutputSink& sink)
+{
+    PathsSet writtenFiles;
+    std::size_t updatedCount = 0U;
+    std::size_t unchangedCount = 0U;
+    for (auto& f : sink.files()) {
+        bf::path outPath(f.first);
+        writtenFiles.insert(f.first);
+        if (sameContents(outPath, f.second)) {
+            ++unchangedCount;
+            continue;
+        }
+
+        boost::system::error_code ec;
+        bf::create_directories(outPath.parent_path(), ec);
+        if (ec) {
+            m_logger.error("Failed to create directory \"" + outPath.parent_path().string() + "\" with reason: " + ec.message());
+            return false;
+        }
+
+        // Same as the generator's filesystem output
+        std::ofstream stream(f.first);
+        stream << f.second;
+        stream.flush();
+        if (!stream.good()) {
+            m_logger.error("Failed to write \"" + f.first + "\".");
+            return false;
+        }
+
+        m_logger.info("Updating " + f.first);
+        ++updatedCount;
+    }
+
+    std::size_t removedCount = 0U;
+    for (auto& f : m_writtenFiles) {
+        if (writtenFiles.find(f) != writtenFiles.end()) {
+            continue;
+        }
+
+        m_logger.info("Removing " + f);
+        boost::system::error_code ec;
+        bf::remove(f, ec);
+        ++removedCount;
+    }
+
+    m_writtenFiles = std::move(writtenFiles);
+    m_logger.info(
+        "Updated " + std::to_string(updatedCount) + ", removed " + std::to_string(removedCount) +
+        ", unchanged " + std::to_string(unchangedCount) + " output files");
+    return true;
+}
+
+Watcher::Snapshot Watcher::takeSnapshot() const
+{
+    Snapshot snapshot;
+    for (auto& f : m_files) {
+        addFileState(f, snapshot);
+    }
+
+    for (auto& d : m_options.getCodeInputDirectories()) {
+        boost::system::error_code ec;
+        for (bf::recursive_directory_iterator iter(d, ec), end; (!ec) && (iter != end); iter.increment(ec)) {
+            if (bf::is_regular_file(iter->status())) {
+                addFileState(iter->path(), snapshot);
+            }
+        }
+    }
+
+    return snapshot;
+}
+
+bool Watcher::waitForChange()
+{
+    m_logger.info("Watching for changes, press Ctrl+C to stop");
+    auto interval = std::chrono::milliseconds(m_options.getWatchInterval());
+    bool changed = false;
+    while (InterruptRequested == 0) {
+        std::this_thread::sleep_for(interval);
+        auto snapshot = takeSnapshot();
+        if (snapshot == m_snapshot) {
+            if (changed) {
+                // Files are stable since the last check
+                return true;
+            }
+
+            continue;
+        }
+
+        // Wait for the editors to finish writing
+        m_snapshot = std::move(snapshot);
+        changed = true;
+    }
+
+    return false;
+}
+
+} // namespace commsdsl2comms
@@ -0,0 +1,84 @@
+//
+// Copyright 2018 - 2020 (C). Alex Robenko. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstdint>
+#include <ctime>
+#include <map>
+#include <set>
+#include <string>
+#include <tuple>
+#include <vector>
+
+#include <boost/filesystem.hpp>
+
+#include "ProgramOptions.h"
+#include "Logger.h"
+
+namespace commsdsl2comms
+{
+
+class MemoryOutputSink;
+
+// Watch mode: generates into memory every time the contents of the schema files
+// or code input files change and updates only the output files whose contents
+// differ. The schema documents reference each other's fields and namespaces,
+// so all of them are parsed again into fresh protocol and generator objects
+// instead of keeping the model and re-parsing only the modified documents.
+// The invalidation is done by the render cache kept for the whole session,
+// every rendered element is keyed by the digests of the definitions it
+// depends on:
+// - field: its definition and the interfaces;
+// - interface: its definition, the other interfaces and the message ID field;
+// - message: its definition, the interfaces and the message ID field;
+// - frame: its definition, the interfaces and the list of messages;
+// - aggregate files (AllMessages, Dispatch, MsgId, etc...): the interfaces,
+//   the list of messages, the message ID field and the frames.
+// The rest of the files (options, CMake, plugin, etc...) are always rendered,
+// but written only when different.
+class Watcher
+{
+public:
+    using FilesList = std::vector<std::string>;
+
+    Watcher(ProgramOptions& options, const FilesList& files);
+    ~Watcher();
+
+    bool run();
+
+private:
+    using FileState = std::tuple<std::time_t, std::uintmax_t, std::uint64_t>;
+    using Snapshot = std::map<std::string, FileState>;
+    using PathsSet = std::set<std::string>;
+
+    bool prepare();
+    void configureLogger(Logger& logger) const;
+    bool generate();
+    bool sync(const MemoryOutputSink& sink);
+    Snapshot takeSnapshot() const;
+    bool waitForChange();
+
+    ProgramOptions& m_options;
+    FilesList m_files;
+    Logger m_logger;
+    boost::filesystem::path m_tempDir;
+    boost::filesystem::path m_outputDir;
+    std::string m_renderCacheDir;
+    Snapshot m_snapshot;
+    PathsSet m_writtenFiles;
+};
+
+} // namespace commsdsl2comms
@@ -75,6 +75,12 @@ const std::string& frameStr()
     return Str;
 }
 
+const std::string& interfaceStr()
+{
+    static const std::string Str("interface");
+    return Str;
+}
+
 const std::string& fieldStr()
 {
     static const std::string Str("field");
@@ -297,12 +303,36 @@ const std::string& dispatchStr()
     return Str;
 }
 
+const std::string& factoryStr()
+{
+    static const std::string Str("factory");
+    return Str;
+}
+
+const std::string& instantiationStr()
+{
+    static const std::string Str("instantiation");
+    return Str;
+}
+
+const std::string& cmakeStr()
+{
+    static const std::string Str("cmake");
+    return Str;
+}
+
 const std::string& commonSuffixStr()
 {
     static const std::string Str("Common");
     return Str;
 }
 
+const std::string& fwdSuffixStr()
+{
+    static const std::string Str("Fwd");
+    return Str;
+}
+
 const std::string& valSuffixStr()
 {
     static const std::string Str("Val");
@@ -680,6 +710,52 @@ void addToList(const std::string& what, StringsList& to)
     }
 }
 
+const StringsList& lengthBoundsIncludes()
+{
+    static const StringsList List = {
+        "<cstddef>",
+        "<limits>"
+    };
+    return List;
+}
+
+std::string lengthBoundsFuncs(
+    std::size_t minLength,
+    std::size_t maxLength,
+    const std::string& subject,
+    const std::string& infix)
+{
+    ReplacementMap repl;
+    repl.insert(std::make_pair("SUBJECT", subject));
+    repl.insert(std::make_pair("INFIX", infix));
+    repl.insert(std::make_pair("MIN_LENGTH", numToString(static_cast<std::uintmax_t>(minLength))));
+
+    if (maxLength == std::numeric_limits<std::size_t>::max()) {
+        repl.insert(std::make_pair("MAX_LENGTH", "std::numeric_limits<std::size_t>::max()"));
+        repl.insert(std::make_pair("MAX_DETAILS", "/// @details The length is unlimited."));
+    }
+    else {
+        repl.insert(std::make_pair("MAX_LENGTH", numToString(static_cast<std::uintmax_t>(maxLength))));
+    }
+
+    static const std::string Templ =
+        "/// @brief Minimal serialisation length of\n"
+        "///     #^#SUBJECT#$#.\n"
+        "static constexpr std::size_t min#^#INFIX#$#Length()\n"
+        "{\n"
+        "    return #^#MIN_LENGTH#$#;\n"
+        "}\n\n"
+        "/// @brief Maximal serialisation length of\n"
+        "///     #^#SUBJECT#$#.\n"
+        "#^#MAX_DETAILS#$#\n"
+        "static constexpr std::size_t max#^#INFIX#$#Length()\n"
+        "{\n"
+        "    return #^#MAX_LENGTH#$#;\n"
+        "}\n";
+
+    return processTemplate(Templ, repl);
+}
+
 const std::string& dslEndianToOpt(commsdsl::Endian value)
 {
     static const std::string Map[] = {
@@ -18,6 +18,7 @@
 #include <string>
 #include <map>
 #include <cstdint>
+#include <cstddef>
 #include <vector>
 
 #include "commsdsl/Endian.h"
@@ -36,6 +37,7 @@ const std::string& includeStr();
 const std::string& messageStr();
 const std::string& messageClassStr();
 const std::string& frameStr();
+const std::string& interfaceStr();
 const std::string& fieldStr();
 const std::string& fieldBaseStr();
 const std::string& commsStr();
@@ -73,7 +75,11 @@ const std::string& inputTestStr();
 const std::string& testStr();
 const std::string& inputStr();
 const std::string& dispatchStr();
+const std::string& factoryStr();
+const std::string& instantiationStr();
+const std::string& cmakeStr();
 const std::string& commonSuffixStr();
+const std::string& fwdSuffixStr();
 const std::string& valSuffixStr();
 const std::string& valueTypeStr();
 
@@ -114,6 +120,16 @@ std::string listToString(
     const std::string& last = "\n");
 void addToList(const std::string& what, StringsList& to);
 
+// Definition of static constexpr min<Infix>Length() and max<Infix>Length()
+// member functions reporting serialisation length bounds of the documented
+// subject. Requires inclusion of lengthBoundsIncludes().
+const StringsList& lengthBoundsIncludes();
+std::string lengthBoundsFuncs(
+    std::size_t minLength,
+    std::size_t maxLength,
+    const std::string& subject,
+    const std::string& infix = emptyString());
+
 const std::string& dslEndianToOpt(commsdsl::Endian value);
 const std::string& dslUnitsToOpt(commsdsl::Units value);
 const std::string& displayName(const std::string& dslDisplayName, const std::string& dslName);
@@ -28,6 +28,7 @@
 #include "ProgramOptions.h"
 #include "Logger.h"
 #include "Generator.h"
+#include "Watcher.h"
 
 namespace bf = boost::filesystem;
 namespace ba = boost::algorithm;
@@ -76,6 +77,9 @@ int main(int argc, const char* argv[])
         options.parse(argc, argv);
         if (options.helpRequested()) {
             std::cout << "Usage:\n\t" << argv[0] << " [OPTIONS] schema_file1 [schema_file2] [schema_file3] ...\n";
+            std::cout << "Use \"-\" as schema file name to read schema file(s) from standard input.\n"
+                         "Multiple concatenated schema files are split on their XML declarations (\"<?xml ...?>\")\n"
+                         "placed at the beginning of a line.\n";
             options.printHelp(std::cout);
             return 0;
         }
@@ -105,6 +109,15 @@ int main(int argc, const char* argv[])
             return -1;
         }
 
+        if (options.watchRequested()) {
+            commsdsl2comms::Watcher watcher(options, files);
+            if (!watcher.run()) {
+                return -1;
+            }
+
+            return 0;
+        }
+
         commsdsl2comms::Generator generator(options, logger);
         if (!generator.generate(files)) {
             return -1;
@@ -0,0 +1,44 @@
+# PROJ_DIR
+# BUILD_DIR
+# COMMS_INSTALL_DIR
+# INTERFACE
+# INTERFACE_DIR
+# CMAKE_C_COMPILER
+# CMAKE_CXX_COMPILER
+# CMAKE_BUILD_TYPE
+# CMAKE_CXX_STANDARD
+#
+# Builds and installs the explicit instantiation library using the CMake
+# project generated with --explicit-instantiation option. The INTERFACE
+# class is expected to be defined in ${INTERFACE_DIR}/${INTERFACE}.h.
+
+file (MAKE_DIRECTORY ${BUILD_DIR})
+execute_process(
+    COMMAND ${CMAKE_COMMAND}
+        -DOPT_CC_MAIN_INSTALL_DIR=${COMMS_INSTALL_DIR}
+        -DOPT_BUILD_INSTANTIATION=ON
+        -DOPT_INSTANTIATION_INTERFACE=${INTERFACE}
+        -DOPT_INSTANTIATION_INTERFACE_HEADER=${INTERFACE}.h
+        -DOPT_INSTANTIATION_INCLUDE_DIRS=${INTERFACE_DIR}
+        -DCMAKE_C_COMPILER=${CMAKE_C_COMPILER}
+        -DCMAKE_CXX_COMPILER=${CMAKE_CXX_COMPILER} -DCMAKE_BUILD_TYPE=${CMAKE_BUILD_TYPE}
+        -DCMAKE_CXX_STANDARD=${CMAKE_CXX_STANDARD} -DCMAKE_INSTALL_PREFIX=${BUILD_DIR}/install
+        -DCMAKE_INSTALL_LIBDIR=lib
+        ${PROJ_DIR}
+    WORKING_DIRECTORY ${BUILD_DIR}
+    RESULT_VARIABLE cmake_result
+)
+
+if (NOT ${cmake_result} EQUAL 0)
+    message (FATAL_ERROR "CMake has failed in ${PROJ_DIR}")
+endif ()
+
+execute_process(
+    COMMAND ${CMAKE_COMMAND} --build ${BUILD_DIR} --target install
+    WORKING_DIRECTORY ${BUILD_DIR}
+    RESULT_VARIABLE cmake_result
+)
+
+if (NOT ${cmake_result} EQUAL 0)
+    message (FATAL_ERROR "Build has failed in ${PROJ_DIR}")
+endif ()
@@ -5,6 +5,8 @@
 # CMAKE_CXX_COMPILER
 # CMAKE_BUILD_TYPE
 # CMAKE_CXX_STANDARD
+# OPT_PLUGIN_UNITY_BUILD_GROUPS
+# OPT_PLUGIN_PCH
 
 set (build_dir "${PROJ_DIR}/build")
 file (MAKE_DIRECTORY ${build_dir})
@@ -16,6 +18,7 @@ execute_process(
         -DOPT_QT_DIR=${OPT_QT_DIR} -DCMAKE_C_COMPILER=${CMAKE_C_COMPILER} 
         -DCMAKE_CXX_COMPILER=${CMAKE_CXX_COMPILER} -DCMAKE_BUILD_TYPE=${CMAKE_BUILD_TYPE} 
         -DCMAKE_CXX_STANDARD=${CMAKE_CXX_STANDARD} -DCMAKE_INSTALL_PREFIX=${build_dir}/install
+        -DOPT_PLUGIN_UNITY_BUILD_GROUPS=${OPT_PLUGIN_UNITY_BUILD_GROUPS} -DOPT_PLUGIN_PCH=${OPT_PLUGIN_PCH}
         ${PROJ_DIR}
     WORKING_DIRECTORY ${build_dir}
     RESULT_VARIABLE cmake_result
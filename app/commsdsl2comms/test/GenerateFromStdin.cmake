@@ -0,0 +1,19 @@
+# GENERATOR
+# SCHEMA
+# OUTPUT
+# CODE_INPUT
+# EXTRA_ARGS
+
+if (("${GENERATOR}" STREQUAL "") OR ("${SCHEMA}" STREQUAL "") OR ("${OUTPUT}" STREQUAL ""))
+    message (FATAL_ERROR "Bad parameters")
+endif ()
+
+execute_process(
+    COMMAND ${GENERATOR} --warn-as-err ${EXTRA_ARGS} -o ${OUTPUT} ${CODE_INPUT} -
+    INPUT_FILE ${SCHEMA}
+    RESULT_VARIABLE result
+)
+
+if (NOT "${result}" STREQUAL "0")
+    message (FATAL_ERROR "Generation from standard input failed: ${result}")
+endif ()
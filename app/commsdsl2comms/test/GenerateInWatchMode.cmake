@@ -0,0 +1,148 @@
+# GENERATOR
+# SCHEMA
+# UPDATED_SCHEMA
+# OUTPUT
+# CODE_INPUT
+# EXTRA_ARGS
+#
+# Generates from SCHEMA in watch mode, replaces the watched schema with
+# UPDATED_SCHEMA after the first generation and checks that the output
+# is the same as the one generated from UPDATED_SCHEMA directly, while
+# the files not affected by the update are not rewritten.
+#
+# The script is also executed as a second process of the pipeline with
+# the generator (STEP=update), to perform the update when the output
+# of the first generation is complete.
+
+set (work_dir "${OUTPUT}.watch")
+set (watched_schema "${work_dir}/Schema.xml")
+set (initial_output "${work_dir}/initial")
+set (expected_output "${work_dir}/expected")
+set (snapshot_dir "${work_dir}/snapshot")
+
+function (filesList dir result)
+    file(GLOB_RECURSE files RELATIVE "${dir}/" "${dir}/*")
+    list (SORT files)
+    set (${result} ${files} PARENT_SCOPE)
+endfunction ()
+
+function (sameOutput dir1 dir2 result)
+    set (${result} FALSE PARENT_SCOPE)
+    filesList ("${dir1}" files1)
+    filesList ("${dir2}" files2)
+    if (NOT "${files1}" STREQUAL "${files2}")
+        return ()
+    endif ()
+
+    foreach (f ${files1})
+        execute_process(
+            COMMAND ${CMAKE_COMMAND} -E compare_files "${dir1}/${f}" "${dir2}/${f}"
+            RESULT_VARIABLE compare_result
+            OUTPUT_QUIET ERROR_QUIET)
+
+        if (NOT "${compare_result}" STREQUAL "0")
+            return ()
+        endif ()
+    endforeach ()
+    set (${result} TRUE PARENT_SCOPE)
+endfunction ()
+
+if ("${STEP}" STREQUAL "update")
+    # Wait for the first generation to complete
+    set (attempt 0)
+    set (done FALSE)
+    while (NOT done)
+        sameOutput ("${initial_output}" "${OUTPUT}" done)
+        if (done)
+            break ()
+        endif ()
+
+        math (EXPR attempt "${attempt} + 1")
+        if (600 LESS attempt)
+            message (FATAL_ERROR "The first generation in watch mode didn't produce expected output")
+        endif ()
+
+        execute_process(COMMAND ${CMAKE_COMMAND} -E sleep 0.1)
+    endwhile ()
+
+    # The copy preserves the timestamps, the sleep makes sure the rewritten
+    # files get different ones.
+    file (COPY "${OUTPUT}/" DESTINATION "${snapshot_dir}")
+    execute_process(COMMAND ${CMAKE_COMMAND} -E sleep 1.5)
+    configure_file("${UPDATED_SCHEMA}" "${watched_schema}" COPYONLY)
+    return ()
+endif ()
+
+if (("${GENERATOR}" STREQUAL "") OR ("${SCHEMA}" STREQUAL "") OR
+    ("${UPDATED_SCHEMA}" STREQUAL "") OR ("${OUTPUT}" STREQUAL ""))
+    message (FATAL_ERROR "Bad parameters")
+endif ()
+
+file (REMOVE_RECURSE "${work_dir}" "${OUTPUT}")
+file (MAKE_DIRECTORY "${work_dir}")
+configure_file("${SCHEMA}" "${watched_schema}" COPYONLY)
+
+execute_process(
+    COMMAND ${GENERATOR} --warn-as-err --quiet ${EXTRA_ARGS} -o ${initial_output} ${CODE_INPUT} ${SCHEMA}
+    RESULT_VARIABLE result
+)
+
+if (NOT "${result}" STREQUAL "0")
+    message (FATAL_ERROR "Generation of initial output failed: ${result}")
+endif ()
+
+execute_process(
+    COMMAND ${GENERATOR} --warn-as-err --quiet ${EXTRA_ARGS} -o ${expected_output} ${CODE_INPUT} ${UPDATED_SCHEMA}
+    RESULT_VARIABLE result
+)
+
+if (NOT "${result}" STREQUAL "0")
+    message (FATAL_ERROR "Generation of expected output failed: ${result}")
+endif ()
+
+# The generator's output is not read by the update step, the info messages
+# are suppressed to avoid filling the pipe.
+execute_process(
+    COMMAND ${GENERATOR} --warn-as-err --quiet --watch --watch-interval=100 --watch-max-runs=2
+        ${EXTRA_ARGS} -o ${OUTPUT} ${CODE_INPUT} ${watched_schema}
+    COMMAND ${CMAKE_COMMAND} -DSTEP=update -DUPDATED_SCHEMA=${UPDATED_SCHEMA} -DOUTPUT=${OUTPUT}
+        -P "${CMAKE_CURRENT_LIST_FILE}"
+    RESULT_VARIABLE result
+    TIMEOUT 300
+)
+
+if (NOT "${result}" STREQUAL "0")
+    message (FATAL_ERROR "Generation in watch mode failed: ${result}")
+endif ()
+
+sameOutput ("${expected_output}" "${OUTPUT}" same)
+if (NOT same)
+    message (FATAL_ERROR "Output of watch mode is different from the expected one")
+endif ()
+
+filesList ("${OUTPUT}" files)
+set (updated_count 0)
+set (unchanged_count 0)
+foreach (f ${files})
+    execute_process(
+        COMMAND ${CMAKE_COMMAND} -E compare_files "${snapshot_dir}/${f}" "${OUTPUT}/${f}"
+        RESULT_VARIABLE compare_result
+        OUTPUT_QUIET ERROR_QUIET)
+
+    if ("${compare_result}" STREQUAL "0")
+        file (TIMESTAMP "${snapshot_dir}/${f}" snapshot_time "%s" UTC)
+        file (TIMESTAMP "${OUTPUT}/${f}" output_time "%s" UTC)
+        if (NOT "${snapshot_time}" STREQUAL "${output_time}")
+            message (FATAL_ERROR "Unchanged file ${f} is rewritten in watch mode")
+        endif ()
+        math (EXPR unchanged_count "${unchanged_count} + 1")
+    else ()
+        math (EXPR updated_count "${updated_count} + 1")
+    endif ()
+endforeach ()
+
+if ((updated_count EQUAL 0) OR (unchanged_count EQUAL 0))
+    message (FATAL_ERROR "Expected both updated and unchanged files: ${updated_count}/${unchanged_count}")
+endif ()
+
+message (STATUS "Watch mode updated ${updated_count} and kept ${unchanged_count} files")
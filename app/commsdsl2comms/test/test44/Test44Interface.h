@@ -0,0 +1,17 @@
+#pragma once
+
+#include <cstdint>
+
+#include "comms/options.h"
+#include "test44/Message.h"
+
+// The interface the explicit instantiation library is built with,
+// the test uses the same one.
+using Test44Interface =
+    test44::Message<
+        comms::option::app::IdInfoInterface,
+        comms::option::app::ReadIterator<const std::uint8_t*>,
+        comms::option::app::WriteIterator<std::uint8_t*>,
+        comms::option::app::LengthInfoInterface,
+        comms::option::app::NameInterface
+    >;
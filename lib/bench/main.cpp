@@ -0,0 +1,564 @@
+//
+// Copyright 2018 - 2020 (C). Alex Robenko. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Synthesises CommsDSL schema of configurable size, parses and validates it
+// using libcommsdsl and reports the duration and the peak memory of every
+// phase as a single line JSON object.
+
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <sys/resource.h>
+#endif
+
+#include "commsdsl/Protocol.h"
+
+namespace
+{
+
+const std::string SchemaName("Bench");
+
+struct Config
+{
+    unsigned m_namespaces = 4U;
+    unsigned m_messages = 250U; // per namespace
+    unsigned m_fields = 8U; // per message
+    unsigned m_reuseDepth = 4U;
+    unsigned m_variantWidth = 4U;
+    unsigned m_enumSize = 16U;
+    unsigned m_files = 1U;
+    unsigned m_threads = 1U;
+    unsigned m_repeat = 1U;
+    bool m_parseAll = false;
+    bool m_streaming = false;
+    bool m_detached = false;
+    bool m_lazy = false;
+    bool m_keep = false;
+    std::string m_prefix = "commsdsl_bench_schema";
+};
+
+void printHelp(std::ostream& out)
+{
+    out <<
+        "Usage: commsdsl_bench [options]\n"
+        "Options:\n"
+        "  --namespaces N      Number of namespaces.\n"
+        "  --messages N        Number of messages in every namespace.\n"
+        "  --fields N          Number of plain integral fields in every message.\n"
+        "  --reuse-depth N     Length of the chain of reused bundles in every namespace.\n"
+        "  --variant-width N   Number of members in the variant of every namespace, 0 to disable.\n"
+        "  --enum-size N       Number of values in the global enum, 0 to disable.\n"
+        "  --files N           Number of schema files to split the namespaces into.\n"
+        "  --parse-all         Parse the files using single parseAll() call.\n"
+        "  --threads N         Number of threads for parseAll(), 0 for hardware concurrency.\n"
+        "  --streaming         Enable streaming parse mode.\n"
+        "  --detached          Enable detached model mode.\n"
+        "  --lazy              Enable lazy validation mode.\n"
+        "  --repeat N          Number of parse/validate/query runs.\n"
+        "  --prefix STR        Prefix of the synthesised schema files.\n"
+        "  --keep              Don't remove the synthesised schema files.\n"
+        "  --help              This help.\n";
+}
+
+bool parseArgs(int argc, const char* argv[], Config& config)
+{
+    for (auto idx = 1; idx < argc; ++idx) {
+        std::string arg(argv[idx]);
+        auto flagFunc =
+            [&arg](const char* name, bool& value)
+            {
+                if (arg != name) {
+                    return false;
+                }
+
+                value = true;
+                return true;
+            };
+
+        if (flagFunc("--parse-all", config.m_parseAll) ||
+            flagFunc("--streaming", config.m_streaming) ||
+            flagFunc("--detached", config.m_detached) ||
+            flagFunc("--lazy", config.m_lazy) ||
+            flagFunc("--keep", config.m_keep)) {
+            continue;
+        }
+
+        if ((idx + 1) == argc) {
+            std::cerr << "ERROR: Unknown option or missing value for \"" << arg << "\"" << std::endl;
+            return false;
+        }
+
+        std::string value(argv[idx + 1]);
+        ++idx;
+
+        if (arg == "--prefix") {
+            config.m_prefix = value;
+            continue;
+        }
+
+        struct NumInfo
+        {
+            const char* m_name;
+            unsigned* m_value;
+        };
+
+        const NumInfo NumMap[] = {
+            {"--namespaces", &config.m_namespaces},
+            {"--messages", &config.m_messages},
+            {"--fields", &config.m_fields},
+            {"--reuse-depth", &config.m_reuseDepth},
+            {"--variant-width", &config.m_variantWidth},
+            {"--enum-size", &config.m_enumSize},
+            {"--files", &config.m_files},
+            {"--threads", &config.m_threads},
+            {"--repeat", &config.m_repeat},
+        };
+
+        bool found = false;
+        for (auto& info : NumMap) {
+            if (arg != info.m_name) {
+                continue;
+            }
+
+            char* end = nullptr;
+            auto numValue = std::strtoul(value.c_str(), &end, 0);
+            if ((end == value.c_str()) || (*end != '\0')) {
+                std::cerr << "ERROR: Invalid value \"" << value << "\" for \"" << arg << "\"" << std::endl;
+                return false;
+            }
+
+            *info.m_value = static_cast<unsigned>(numValue);
+            found = true;
+            break;
+        }
+
+        if (!found) {
+            std::cerr << "ERROR: Unknown option \"" << arg << "\"" << std::endl;
+            return false;
+        }
+    }
+
+    if (config.m_files == 0U) {
+        config.m_files = 1U;
+    }
+
+    if (config.m_repeat == 0U) {
+        config.m_repeat = 1U;
+    }
+
+    return true;
+}
+
+std::string nsName(unsigned idx)
+{
+    return "ns" + std::to_string(idx);
+}
+
+std::string reusedName(unsigned idx)
+{
+    return "R" + std::to_string(idx);
+}
+
+std::string msgName(unsigned idx)
+{
+    return "Msg" + std::to_string(idx);
+}
+
+void writeGlobalFields(const Config& config, std::string& out)
+{
+    if (config.m_enumSize == 0U) {
+        return;
+    }
+
+    out += "    <fields>\n";
+    out += "        <enum name=\"Kind\" type=\"uint16\">\n";
+    for (auto idx = 0U; idx < config.m_enumSize; ++idx) {
+        auto idxStr = std::to_string(idx);
+        out += "            <validValue name=\"V" + idxStr + "\" val=\"" + idxStr + "\" />\n";
+    }
+    out += "        </enum>\n";
+    out += "    </fields>\n";
+}
+
+void writeNamespace(const Config& config, unsigned nsIdx, std::string& out)
+{
+    static const char* IntTypes[] = {"uint8", "uint16", "uint32", "int16"};
+    static const auto IntTypesCount = sizeof(IntTypes) / sizeof(IntTypes[0]);
+
+    auto ns = nsName(nsIdx);
+    out += "    <ns name=\"" + ns + "\">\n";
+    out += "        <fields>\n";
+    out += "            <bundle name=\"" + reusedName(0U) + "\">\n";
+    out += "                <int name=\"first\" type=\"uint8\" />\n";
+    out += "                <int name=\"second\" type=\"uint16\" />\n";
+    out += "            </bundle>\n";
+    for (auto idx = 1U; idx <= config.m_reuseDepth; ++idx) {
+        out += "            <bundle name=\"" + reusedName(idx) + "\" reuse=\"" + ns + '.' + reusedName(idx - 1U) + "\">\n";
+        out += "                <members>\n";
+        out += "                    <int name=\"extra" + std::to_string(idx) + "\" type=\"uint8\" />\n";
+        out += "                </members>\n";
+        out += "            </bundle>\n";
+    }
+
+    if (0U < config.m_variantWidth) {
+        out += "            <variant name=\"Var\">\n";
+        for (auto idx = 0U; idx < config.m_variantWidth; ++idx) {
+            auto idxStr = std::to_string(idx);
+            out += "                <bundle name=\"P" + idxStr + "\">\n";
+            out += "                    <int name=\"type\" type=\"uint16\" validValue=\"" + idxStr +
+                   "\" defaultValue=\"" + idxStr + "\" failOnInvalid=\"true\" />\n";
+            out += "                    <int name=\"value\" type=\"uint32\" />\n";
+            out += "                </bundle>\n";
+        }
+        out += "            </variant>\n";
+    }
+    out += "        </fields>\n";
+
+    auto lastReused = ns + '.' + reusedName(config.m_reuseDepth);
+    for (auto msgIdx = 0U; msgIdx < config.m_messages; ++msgIdx) {
+        auto id = (static_cast<std::uintmax_t>(nsIdx) * config.m_messages) + msgIdx + 1U;
+        out += "        <message name=\"" + msgName(msgIdx) + "\" id=\"" + std::to_string(id) + "\">\n";
+        for (auto fieldIdx = 0U; fieldIdx < config.m_fields; ++fieldIdx) {
+            out += "            <int name=\"f" + std::to_string(fieldIdx) + "\" type=\"" +
+                   IntTypes[fieldIdx % IntTypesCount] + "\" />\n";
+        }
+
+        out += "            <ref name=\"r\" field=\"" + lastReused + "\" />\n";
+
+        if (0U < config.m_enumSize) {
+            out += "            <enum name=\"e\" reuse=\"Kind\" />\n";
+        }
+
+        if (0U < config.m_variantWidth) {
+            out += "            <ref name=\"v\" field=\"" + ns + ".Var\" />\n";
+        }
+        out += "        </message>\n";
+    }
+    out += "    </ns>\n";
+}
+
+// The first file contains the global fields, the namespaces are
+// distributed between the rest of them.
+std::vector<std::string> synthesise(const Config& config)
+{
+    std::vector<std::string> contents(config.m_files);
+    for (auto& c : contents) {
+        c += "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n";
+        c += "<schema name=\"" + SchemaName + "\" endian=\"big\">\n";
+    }
+
+    writeGlobalFields(config, contents.front());
+    for (auto nsIdx = 0U; nsIdx < config.m_namespaces; ++nsIdx) {
+        std::size_t fileIdx = 0U;
+        if (1U < config.m_files) {
+            fileIdx = 1U + (nsIdx % (config.m_files - 1U));
+        }
+
+        writeNamespace(config, nsIdx, contents[fileIdx]);
+    }
+
+    for (auto& c : contents) {
+        c += "</schema>\n";
+    }
+
+    return contents;
+}
+
+bool writeFiles(const Config& config, const std::vector<std::string>& contents, std::vector<std::string>& files)
+{
+    for (auto idx = 0U; idx < contents.size(); ++idx) {
+        auto name = config.m_prefix + '_' + std::to_string(idx) + ".xml";
+        std::ofstream stream(name, std::ios_base::out | std::ios_base::trunc | std::ios_base::binary);
+        if (!stream) {
+            std::cerr << "ERROR: Failed to create \"" << name << "\"" << std::endl;
+            return false;
+        }
+
+        stream << contents[idx];
+        stream.flush();
+        if (!stream.good()) {
+            std::cerr << "ERROR: Failed to write \"" << name << "\"" << std::endl;
+            return false;
+        }
+
+        files.push_back(std::move(name));
+    }
+    return true;
+}
+
+#ifdef __linux__
+long readProcStatusKb(const std::string& key)
+{
+    std::ifstream stream("/proc/self/status");
+    std::string line;
+    while (std::getline(stream, line)) {
+        if (line.compare(0, key.size(), key) != 0) {
+            continue;
+        }
+
+        return std::strtol(line.c_str() + key.size(), nullptr, 10);
+    }
+    return -1;
+}
+#endif
+
+// Resets the peak resident set size of the process, so the subsequent
+// reading reflects only the following phase. Not available on all
+// the platforms, the peak value is cumulative otherwise.
+bool resetPeakMemory()
+{
+#ifdef __linux__
+    std::ofstream stream("/proc/self/clear_refs");
+    stream << "5";
+    stream.flush();
+    return stream.good();
+#else
+    return false;
+#endif
+}
+
+long peakMemoryKb()
+{
+#ifdef __linux__
+    return readProcStatusKb("VmHWM:");
+#elif defined(__unix__) || defined(__APPLE__)
+    struct rusage usage;
+    if (getrusage(RUSAGE_SELF, &usage) != 0) {
+        return -1;
+    }
+#ifdef __APPLE__
+    return usage.ru_maxrss / 1024;
+#else
+    return usage.ru_maxrss;
+#endif
+#else
+    return -1;
+#endif
+}
+
+long currentMemoryKb()
+{
+#ifdef __linux__
+    return readProcStatusKb("VmRSS:");
+#else
+    return -1;
+#endif
+}
+
+class PhaseMeter
+{
+public:
+    explicit PhaseMeter(unsigned run) : m_run(run) {}
+
+    void start()
+    {
+        m_peakReset = resetPeakMemory();
+        m_start = Clock::now();
+    }
+
+    void finish(const char* phase, bool ok, std::size_t count = 0U)
+    {
+        auto duration = std::chrono::duration<double, std::milli>(Clock::now() - m_start).count();
+        std::cout <<
+            "{\"run\":" << m_run <<
+            ",\"phase\":\"" << phase << "\""
+            ",\"ok\":" << (ok ? "true" : "false") <<
+            ",\"count\":" << count <<
+            ",\"time_ms\":" << duration <<
+            ",\"peak_rss_kb\":" << peakMemoryKb() <<
+            ",\"peak_rss_reset\":" << (m_peakReset ? "true" : "false") <<
+            ",\"rss_kb\":" << currentMemoryKb() <<
+            "}" << std::endl;
+    }
+
+private:
+    using Clock = std::chrono::steady_clock;
+
+    unsigned m_run = 0U;
+    bool m_peakReset = false;
+    Clock::time_point m_start;
+};
+
+void printConfig(const Config& config)
+{
+    std::cout <<
+        "{\"config\":{"
+        "\"namespaces\":" << config.m_namespaces <<
+        ",\"messages\":" << config.m_messages <<
+        ",\"fields\":" << config.m_fields <<
+        ",\"reuse_depth\":" << config.m_reuseDepth <<
+        ",\"variant_width\":" << config.m_variantWidth <<
+        ",\"enum_size\":" << config.m_enumSize <<
+        ",\"files\":" << config.m_files <<
+        ",\"parse_all\":" << (config.m_parseAll ? "true" : "false") <<
+        ",\"threads\":" << config.m_threads <<
+        ",\"streaming\":" << (config.m_streaming ? "true" : "false") <<
+        ",\"detached\":" << (config.m_detached ? "true" : "false") <<
+        ",\"lazy\":" << (config.m_lazy ? "true" : "false") <<
+        ",\"repeat\":" << config.m_repeat <<
+        "}}" << std::endl;
+}
+
+bool run(const Config& config, const std::vector<std::string>& files, unsigned runIdx)
+{
+    PhaseMeter meter(runIdx);
+    commsdsl::Protocol protocol;
+    protocol.setErrorReportCallback(
+        [](commsdsl::ErrorLevel level, const std::string& msg)
+        {
+            if (level < commsdsl::ErrorLevel_Warning) {
+                return;
+            }
+
+            std::cerr << "[" << static_cast<int>(level) << "] " << msg << std::endl;
+        });
+
+    protocol.setStreamingParseMode(config.m_streaming);
+    protocol.setDetachedModelMode(config.m_detached);
+    protocol.setLazyValidationMode(config.m_lazy);
+
+    meter.start();
+    bool ok = true;
+    if (config.m_parseAll) {
+        ok = protocol.parseAll(files, config.m_threads);
+    }
+    else {
+        for (auto& f : files) {
+            ok = protocol.parse(f) && ok;
+        }
+    }
+    meter.finish("parse", ok, files.size());
+    if (!ok) {
+        return false;
+    }
+
+    meter.start();
+    ok = protocol.validate();
+    meter.finish("validate", ok);
+    if (!ok) {
+        return false;
+    }
+
+    meter.start();
+    std::size_t msgCount = 0U;
+    ok = true;
+    for (auto nsIdx = 0U; nsIdx < config.m_namespaces; ++nsIdx) {
+        auto prefix = nsName(nsIdx) + '.';
+        for (auto msgIdx = 0U; msgIdx < config.m_messages; ++msgIdx) {
+            ok = protocol.findMessage(prefix + msgName(msgIdx)).valid() && ok;
+            ++msgCount;
+        }
+    }
+    meter.finish("findMessage", ok, msgCount);
+
+    meter.start();
+    std::size_t fieldCount = 0U;
+    ok = true;
+    for (auto nsIdx = 0U; nsIdx < config.m_namespaces; ++nsIdx) {
+        auto prefix = nsName(nsIdx) + '.';
+        for (auto idx = 0U; idx <= config.m_reuseDepth; ++idx) {
+            ok = protocol.findField(prefix + reusedName(idx)).valid() && ok;
+            ++fieldCount;
+        }
+
+        if (0U < config.m_variantWidth) {
+            ok = protocol.findField(prefix + "Var").valid() && ok;
+            ++fieldCount;
+        }
+    }
+
+    if (0U < config.m_enumSize) {
+        ok = protocol.findField("Kind").valid() && ok;
+        ++fieldCount;
+    }
+    meter.finish("findField", ok, fieldCount);
+
+    meter.start();
+    auto allMessages = protocol.allMessages();
+    ok = (allMessages.size() == msgCount);
+    meter.finish("allMessages", ok, allMessages.size());
+
+    meter.start();
+    auto namespaces = protocol.namespaces();
+    std::size_t nsFieldsCount = 0U;
+    for (auto& ns : namespaces) {
+        nsFieldsCount += ns.fields().size();
+    }
+    meter.finish("namespaces", true, nsFieldsCount);
+
+    if (config.m_lazy) {
+        meter.start();
+        ok = protocol.validateAll();
+        meter.finish("validateAll", ok);
+    }
+
+    return ok;
+}
+
+} // namespace
+
+int main(int argc, const char* argv[])
+{
+    Config config;
+    for (auto idx = 1; idx < argc; ++idx) {
+        if (std::string(argv[idx]) == "--help") {
+            printHelp(std::cout);
+            return 0;
+        }
+    }
+
+    if (!parseArgs(argc, argv, config)) {
+        printHelp(std::cerr);
+        return -1;
+    }
+
+    printConfig(config);
+
+    PhaseMeter meter(0U);
+    meter.start();
+    auto contents = synthesise(config);
+    std::vector<std::string> files;
+    bool ok = writeFiles(config, contents, files);
+    std::size_t totalSize = 0U;
+    for (auto& c : contents) {
+        totalSize += c.size();
+    }
+    contents.clear();
+    contents.shrink_to_fit();
+    meter.finish("synthesise", ok, totalSize);
+
+    for (auto runIdx = 0U; ok && (runIdx < config.m_repeat); ++runIdx) {
+        ok = run(config, files, runIdx);
+    }
+
+    if (!config.m_keep) {
+        for (auto& f : files) {
+            std::remove(f.c_str());
+        }
+    }
+
+    if (!ok) {
+        return -1;
+    }
+
+    return 0;
+}
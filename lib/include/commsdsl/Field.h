@@ -15,6 +15,7 @@
 
 #pragma once
 
+#include <cstdint>
 #include <string>
 
 #include "CommsdslApi.h"
@@ -81,6 +82,12 @@ public:
     bool isFailOnInvalid() const;
     std::string schemaPos() const;
 
+    // Digest of the global field definition source combined with the digests
+    // of the global fields it references, available only for the fields
+    // defined in the "fields" sections when the definition digest mode of
+    // the Protocol is enabled, 0 otherwise.
+    std::uint64_t definitionDigest() const;
+
     const AttributesMap& extraAttributes() const;
     const ElementsList& extraElements() const;
 
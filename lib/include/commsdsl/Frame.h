@@ -46,6 +46,11 @@ public:
     const AttributesMap& extraAttributes() const;
     const ElementsList& extraElements() const;
 
+    // Digest of the frame definition source combined with the digests of
+    // the global fields referenced by the definition, available only when
+    // the definition digest mode of the Protocol is enabled, 0 otherwise.
+    std::uint64_t definitionDigest() const;
+
 protected:
     const FrameImpl* m_pImpl;
 };
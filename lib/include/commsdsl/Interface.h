@@ -49,6 +49,12 @@ public:
     const AttributesMap& extraAttributes() const;
     const ElementsList& extraElements() const;
 
+    // Digest of the interface definition source (including the interface
+    // the fields are copied from) combined with the digests of
+    // the global fields referenced by the definition, available only when
+    // the definition digest mode of the Protocol is enabled, 0 otherwise.
+    std::uint64_t definitionDigest() const;
+
 protected:
     const InterfaceImpl* m_pImpl;
 };
@@ -70,6 +70,12 @@ public:
     const ElementsList& extraElements() const;
     const PlatformsList& platforms() const;
 
+    // Digest of the message definition source (including the message
+    // the fields are copied from) combined with the digests of the global
+    // fields referenced by the definition, available only when the
+    // definition digest mode of the Protocol is enabled, 0 otherwise.
+    std::uint64_t definitionDigest() const;
+
 protected:
     const MessageImpl* m_pImpl;
 };
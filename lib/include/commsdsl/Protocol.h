@@ -20,6 +20,9 @@
 #include <functional>
 #include <vector>
 #include <limits>
+#include <iosfwd>
+#include <cstddef>
+#include <cstdint>
 
 #include "CommsdslApi.h"
 #include "ErrorLevel.h"
@@ -31,21 +34,92 @@ namespace commsdsl
 {
 
 class ProtocolImpl;
+
+// Independent Protocol objects can be parsed and validated concurrently
+// on different threads. After successful validate() the protocol model
+// is read-only and all the const member functions of the Protocol as
+// well as of all the objects it returns may be used concurrently.
+// The error report callback calls are serialised.
 class COMMSDSL_API Protocol
 {
 public:
     using ErrorReportFunction = std::function<void (ErrorLevel, const std::string&)>;
+    using DocReportFunction = std::function<bool (const std::string&)>;
     using NamespacesList = std::vector<Namespace>;
     using MessagesList = Namespace::MessagesList;
     using PlatformsList = Message::PlatformsList;
+    using FilesList = std::vector<std::string>;
+
+    enum class PerfHazardKind
+    {
+        VariantNoKey, // variant members can't be selected by a key field
+        ListElemVarLength, // list elements don't have fixed serialisation length
+        OptionalNesting, // nested optionals or conditions referencing nested members
+        UnboundedLength, // serialisation length has no upper limit
+        IdVarOffset, // message ID in the frame is not at a fixed offset
+        NumOfValues
+    };
+
+    enum class PerfHazardSeverity
+    {
+        Low,
+        Medium,
+        High,
+        NumOfValues
+    };
+
+    struct PerfHazardInfo
+    {
+        PerfHazardKind m_kind = PerfHazardKind::NumOfValues;
+        PerfHazardSeverity m_severity = PerfHazardSeverity::Low;
+        std::string m_element;
+        std::string m_description;
+        std::string m_suggestion;
+    };
+
+    using PerfHazardsList = std::vector<PerfHazardInfo>;
 
     Protocol();
     ~Protocol();
 
     void setErrorReportCallback(ErrorReportFunction&& cb);
 
+    // The callback is invoked with the name of every parsed schema document
+    // right before its parse errors are reported, in the order of the
+    // parsed files (also for parseAll()). Returning false stops the parsing
+    // and the parse function fails.
+    void setDocReportCallback(DocReportFunction&& cb);
+
+    // When enabled, the parsed XML documents are released after successful
+    // validation, only the extracted protocol model is kept.
+    void setDetachedModelMode(bool enabled = true);
+
+    // When enabled, the schema files are read in a single pass using
+    // the streaming xmlTextReader interface and only the nodes relevant
+    // to the protocol model are kept instead of the complete document tree.
+    void setStreamingParseMode(bool enabled = true);
+
+    // When enabled, validate() performs only the schema level checks and
+    // every namespace is validated when it is first accessed, either directly
+    // or through the references from other namespaces. The checks across
+    // all the namespaces, such as message IDs uniqueness, are performed by
+    // validateAll(). In this mode the Protocol object must not be accessed
+    // concurrently.
+    void setLazyValidationMode(bool enabled = true);
+
+    // When enabled, a digest of the definition source is calculated for every
+    // message, global field, interface and frame (see definitionDigest() of
+    // Message, Field, Interface and Frame) as well as a digest of all the
+    // other definitions in the schema files (see commonDefinitionDigest()).
+    // The digests allow detection of changed elements between the runs.
+    void setDefinitionDigestMode(bool enabled = true);
+
     bool parse(const std::string& input);
+    bool parseAll(const FilesList& files, unsigned threads = 0U);
+    bool parseBuffer(const char* buf, std::size_t size, const std::string& name = std::string());
+    bool parseStream(std::istream& input, const std::string& name = std::string());
     bool validate();
+    bool validateAll();
 
     Schema schema() const;
     NamespacesList namespaces() const;
@@ -56,6 +130,8 @@ public:
     }
 
     Field findField(const std::string& externalRef) const;
+    Message findMessage(const std::string& externalRef) const;
+    Interface findInterface(const std::string& externalRef) const;
 
     MessagesList allMessages() const;
 
@@ -63,6 +139,18 @@ public:
 
     const PlatformsList& platforms() const;
 
+    // Digest of all the definitions except messages, global fields,
+    // interfaces and frames, combined with the digests of the global fields
+    // referenced by them, available after successful validate() when the
+    // definition digest mode is enabled, 0 otherwise.
+    std::uint64_t commonDefinitionDigest() const;
+
+    // Analyse the validated protocol model for the constructs which are
+    // expensive to handle at runtime in the generated code. Every reported
+    // hazard references the affected element by its full name (members
+    // separated by '.') and contains a suggested alternative definition.
+    PerfHazardsList analysePerformance() const;
+
 private:
     std::unique_ptr<ProtocolImpl> m_pImpl;
 };
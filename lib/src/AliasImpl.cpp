@@ -69,13 +69,11 @@ bool AliasImpl::parse()
         return false;
     }
 
-    XmlWrap::NamesList expectedProps = commonProps();
-    if (!updateExtraAttrs(expectedProps)) {
+    if (!updateExtraAttrs(commonProps())) {
         return false;
     }
 
-    XmlWrap::NamesList expectedChildren = commonProps();
-    if (!updateExtraChildren(expectedChildren)) {
+    if (!updateExtraChildren(commonProps())) {
         return false;
     }
 
@@ -30,6 +30,7 @@ class AliasImpl
 {
 public:
     using PropsMap = XmlWrap::PropsMap;
+    using AttributesMap = XmlWrap::AttributesMap;
     using ContentsList = XmlWrap::ContentsList;
     using Ptr = std::unique_ptr<AliasImpl>;
 
@@ -48,12 +49,12 @@ public:
         return m_state.m_fieldName;
     }
 
-    const PropsMap& extraAttributes() const
+    const AttributesMap& extraAttributes() const
     {
         return m_state.m_extraAttrs;
     }
 
-    PropsMap& extraAttributes()
+    AttributesMap& extraAttributes()
     {
         return m_state.m_extraAttrs;
     }
@@ -108,7 +109,7 @@ private:
         std::string m_name;
         std::string m_description;
         std::string m_fieldName;
-        PropsMap m_extraAttrs;
+        AttributesMap m_extraAttrs;
         ContentsList m_extraChildren;
     };
 
@@ -0,0 +1,186 @@
+//
+// Copyright 2018 - 2020 (C). Alex Robenko. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "Atom.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cstring>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+
+#include "common.h"
+
+namespace commsdsl
+{
+
+namespace
+{
+
+using SortedAtoms = std::vector<std::pair<const std::string*, Atom> >;
+
+SortedAtoms createSortedAtoms()
+{
+    SortedAtoms result;
+    auto count = static_cast<unsigned>(Atom::NumOfValues);
+    result.reserve(count - 1U);
+    for (auto idx = 1U; idx < count; ++idx) {
+        auto value = static_cast<Atom>(idx);
+        result.emplace_back(&atomStr(value), value);
+    }
+
+    std::sort(
+        result.begin(), result.end(),
+        [](auto& first, auto& second)
+        {
+            return *first.first < *second.first;
+        });
+    return result;
+}
+
+} // namespace
+
+Atom toAtom(const char* str)
+{
+    static const SortedAtoms Atoms = createSortedAtoms();
+    auto iter =
+        std::lower_bound(
+            Atoms.begin(), Atoms.end(), str,
+            [](auto& elem, const char* s)
+            {
+                return std::strcmp(elem.first->c_str(), s) < 0;
+            });
+
+    if ((iter == Atoms.end()) || (std::strcmp(iter->first->c_str(), str) != 0)) {
+        return Atom::Unknown;
+    }
+
+    return iter->second;
+}
+
+const std::string& atomStr(Atom value)
+{
+    static const std::string* Map[] = {
+        /* Unknown */ &common::emptyString(),
+        /* Name */ &common::nameStr(),
+        /* DisplayName */ &common::displayNameStr(),
+        /* Description */ &common::descriptionStr(),
+        /* SinceVersion */ &common::sinceVersionStr(),
+        /* Deprecated */ &common::deprecatedStr(),
+        /* Removed */ &common::removedStr(),
+        /* Reuse */ &common::reuseStr(),
+        /* SemanticType */ &common::semanticTypeStr(),
+        /* Pseudo */ &common::pseudoStr(),
+        /* DisplayReadOnly */ &common::displayReadOnlyStr(),
+        /* DisplayHidden */ &common::displayHiddenStr(),
+        /* Customizable */ &common::customizableStr(),
+        /* FailOnInvalid */ &common::failOnInvalidStr(),
+        /* Meta */ &common::metaStr(),
+        /* Int */ &common::intStr(),
+        /* Enum */ &common::enumStr(),
+        /* Set */ &common::setStr(),
+        /* Float */ &common::floatStr(),
+        /* Bitfield */ &common::bitfieldStr(),
+        /* Bundle */ &common::bundleStr(),
+        /* String */ &common::stringStr(),
+        /* Data */ &common::dataStr(),
+        /* List */ &common::listStr(),
+        /* Ref */ &common::refStr(),
+        /* Optional */ &common::optionalStr(),
+        /* Variant */ &common::variantStr(),
+        /* Alias */ &common::aliasStr(),
+        /* And */ &common::andStr(),
+        /* Bit */ &common::bitStr(),
+        /* BitLength */ &common::bitLengthStr(),
+        /* Cond */ &common::condStr(),
+        /* Count */ &common::countStr(),
+        /* CountPrefix */ &common::countPrefixStr(),
+        /* DefaultMember */ &common::defaultMemberStr(),
+        /* DefaultMode */ &common::defaultModeStr(),
+        /* DefaultValue */ &common::defaultValueStr(),
+        /* DisplayDesimals */ &common::displayDesimalsStr(),
+        /* DisplayExtModeCtrl */ &common::displayExtModeCtrlStr(),
+        /* DisplayIdxReadOnlyHidden */ &common::displayIdxReadOnlyHiddenStr(),
+        /* DisplayOffset */ &common::displayOffsetStr(),
+        /* DisplaySpecials */ &common::displaySpecialsStr(),
+        /* ElemFixedLength */ &common::elemFixedLengthStr(),
+        /* ElemLengthPrefix */ &common::elemLengthPrefixStr(),
+        /* Element */ &common::elementStr(),
+        /* Encoding */ &common::encodingStr(),
+        /* Endian */ &common::endianStr(),
+        /* Field */ &common::fieldStr(),
+        /* HexAssign */ &common::hexAssignStr(),
+        /* Idx */ &common::idxStr(),
+        /* Length */ &common::lengthStr(),
+        /* LengthPrefix */ &common::lengthPrefixStr(),
+        /* Members */ &common::membersStr(),
+        /* NonUniqueAllowed */ &common::nonUniqueAllowedStr(),
+        /* NonUniqueSpecialsAllowed */ &common::nonUniqueSpecialsAllowedStr(),
+        /* Or */ &common::orStr(),
+        /* Reserved */ &common::reservedStr(),
+        /* ReservedValue */ &common::reservedValueStr(),
+        /* ReuseAliases */ &common::reuseAliasesStr(),
+        /* Scaling */ &common::scalingStr(),
+        /* SerOffset */ &common::serOffsetStr(),
+        /* SignExt */ &common::signExtStr(),
+        /* Special */ &common::specialStr(),
+        /* Type */ &common::typeStr(),
+        /* Units */ &common::unitsStr(),
+        /* Val */ &common::valStr(),
+        /* ValidCheckVersion */ &common::validCheckVersionStr(),
+        /* ValidFullRange */ &common::validFullRangeStr(),
+        /* ValidMax */ &common::validMaxStr(),
+        /* ValidMin */ &common::validMinStr(),
+        /* ValidRange */ &common::validRangeStr(),
+        /* ValidValue */ &common::validValueStr(),
+        /* ZeroTermSuffix */ &common::zeroTermSuffixStr()
+    };
+
+    static const std::size_t MapSize = std::extent<decltype(Map)>::value;
+    static_assert(MapSize == static_cast<std::size_t>(Atom::NumOfValues), "Invalid map");
+
+    auto idx = static_cast<std::size_t>(value);
+    assert(idx < MapSize);
+    return *Map[idx];
+}
+
+AtomsList toAtoms(const std::vector<std::string>& names)
+{
+    AtomsList result;
+    result.reserve(names.size());
+    std::transform(
+        names.begin(), names.end(), std::back_inserter(result),
+        [](const std::string& n)
+        {
+            auto value = toAtom(n.c_str());
+            assert(value != Atom::Unknown);
+            return value;
+        });
+    return result;
+}
+
+bool isAtomInLists(Atom value, AtomsListsRefs lists)
+{
+    return
+        std::any_of(
+            lists.begin(), lists.end(),
+            [value](const AtomsList* l)
+            {
+                return std::find(l->begin(), l->end(), value) != l->end();
+            });
+}
+
+} // namespace commsdsl
@@ -0,0 +1,120 @@
+//
+// Copyright 2018 - 2020 (C). Alex Robenko. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <initializer_list>
+#include <string>
+#include <vector>
+
+namespace commsdsl
+{
+
+// Known names of the fields' properties and child elements. The names are
+// resolved to atoms once per node, after that the properties are looked up
+// and validated by integer compares instead of string ones.
+enum class Atom : unsigned
+{
+    Unknown,
+    // Common properties
+    Name,
+    DisplayName,
+    Description,
+    SinceVersion,
+    Deprecated,
+    Removed,
+    Reuse,
+    SemanticType,
+    Pseudo,
+    DisplayReadOnly,
+    DisplayHidden,
+    Customizable,
+    FailOnInvalid,
+    Meta,
+    // Kinds of the member fields
+    Int,
+    Enum,
+    Set,
+    Float,
+    Bitfield,
+    Bundle,
+    String,
+    Data,
+    List,
+    Ref,
+    Optional,
+    Variant,
+    // Properties of the specific fields
+    Alias,
+    And,
+    Bit,
+    BitLength,
+    Cond,
+    Count,
+    CountPrefix,
+    DefaultMember,
+    DefaultMode,
+    DefaultValue,
+    DisplayDesimals,
+    DisplayExtModeCtrl,
+    DisplayIdxReadOnlyHidden,
+    DisplayOffset,
+    DisplaySpecials,
+    ElemFixedLength,
+    ElemLengthPrefix,
+    Element,
+    Encoding,
+    Endian,
+    Field,
+    HexAssign,
+    Idx,
+    Length,
+    LengthPrefix,
+    Members,
+    NonUniqueAllowed,
+    NonUniqueSpecialsAllowed,
+    Or,
+    Reserved,
+    ReservedValue,
+    ReuseAliases,
+    Scaling,
+    SerOffset,
+    SignExt,
+    Special,
+    Type,
+    Units,
+    Val,
+    ValidCheckVersion,
+    ValidFullRange,
+    ValidMax,
+    ValidMin,
+    ValidRange,
+    ValidValue,
+    ZeroTermSuffix,
+    NumOfValues
+};
+
+using AtomsList = std::vector<Atom>;
+
+// Several atoms lists checked together without
+// creating their concatenated copy.
+using AtomsListsRefs = std::initializer_list<const AtomsList*>;
+
+Atom toAtom(const char* str);
+const std::string& atomStr(Atom value);
+AtomsList toAtoms(const std::vector<std::string>& names);
+bool isAtomInLists(Atom value, AtomsListsRefs lists);
+
+} // namespace commsdsl
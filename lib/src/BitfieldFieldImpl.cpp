@@ -30,10 +30,10 @@ namespace commsdsl
 namespace
 {
 
-XmlWrap::NamesList getExtraNames()
+XmlWrap::AtomsList getExtraNames()
 {
-    auto names = BitfieldFieldImpl::supportedTypes();
-    names.push_back(common::membersStr());
+    auto names = toAtoms(BitfieldFieldImpl::supportedTypes());
+    names.push_back(Atom::Members);
     return names;
 }
 
@@ -89,18 +89,18 @@ FieldImpl::Ptr BitfieldFieldImpl::cloneImpl() const
     return Ptr(new BitfieldFieldImpl(*this));
 }
 
-const XmlWrap::NamesList& BitfieldFieldImpl::extraPropsNamesImpl() const
+const XmlWrap::AtomsList& BitfieldFieldImpl::extraPropsNamesImpl() const
 {
-    static const XmlWrap::NamesList List = {
-        common::endianStr(),
+    static const XmlWrap::AtomsList List = {
+        Atom::Endian,
     };
 
     return List;
 }
 
-const XmlWrap::NamesList& BitfieldFieldImpl::extraChildrenNamesImpl() const
+const XmlWrap::AtomsList& BitfieldFieldImpl::extraChildrenNamesImpl() const
 {
-    static const XmlWrap::NamesList Names = getExtraNames();
+    static const XmlWrap::AtomsList Names = getExtraNames();
     return Names;
 }
 
@@ -180,11 +180,11 @@ bool BitfieldFieldImpl::verifyAliasedMemberImpl(const std::string& fieldName) co
 
 bool BitfieldFieldImpl::updateEndian()
 {
-    if (!validateSinglePropInstance(common::endianStr())) {
+    if (!validateSinglePropInstance(Atom::Endian)) {
         return false;
     }
 
-    auto& endianStr = common::getStringProp(props(), common::endianStr());
+    auto& endianStr = common::getStringProp(props(), Atom::Endian);
     if ((endianStr.empty()) && (m_endian != Endian_NumOfValues)) {
         return true;
     }
@@ -37,11 +37,11 @@ const XmlWrap::NamesList& bundleSupportedTypes()
     return Names;
 }
 
-XmlWrap::NamesList getExtraNames()
+XmlWrap::AtomsList getExtraNames()
 {
-    auto names = bundleSupportedTypes();
-    names.push_back(common::membersStr());
-    names.push_back(common::aliasStr());
+    auto names = toAtoms(bundleSupportedTypes());
+    names.push_back(Atom::Members);
+    names.push_back(Atom::Alias);
     return names;
 }
 
@@ -97,18 +97,18 @@ FieldImpl::Ptr BundleFieldImpl::cloneImpl() const
     return Ptr(new BundleFieldImpl(*this));
 }
 
-const XmlWrap::NamesList& BundleFieldImpl::extraPropsNamesImpl() const
+const XmlWrap::AtomsList& BundleFieldImpl::extraPropsNamesImpl() const
 {
-    static const XmlWrap::NamesList List = {
-        common::reuseAliasesStr()
+    static const XmlWrap::AtomsList List = {
+        Atom::ReuseAliases
     };
 
     return List;
 }
 
-const XmlWrap::NamesList& BundleFieldImpl::extraChildrenNamesImpl() const
+const XmlWrap::AtomsList& BundleFieldImpl::extraChildrenNamesImpl() const
 {
-    static const XmlWrap::NamesList Names = getExtraNames();
+    static const XmlWrap::AtomsList Names = getExtraNames();
     return Names;
 }
 
@@ -132,7 +132,7 @@ bool BundleFieldImpl::reuseImpl(const FieldImpl& other)
         }
 
         bool reuseAliases = true;
-        if (!validateAndUpdateBoolPropValue(common::reuseAliasesStr(), reuseAliases)) {
+        if (!validateAndUpdateBoolPropValue(Atom::ReuseAliases, reuseAliases)) {
             return false;
         }
 
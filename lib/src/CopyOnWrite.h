@@ -0,0 +1,70 @@
+//
+// Copyright 2018 - 2020 (C). Alex Robenko. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <memory>
+
+namespace commsdsl
+{
+
+// Value shared between the copies (clones of the reused elements)
+// until one of them modifies it.
+template <typename T>
+class CopyOnWrite
+{
+public:
+    const T& get() const
+    {
+        if (!m_ptr) {
+            return emptyValue();
+        }
+
+        return *m_ptr;
+    }
+
+    const T& operator*() const
+    {
+        return get();
+    }
+
+    const T* operator->() const
+    {
+        return &get();
+    }
+
+    T& modify()
+    {
+        if (!m_ptr) {
+            m_ptr = std::make_shared<T>();
+        }
+        else if (1 < m_ptr.use_count()) {
+            m_ptr = std::make_shared<T>(*m_ptr);
+        }
+
+        return *m_ptr;
+    }
+
+private:
+    static const T& emptyValue()
+    {
+        static const T Value = T();
+        return Value;
+    }
+
+    std::shared_ptr<T> m_ptr;
+};
+
+} // namespace commsdsl
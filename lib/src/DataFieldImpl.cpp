@@ -61,29 +61,29 @@ FieldImpl::Ptr DataFieldImpl::cloneImpl() const
     return Ptr(new DataFieldImpl(*this));
 }
 
-const XmlWrap::NamesList& DataFieldImpl::extraPropsNamesImpl() const
+const XmlWrap::AtomsList& DataFieldImpl::extraPropsNamesImpl() const
 {
-    static const XmlWrap::NamesList List = {
-        common::lengthStr(),
-        common::defaultValueStr()
+    static const XmlWrap::AtomsList List = {
+        Atom::Length,
+        Atom::DefaultValue
     };
 
     return List;
 }
 
-const XmlWrap::NamesList&DataFieldImpl::extraPossiblePropsNamesImpl() const
+const XmlWrap::AtomsList& DataFieldImpl::extraPossiblePropsNamesImpl() const
 {
-    static const XmlWrap::NamesList List = {
-        common::lengthPrefixStr(),
+    static const XmlWrap::AtomsList List = {
+        Atom::LengthPrefix,
     };
 
     return List;
 }
 
-const XmlWrap::NamesList& DataFieldImpl::extraChildrenNamesImpl() const
+const XmlWrap::AtomsList& DataFieldImpl::extraChildrenNamesImpl() const
 {
-    static const XmlWrap::NamesList List = {
-        common::lengthPrefixStr()
+    static const XmlWrap::AtomsList List = {
+        Atom::LengthPrefix
     };
 
     return List;
@@ -179,12 +179,12 @@ bool DataFieldImpl::strToDataImpl(const std::string& ref, std::vector<std::uint8
 
 bool DataFieldImpl::updateDefaultValue()
 {
-    if (!validateSinglePropInstance(common::defaultValueStr())) {
+    if (!validateSinglePropInstance(Atom::DefaultValue)) {
         return false;
     }
 
     do {
-        auto iter = props().find(common::defaultValueStr());
+        auto iter = props().find(Atom::DefaultValue);
         if (iter == props().end()) {
             break;
         }
@@ -210,11 +210,11 @@ bool DataFieldImpl::updateDefaultValue()
 
 bool DataFieldImpl::updateLength()
 {
-    if (!validateSinglePropInstance(common::lengthStr())) {
+    if (!validateSinglePropInstance(Atom::Length)) {
         return false;
     }
 
-    auto iter = props().find(common::lengthStr());
+    auto iter = props().find(Atom::Length);
     if (iter == props().end()) {
         return true;
     }
@@ -262,11 +262,11 @@ bool DataFieldImpl::updatePrefix()
 
 bool DataFieldImpl::checkPrefixFromRef()
 {
-    if (!validateSinglePropInstance(common::lengthPrefixStr())) {
+    if (!validateSinglePropInstance(Atom::LengthPrefix)) {
         return false;
     }
 
-    auto iter = props().find(common::lengthPrefixStr());
+    auto iter = props().find(Atom::LengthPrefix);
     if (iter == props().end()) {
         return true;
     }
@@ -338,7 +338,7 @@ bool DataFieldImpl::checkPrefixAsChild()
         return false;
     }
 
-    auto iter = props().find(common::lengthPrefixStr());
+    auto iter = props().find(Atom::LengthPrefix);
     bool hasInProps = iter != props().end();
     if (prefixFields.empty()) {
         if (hasInProps) {
@@ -47,7 +47,7 @@ bool EnumFieldImpl::isUnique() const
 {
     std::intmax_t prevKey = 0;
     bool firstElem = true;
-    for (auto& v : m_state.m_revValues) {
+    for (auto& v : *m_state.m_revValues) {
         if (firstElem) {
             prevKey = v.first;
             firstElem = false;
@@ -77,26 +77,26 @@ FieldImpl::Ptr EnumFieldImpl::cloneImpl() const
     return Ptr(new EnumFieldImpl(*this));
 }
 
-const XmlWrap::NamesList& EnumFieldImpl::extraPropsNamesImpl() const
+const XmlWrap::AtomsList& EnumFieldImpl::extraPropsNamesImpl() const
 {
-    static const XmlWrap::NamesList List = {
-        common::typeStr(),
-        common::defaultValueStr(),
-        common::endianStr(),
-        common::lengthStr(),
-        common::bitLengthStr(),
-        common::nonUniqueAllowedStr(),
-        common::validCheckVersionStr(),
-        common::hexAssignStr()
+    static const XmlWrap::AtomsList List = {
+        Atom::Type,
+        Atom::DefaultValue,
+        Atom::Endian,
+        Atom::Length,
+        Atom::BitLength,
+        Atom::NonUniqueAllowed,
+        Atom::ValidCheckVersion,
+        Atom::HexAssign
     };
 
     return List;
 }
 
-const XmlWrap::NamesList& EnumFieldImpl::extraChildrenNamesImpl() const
+const XmlWrap::AtomsList& EnumFieldImpl::extraChildrenNamesImpl() const
 {
-    static const XmlWrap::NamesList List = {
-        common::validValueStr()
+    static const XmlWrap::AtomsList List = {
+        Atom::ValidValue
     };
 
     return List;
@@ -182,8 +182,8 @@ bool EnumFieldImpl::strToNumericImpl(const std::string& ref, std::intmax_t& val,
         return true;
     }
 
-    auto iter = m_state.m_values.find(ref);
-    if (iter == m_state.m_values.end()) {
+    auto iter = m_state.m_values->find(ref);
+    if (iter == m_state.m_values->end()) {
         return false;
     }
 
@@ -221,11 +221,11 @@ bool EnumFieldImpl::verifySemanticTypeImpl(::xmlNodePtr node, SemanticType type)
 bool EnumFieldImpl::updateType()
 {
     bool mustHave = (m_state.m_type == Type::NumOfValues);
-    if (!validateSinglePropInstance(common::typeStr(), mustHave)) {
+    if (!validateSinglePropInstance(Atom::Type, mustHave)) {
         return false;
     }
 
-    auto propsIter = props().find(common::typeStr());
+    auto propsIter = props().find(Atom::Type);
     if (propsIter == props().end()) {
         assert(m_state.m_type != Type::NumOfValues);
         return true;
@@ -253,11 +253,11 @@ bool EnumFieldImpl::updateType()
 
 bool EnumFieldImpl::updateEndian()
 {
-    if (!validateSinglePropInstance(common::endianStr())) {
+    if (!validateSinglePropInstance(Atom::Endian)) {
         return false;
     }
 
-    auto& endianStr = common::getStringProp(props(), common::endianStr());
+    auto& endianStr = common::getStringProp(props(), Atom::Endian);
     if ((endianStr.empty()) && (m_state.m_endian != Endian_NumOfValues)) {
         return true;
     }
@@ -272,12 +272,12 @@ bool EnumFieldImpl::updateEndian()
 
 bool EnumFieldImpl::updateLength()
 {
-    if (!validateSinglePropInstance(common::lengthStr())) {
+    if (!validateSinglePropInstance(Atom::Length)) {
         return false;
     }
 
     auto maxLength = IntFieldImpl::maxTypeLength(m_state.m_type);
-    auto& lengthStr = common::getStringProp(props(), common::lengthStr());
+    auto& lengthStr = common::getStringProp(props(), Atom::Length);
     if (lengthStr.empty()) {
         if (m_state.m_length == 0) {
             m_state.m_length = maxLength;
@@ -321,13 +321,13 @@ bool EnumFieldImpl::updateLength()
 
 bool EnumFieldImpl::updateBitLength()
 {
-    if (!validateSinglePropInstance(common::bitLengthStr())) {
+    if (!validateSinglePropInstance(Atom::BitLength)) {
         return false;
     }
 
     auto maxBitLength = m_state.m_length * BitsInByte;
     assert((m_state.m_bitLength == 0) || (m_state.m_bitLength == maxBitLength));
-    auto& valStr = common::getStringProp(props(), common::bitLengthStr());
+    auto& valStr = common::getStringProp(props(), Atom::BitLength);
     if (valStr.empty()) {
         assert(0 < m_state.m_length);
         if (m_state.m_bitLength == 0) {
@@ -363,12 +363,12 @@ bool EnumFieldImpl::updateBitLength()
 
 bool EnumFieldImpl::updateNonUniqueAllowed()
 {
-    return validateAndUpdateBoolPropValue(common::nonUniqueAllowedStr(), m_state.m_nonUniqueAllowed);
+    return validateAndUpdateBoolPropValue(Atom::NonUniqueAllowed, m_state.m_nonUniqueAllowed);
 }
 
 bool EnumFieldImpl::updateValidCheckVersion()
 {
-    return validateAndUpdateBoolPropValue(common::validCheckVersionStr(), m_state.m_validCheckVersion);
+    return validateAndUpdateBoolPropValue(Atom::ValidCheckVersion, m_state.m_validCheckVersion);
 }
 
 bool EnumFieldImpl::updateMinMaxValues()
@@ -386,8 +386,8 @@ bool EnumFieldImpl::updateValues()
 {
     auto validValues = XmlWrap::getChildren(getNode(), common::validValueStr());
     if (validValues.empty()) {
-        if (!m_state.m_values.empty()) {
-            assert(!m_state.m_revValues.empty());
+        if (!m_state.m_values->empty()) {
+            assert(!m_state.m_revValues->empty());
             return true; // already has values
         }
 
@@ -397,41 +397,41 @@ bool EnumFieldImpl::updateValues()
     }
 
     for (auto* vNode : validValues) {
-        static const XmlWrap::NamesList PropNames = {
-            common::nameStr(),
-            common::valStr(),
-            common::sinceVersionStr(),
-            common::deprecatedStr(),
-            common::descriptionStr(),
-            common::displayNameStr()
+        static const XmlWrap::AtomsList PropNames = {
+            Atom::Name,
+            Atom::Val,
+            Atom::SinceVersion,
+            Atom::Deprecated,
+            Atom::Description,
+            Atom::DisplayName
         };
 
-        auto props = XmlWrap::parseNodeProps(vNode);
+        auto props = XmlWrap::parseNodeAtomProps(vNode);
         if (!XmlWrap::parseChildrenAsProps(vNode, PropNames, protocol().logger(), props)) {
             return false;
         }
 
-        if (!XmlWrap::validateSinglePropInstance(vNode, props, common::nameStr(), protocol().logger(), true)) {
+        if (!XmlWrap::validateSinglePropInstance(vNode, props, Atom::Name, protocol().logger(), true)) {
             return false;
         }
 
-        if (!XmlWrap::validateSinglePropInstance(vNode, props, common::valStr(), protocol().logger(), true)) {
+        if (!XmlWrap::validateSinglePropInstance(vNode, props, Atom::Val, protocol().logger(), true)) {
             return false;
         }
 
-        if (!XmlWrap::validateSinglePropInstance(vNode, props, common::sinceVersionStr(), protocol().logger())) {
+        if (!XmlWrap::validateSinglePropInstance(vNode, props, Atom::SinceVersion, protocol().logger())) {
             return false;
         }
 
-        if (!XmlWrap::validateSinglePropInstance(vNode, props, common::deprecatedStr(), protocol().logger())) {
+        if (!XmlWrap::validateSinglePropInstance(vNode, props, Atom::Deprecated, protocol().logger())) {
             return false;
         }
 
-        if (!XmlWrap::validateSinglePropInstance(vNode, props, common::descriptionStr(), protocol().logger())) {
+        if (!XmlWrap::validateSinglePropInstance(vNode, props, Atom::Description, protocol().logger())) {
             return false;
         }
 
-        if (!XmlWrap::validateSinglePropInstance(vNode, props, common::displayNameStr(), protocol().logger())) {
+        if (!XmlWrap::validateSinglePropInstance(vNode, props, Atom::DisplayName, protocol().logger())) {
             return false;
         }
 
@@ -440,7 +440,7 @@ bool EnumFieldImpl::updateValues()
         auto extraChildren = XmlWrap::getExtraChildren(vNode, PropNames, protocol());
         static_cast<void>(extraChildren);
 
-        auto nameIter = props.find(common::nameStr());
+        auto nameIter = props.find(Atom::Name);
         assert(nameIter != props.end());
 
         if (!common::isValidName(nameIter->second)) {
@@ -450,14 +450,14 @@ bool EnumFieldImpl::updateValues()
             return false;
         }
 
-        auto valuesIter = m_state.m_values.find(nameIter->second);
-        if (valuesIter != m_state.m_values.end()) {
+        auto valuesIter = m_state.m_values->find(nameIter->second);
+        if (valuesIter != m_state.m_values->end()) {
             logError() << XmlWrap::logPrefix(vNode) << "Value with name \"" << nameIter->second <<
                           "\" has already been defined for enum \"" << name() << "\".";
             return false;
         }
 
-        auto valIter = props.find(common::valStr());
+        auto valIter = props.find(Atom::Val);
         assert(valIter != props.end());
 
         std::intmax_t val = 0;
@@ -499,8 +499,8 @@ bool EnumFieldImpl::updateValues()
         }
 
         if (!m_state.m_nonUniqueAllowed) {
-            auto revIter = m_state.m_revValues.find(val);
-            if (revIter != m_state.m_revValues.end()) {
+            auto revIter = m_state.m_revValues->find(val);
+            if (revIter != m_state.m_revValues->end()) {
                 logError() << XmlWrap::logPrefix(vNode) <<
                               "Value \"" << valIter->second << "\" has been already defined "
                               "as \"" << revIter->second << "\".";
@@ -517,31 +517,31 @@ bool EnumFieldImpl::updateValues()
             return false;
         }
 
-        auto descIter = props.find(common::descriptionStr());
+        auto descIter = props.find(Atom::Description);
         if (descIter != props.end()) {
             info.m_description = descIter->second;
         }
 
-        auto dispNameIter = props.find(common::displayNameStr());
+        auto dispNameIter = props.find(Atom::DisplayName);
         if ((dispNameIter != props.end()) &&
             (!protocol().strToStringValue(dispNameIter->second, info.m_displayName))) {
             XmlWrap::reportUnexpectedPropertyValue(vNode, nameIter->second, common::displayNameStr(), dispNameIter->second, protocol().logger());
             return false;
         }
 
-        m_state.m_values.emplace(nameIter->second, info);
-        m_state.m_revValues.emplace(val, nameIter->second);
+        m_state.m_values.modify().emplace(nameIter->second, info);
+        m_state.m_revValues.modify().emplace(val, nameIter->second);
     }
     return true;
 }
 
 bool EnumFieldImpl::updateDefaultValue()
 {
-    if (!validateSinglePropInstance(common::defaultValueStr())) {
+    if (!validateSinglePropInstance(Atom::DefaultValue)) {
         return false;
     }
 
-    auto& valueStr = common::getStringProp(props(), common::defaultValueStr());
+    auto& valueStr = common::getStringProp(props(), Atom::DefaultValue);
     if (valueStr.empty()) {
         return true;
     }
@@ -603,11 +603,11 @@ bool EnumFieldImpl::updateDefaultValue()
 
 bool EnumFieldImpl::updateHexAssign()
 {
-    if (!validateAndUpdateBoolPropValue(common::hexAssignStr(), m_state.m_hexAssign)) {
+    if (!validateAndUpdateBoolPropValue(Atom::HexAssign, m_state.m_hexAssign)) {
         return false;
     }
 
-    auto& valueStr = common::getStringProp(props(), common::hexAssignStr());
+    auto& valueStr = common::getStringProp(props(), Atom::HexAssign);
     if (valueStr.empty()) {
         return true;
     }    
@@ -627,8 +627,8 @@ bool EnumFieldImpl::strToValue(
 {
     if (common::isValidName(str)) {
         // Check among specials
-        auto iter = m_state.m_values.find(str);
-        if (iter != m_state.m_values.end()) {
+        auto iter = m_state.m_values->find(str);
+        if (iter != m_state.m_values->end()) {
             val = iter->second.m_value;
             return true;
         }
@@ -56,12 +56,12 @@ public:
 
     const Values& values() const
     {
-        return m_state.m_values;
+        return *m_state.m_values;
     }
 
     const RevValues& revValues() const
     {
-        return m_state.m_revValues;
+        return *m_state.m_revValues;
     }
 
     bool isNonUniqueAllowed() const
@@ -84,8 +84,8 @@ public:
 protected:
     virtual Kind kindImpl() const override final;
     virtual Ptr cloneImpl() const override final;
-    virtual const XmlWrap::NamesList& extraPropsNamesImpl() const override final;
-    virtual const XmlWrap::NamesList& extraChildrenNamesImpl() const override final;
+    virtual const XmlWrap::AtomsList& extraPropsNamesImpl() const override final;
+    virtual const XmlWrap::AtomsList& extraChildrenNamesImpl() const override final;
     virtual bool reuseImpl(const FieldImpl& other) override final;
     virtual bool parseImpl() override final;
     virtual std::size_t minLengthImpl() const override final;
@@ -121,8 +121,8 @@ private:
         std::intmax_t m_minValue = 0;
         std::intmax_t m_maxValue = 0;
         std::intmax_t m_defaultValue = 0;
-        Values m_values;
-        RevValues m_revValues;
+        CopyOnWrite<Values> m_values;
+        CopyOnWrite<RevValues> m_revValues;
         bool m_nonUniqueAllowed = false;
         bool m_validCheckVersion = false;
         bool m_hexAssign = false;
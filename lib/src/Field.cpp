@@ -143,6 +143,12 @@ std::string Field::schemaPos() const
     return m_pImpl->schemaPos();
 }
 
+std::uint64_t Field::definitionDigest() const
+{
+    assert(m_pImpl != nullptr);
+    return m_pImpl->definitionDigest();
+}
+
 const Field::AttributesMap& Field::extraAttributes() const
 {
     assert(m_pImpl != nullptr);
@@ -63,9 +63,10 @@ FieldImpl::Ptr FieldImpl::create(
 
 bool FieldImpl::parse()
 {
-    m_props = XmlWrap::parseNodeProps(m_node);
+    auto& nodeProps = m_props.modify();
+    nodeProps = XmlWrap::parseNodeAtomProps(m_node);
 
-    if (!XmlWrap::parseChildrenAsProps(m_node, commonProps(), m_protocol.logger(), m_props)) {
+    if (!XmlWrap::parseChildrenAsProps(m_node, commonProps(), m_protocol.logger(), nodeProps)) {
         return false;
     }
 
@@ -75,7 +76,7 @@ bool FieldImpl::parse()
             break;
         }
 
-        if (!XmlWrap::parseChildrenAsProps(m_node, extraPropsNames, m_protocol.logger(), m_props)) {
+        if (!XmlWrap::parseChildrenAsProps(m_node, extraPropsNames, m_protocol.logger(), nodeProps)) {
             return false;
         }
 
@@ -87,7 +88,7 @@ bool FieldImpl::parse()
             break;
         }
 
-        if (!XmlWrap::parseChildrenAsProps(m_node, extraPossiblePropsNames, m_protocol.logger(), m_props, false)) {
+        if (!XmlWrap::parseChildrenAsProps(m_node, extraPossiblePropsNames, m_protocol.logger(), nodeProps, false)) {
             return false;
         }
 
@@ -119,21 +120,12 @@ bool FieldImpl::parse()
         return false;
     }
 
-    XmlWrap::NamesList expectedProps = commonProps();
-    expectedProps.insert(expectedProps.end(), extraPropsNames.begin(), extraPropsNames.end());
-    expectedProps.insert(expectedProps.end(), extraPossiblePropsNames.begin(), extraPossiblePropsNames.end());
-    if (!updateExtraAttrs(expectedProps)) {
+    if (!updateExtraAttrs({&commonProps(), &extraPropsNames, &extraPossiblePropsNames})) {
         return false;
     }
 
-    auto& commonCh = commonChildren();
     auto& extraChildren = extraChildrenNamesImpl();
-    XmlWrap::NamesList expectedChildren = commonProps();
-    expectedChildren.insert(expectedChildren.end(), commonCh.begin(), commonCh.end());
-    expectedChildren.insert(expectedChildren.end(), extraPropsNames.begin(), extraPropsNames.end());
-    expectedChildren.insert(expectedChildren.end(), extraPossiblePropsNames.begin(), extraPossiblePropsNames.end());
-    expectedChildren.insert(expectedChildren.end(), extraChildren.begin(), extraChildren.end());
-    if (!updateExtraChildren(expectedChildren)) {
+    if (!updateExtraChildren({&commonProps(), &commonChildren(), &extraPropsNames, &extraPossiblePropsNames, &extraChildren})) {
         return false;
     }
     return true;
@@ -327,15 +319,18 @@ bool FieldImpl::verifyAliasedMember(const std::string& fieldName)
     return verifyAliasedMemberImpl(fieldName);
 }
 
-std::string FieldImpl::schemaPos() const
+const std::string& FieldImpl::schemaPos() const
 {
-    return XmlWrap::logPrefix(m_node);
+    return m_schemaPos;
 }
 
 FieldImpl::FieldImpl(::xmlNodePtr node, ProtocolImpl& protocol)
   : m_node(node),
     m_protocol(protocol)
 {
+    if (node != nullptr) {
+        m_schemaPos = XmlWrap::logPrefix(node);
+    }
 }
 
 FieldImpl::FieldImpl(const FieldImpl&) = default;
@@ -360,19 +355,19 @@ Object::ObjKind FieldImpl::objKindImpl() const
     return ObjKind::Field;
 }
 
-const XmlWrap::NamesList& FieldImpl::extraPropsNamesImpl() const
+const XmlWrap::AtomsList& FieldImpl::extraPropsNamesImpl() const
 {
-    return XmlWrap::emptyNamesList();
+    return XmlWrap::emptyAtomsList();
 }
 
-const XmlWrap::NamesList&FieldImpl::extraPossiblePropsNamesImpl() const
+const XmlWrap::AtomsList& FieldImpl::extraPossiblePropsNamesImpl() const
 {
-    return XmlWrap::emptyNamesList();
+    return XmlWrap::emptyAtomsList();
 }
 
-const XmlWrap::NamesList&FieldImpl::extraChildrenNamesImpl() const
+const XmlWrap::AtomsList& FieldImpl::extraChildrenNamesImpl() const
 {
-    static const XmlWrap::NamesList Names;
+    static const XmlWrap::AtomsList Names;
     return Names;
 }
 
@@ -518,28 +513,28 @@ bool FieldImpl::verifyAliasedMemberImpl(const std::string& fieldName) const
     return false;
 }
 
-bool FieldImpl::validateSinglePropInstance(const std::string& str, bool mustHave)
+bool FieldImpl::validateSinglePropInstance(Atom prop, bool mustHave)
 {
-    return XmlWrap::validateSinglePropInstance(m_node, m_props, str, protocol().logger(), mustHave);
+    return XmlWrap::validateSinglePropInstance(m_node, *m_props, prop, protocol().logger(), mustHave);
 }
 
-bool FieldImpl::validateNoPropInstance(const std::string& str)
+bool FieldImpl::validateNoPropInstance(Atom prop)
 {
-    return XmlWrap::validateNoPropInstance(m_node, m_props, str, protocol().logger());
+    return XmlWrap::validateNoPropInstance(m_node, *m_props, prop, protocol().logger());
 }
 
 bool FieldImpl::validateAndUpdateStringPropValue(
-    const std::string& str,
+    Atom prop,
     std::string& value,
     bool mustHave,
     bool allowDeref)
 {
-    if (!validateSinglePropInstance(str, mustHave)) {
+    if (!validateSinglePropInstance(prop, mustHave)) {
         return false;
     }
 
-    auto iter = m_props.find(str);
-    if (iter == m_props.end()) {
+    auto iter = m_props->find(prop);
+    if (iter == m_props->end()) {
         assert(!mustHave);
         return true;
     }
@@ -550,7 +545,7 @@ bool FieldImpl::validateAndUpdateStringPropValue(
     }
 
     if (!protocol().strToStringValue(iter->second, value)) {
-        reportUnexpectedPropertyValue(str, iter->second);
+        reportUnexpectedPropertyValue(prop, iter->second);
         return false;
     }
 
@@ -562,52 +557,57 @@ void FieldImpl::reportUnexpectedPropertyValue(const std::string& propName, const
     XmlWrap::reportUnexpectedPropertyValue(m_node, name(), propName, propValue, protocol().logger());
 }
 
-bool FieldImpl::validateAndUpdateBoolPropValue(const std::string& propName, bool& value, bool mustHave)
+void FieldImpl::reportUnexpectedPropertyValue(Atom prop, const std::string& propValue)
+{
+    reportUnexpectedPropertyValue(atomStr(prop), propValue);
+}
+
+bool FieldImpl::validateAndUpdateBoolPropValue(Atom prop, bool& value, bool mustHave)
 {
-    if (!validateSinglePropInstance(propName, mustHave)) {
+    if (!validateSinglePropInstance(prop, mustHave)) {
         return false;
     }
 
-    auto iter = m_props.find(propName);
-    if (iter == m_props.end()) {
+    auto iter = m_props->find(prop);
+    if (iter == m_props->end()) {
         return true;
     }
 
     bool ok = false;
     value = common::strToBool(iter->second, &ok);
     if (!ok) {
-        reportUnexpectedPropertyValue(propName, iter->second);
+        reportUnexpectedPropertyValue(prop, iter->second);
         return false;
     }
 
     return true;
 }
 
-const XmlWrap::NamesList& FieldImpl::commonProps()
-{
-    static const XmlWrap::NamesList CommonNames = {
-        common::nameStr(),
-        common::displayNameStr(),
-        common::descriptionStr(),
-        common::sinceVersionStr(),
-        common::deprecatedStr(),
-        common::removedStr(),
-        common::reuseStr(),
-        common::semanticTypeStr(),
-        common::pseudoStr(),
-        common::displayReadOnlyStr(),
-        common::displayHiddenStr(),
-        common::customizableStr(),
-        common::failOnInvalidStr()
+const XmlWrap::AtomsList& FieldImpl::commonProps()
+{
+    static const XmlWrap::AtomsList CommonNames = {
+        Atom::Name,
+        Atom::DisplayName,
+        Atom::Description,
+        Atom::SinceVersion,
+        Atom::Deprecated,
+        Atom::Removed,
+        Atom::Reuse,
+        Atom::SemanticType,
+        Atom::Pseudo,
+        Atom::DisplayReadOnly,
+        Atom::DisplayHidden,
+        Atom::Customizable,
+        Atom::FailOnInvalid
     };
 
     return CommonNames;
 }
 
-const XmlWrap::NamesList& FieldImpl::commonChildren()
+const XmlWrap::AtomsList& FieldImpl::commonChildren()
 {
-    static const XmlWrap::NamesList CommonChildren = {
-        common::metaStr()
+    static const XmlWrap::AtomsList CommonChildren = {
+        Atom::Meta
     };
 
     return CommonChildren;
@@ -804,12 +804,12 @@ bool FieldImpl::strToDataOnFields(
 
 bool FieldImpl::checkReuse()
 {
-    if (!validateSinglePropInstance(common::reuseStr())) {
+    if (!validateSinglePropInstance(Atom::Reuse)) {
         return false;
     }
 
-    auto iter = m_props.find(common::reuseStr());
-    if (iter == m_props.end()) {
+    auto iter = m_props->find(Atom::Reuse);
+    if (iter == m_props->end()) {
         return true;
     }
 
@@ -839,30 +839,30 @@ bool FieldImpl::checkReuse()
 
 bool FieldImpl::updateName()
 {
-    return validateAndUpdateStringPropValue(common::nameStr(), m_state.m_name);
+    return validateAndUpdateStringPropValue(Atom::Name, m_state.m_name);
 }
 
 bool FieldImpl::updateDescription()
 {
-    return validateAndUpdateStringPropValue(common::descriptionStr(), m_state.m_description, false, true);
+    return validateAndUpdateStringPropValue(Atom::Description, m_state.m_description, false, true);
 }
 
 bool FieldImpl::updateDisplayName()
 {
-    return validateAndUpdateStringPropValue(common::displayNameStr(), m_state.m_displayName, false, true);
+    return validateAndUpdateStringPropValue(Atom::DisplayName, m_state.m_displayName, false, true);
 }
 
 bool FieldImpl::updateVersions()
 {
-    if (!validateSinglePropInstance(common::sinceVersionStr())) {
+    if (!validateSinglePropInstance(Atom::SinceVersion)) {
         return false;
     }
 
-    if (!validateSinglePropInstance(common::deprecatedStr())) {
+    if (!validateSinglePropInstance(Atom::Deprecated)) {
         return false;
     }
 
-    if (!validateSinglePropInstance(common::removedStr())) {
+    if (!validateSinglePropInstance(Atom::Removed)) {
         return false;
     }
 
@@ -876,7 +876,7 @@ bool FieldImpl::updateVersions()
         deprecated = getParent()->getDeprecated();
     }
 
-    if (!XmlWrap::getAndCheckVersions(m_node, name(), m_props, sinceVersion, deprecated, protocol())) {
+    if (!XmlWrap::getAndCheckVersions(m_node, name(), *m_props, sinceVersion, deprecated, protocol())) {
         return false;
     }
 
@@ -904,8 +904,8 @@ bool FieldImpl::updateVersions()
 
     bool deprecatedRemoved = false;
     do {
-        auto deprecatedRemovedIter = m_props.find(common::removedStr());
-        if (deprecatedRemovedIter == m_props.end()) {
+        auto deprecatedRemovedIter = m_props->find(Atom::Removed);
+        if (deprecatedRemovedIter == m_props->end()) {
             break;
         }
 
@@ -935,12 +935,12 @@ bool FieldImpl::updateVersions()
 
 bool FieldImpl::updateSemanticType()
 {
-    if (!validateSinglePropInstance(common::semanticTypeStr())) {
+    if (!validateSinglePropInstance(Atom::SemanticType)) {
         return false;
     }
 
-    auto iter = m_props.find(common::semanticTypeStr());
-    if (iter == m_props.end()) {
+    auto iter = m_props->find(Atom::SemanticType);
+    if (iter == m_props->end()) {
         return true;
     }
 
@@ -975,59 +975,61 @@ bool FieldImpl::updateSemanticType()
 
 bool FieldImpl::updatePseudo()
 {
-    return validateAndUpdateBoolPropValue(common::pseudoStr(), m_state.m_pseudo);
+    return validateAndUpdateBoolPropValue(Atom::Pseudo, m_state.m_pseudo);
 }
 
 bool FieldImpl::updateDisplayReadOnly()
 {
-    return validateAndUpdateBoolPropValue(common::displayReadOnlyStr(), m_state.m_displayReadOnly);
+    return validateAndUpdateBoolPropValue(Atom::DisplayReadOnly, m_state.m_displayReadOnly);
 }
 
 bool FieldImpl::updateDisplayHidden()
 {
-    return validateAndUpdateBoolPropValue(common::displayHiddenStr(), m_state.m_displayHidden);
+    return validateAndUpdateBoolPropValue(Atom::DisplayHidden, m_state.m_displayHidden);
 }
 
 bool FieldImpl::updateCustomizable()
 {
-    return validateAndUpdateBoolPropValue(common::customizableStr(), m_state.m_customizable);
+    return validateAndUpdateBoolPropValue(Atom::Customizable, m_state.m_customizable);
 }
 
 bool FieldImpl::updateFailOnInvalid()
 {
-    return validateAndUpdateBoolPropValue(common::failOnInvalidStr(), m_state.m_failOnInvalid);
+    return validateAndUpdateBoolPropValue(Atom::FailOnInvalid, m_state.m_failOnInvalid);
 }
 
-bool FieldImpl::updateExtraAttrs(const XmlWrap::NamesList& names)
+bool FieldImpl::updateExtraAttrs(XmlWrap::AtomsListsRefs names)
 {
     auto extraAttrs = XmlWrap::getExtraAttributes(m_node, names, m_protocol);
     if (extraAttrs.empty()) {
         return true;
     }
 
-    if (m_state.m_extraAttrs.empty()) {
-        m_state.m_extraAttrs = std::move(extraAttrs);
+    auto& attrs = m_state.m_extraAttrs.modify();
+    if (attrs.empty()) {
+        attrs = std::move(extraAttrs);
         return true;
     }
 
-    std::move(extraAttrs.begin(), extraAttrs.end(), std::inserter(m_state.m_extraAttrs, m_state.m_extraAttrs.end()));
+    std::move(extraAttrs.begin(), extraAttrs.end(), std::inserter(attrs, attrs.end()));
     return true;
 }
 
-bool FieldImpl::updateExtraChildren(const XmlWrap::NamesList& names)
+bool FieldImpl::updateExtraChildren(XmlWrap::AtomsListsRefs names)
 {
     auto extraChildren = XmlWrap::getExtraChildren(m_node, names, m_protocol);
     if (extraChildren.empty()) {
         return true;
     }
 
-    if (m_state.m_extraChildren.empty()) {
-        m_state.m_extraChildren = std::move(extraChildren);
+    auto& children = m_state.m_extraChildren.modify();
+    if (children.empty()) {
+        children = std::move(extraChildren);
         return true;
     }
 
-    m_state.m_extraChildren.reserve(m_state.m_extraChildren.size() + extraChildren.size());
-    std::move(extraChildren.begin(), extraChildren.end(), std::back_inserter(m_state.m_extraChildren));
+    children.reserve(children.size() + extraChildren.size());
+    std::move(extraChildren.begin(), extraChildren.end(), std::back_inserter(children));
     return true;
 }
 
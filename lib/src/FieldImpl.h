@@ -24,6 +24,7 @@
 #include "XmlWrap.h"
 #include "Logger.h"
 #include "Object.h"
+#include "CopyOnWrite.h"
 
 namespace commsdsl
 {
@@ -34,7 +35,8 @@ class FieldImpl : public Object
     using Base = Object;
 public:
     using Ptr = std::unique_ptr<FieldImpl>;
-    using PropsMap = XmlWrap::PropsMap;
+    using PropsMap = XmlWrap::AtomPropsMap;
+    using AttributesMap = XmlWrap::AttributesMap;
     using ContentsList = XmlWrap::ContentsList;
     using FieldsList = std::vector<Ptr>;
     using Kind = Field::Kind;
@@ -61,7 +63,7 @@ public:
 
     const PropsMap& props() const
     {
-        return m_props;
+        return m_props.get();
     }
 
     const std::string& name() const;
@@ -128,17 +130,17 @@ public:
 
     bool validateMembersNames(const FieldsList& fields);
 
-    const XmlWrap::NamesList& extraPropsNames() const
+    const XmlWrap::AtomsList& extraPropsNames() const
     {
         return extraPropsNamesImpl();
     }
 
-    const XmlWrap::NamesList& extraPossiblePropsNames() const
+    const XmlWrap::AtomsList& extraPossiblePropsNames() const
     {
         return extraPossiblePropsNamesImpl();
     }
 
-    const XmlWrap::NamesList& extraChildrenNames() const
+    const XmlWrap::AtomsList& extraChildrenNames() const
     {
         return extraChildrenNamesImpl();
     }
@@ -161,24 +163,24 @@ public:
 
     bool isComparableToField(const FieldImpl& field) const;
 
-    const PropsMap& extraAttributes() const
+    const AttributesMap& extraAttributes() const
     {
-        return m_state.m_extraAttrs;
+        return m_state.m_extraAttrs.get();
     }
 
-    PropsMap& extraAttributes()
+    AttributesMap& extraAttributes()
     {
-        return m_state.m_extraAttrs;
+        return m_state.m_extraAttrs.modify();
     }
 
     const ContentsList& extraChildren() const
     {
-        return m_state.m_extraChildren;
+        return m_state.m_extraChildren.get();
     }
 
     ContentsList& extraChildren()
     {
-        return m_state.m_extraChildren;
+        return m_state.m_extraChildren.modify();
     }
 
     bool strToNumeric(const std::string& ref, std::intmax_t& val, bool& isBigUnsigned) const
@@ -220,7 +222,17 @@ public:
     bool verifySemanticType(::xmlNodePtr node, SemanticType type) const;
     bool verifyAliasedMember(const std::string& fieldName);
 
-    std::string schemaPos() const;
+    const std::string& schemaPos() const;
+
+    std::uint64_t definitionDigest() const
+    {
+        return m_definitionDigest;
+    }
+
+    void setDefinitionDigest(std::uint64_t value)
+    {
+        m_definitionDigest = value;
+    }
 
 protected:
     FieldImpl(::xmlNodePtr node, ProtocolImpl& protocol);
@@ -258,9 +270,9 @@ protected:
     virtual ObjKind objKindImpl() const override final;
     virtual Kind kindImpl() const = 0;
     virtual Ptr cloneImpl() const = 0;
-    virtual const XmlWrap::NamesList& extraPropsNamesImpl() const;
-    virtual const XmlWrap::NamesList& extraPossiblePropsNamesImpl() const;
-    virtual const XmlWrap::NamesList& extraChildrenNamesImpl() const;
+    virtual const XmlWrap::AtomsList& extraPropsNamesImpl() const;
+    virtual const XmlWrap::AtomsList& extraPossiblePropsNamesImpl() const;
+    virtual const XmlWrap::AtomsList& extraChildrenNamesImpl() const;
     virtual bool reuseImpl(const FieldImpl& other);
     virtual bool parseImpl();
     virtual bool verifySiblingsImpl(const FieldsList& fields) const;
@@ -279,18 +291,19 @@ protected:
     virtual bool verifySemanticTypeImpl(::xmlNodePtr node, SemanticType type) const;
     virtual bool verifyAliasedMemberImpl(const std::string& fieldName) const;
 
-    bool validateSinglePropInstance(const std::string& str, bool mustHave = false);
-    bool validateNoPropInstance(const std::string& str);
+    bool validateSinglePropInstance(Atom prop, bool mustHave = false);
+    bool validateNoPropInstance(Atom prop);
     bool validateAndUpdateStringPropValue(
-            const std::string& str,
+            Atom prop,
             std::string &value,
             bool mustHave = false,
             bool allowDeref = false);
     void reportUnexpectedPropertyValue(const std::string& propName, const std::string& propValue);
-    bool validateAndUpdateBoolPropValue(const std::string& propName, bool& value, bool mustHave = false);
+    void reportUnexpectedPropertyValue(Atom prop, const std::string& propValue);
+    bool validateAndUpdateBoolPropValue(Atom prop, bool& value, bool mustHave = false);
 
-    static const XmlWrap::NamesList& commonProps();
-    static const XmlWrap::NamesList& commonChildren();
+    static const XmlWrap::AtomsList& commonProps();
+    static const XmlWrap::AtomsList& commonChildren();
     const FieldImpl* findSibling(const FieldsList& fields, const std::string& sibName) const;
     static Kind getNonRefFieldKind(const FieldImpl& field);
     bool checkDetachedPrefixAllowed() const;
@@ -336,8 +349,8 @@ private:
         std::string m_name;
         std::string m_displayName;
         std::string m_description;
-        PropsMap m_extraAttrs;
-        ContentsList m_extraChildren;
+        CopyOnWrite<AttributesMap> m_extraAttrs;
+        CopyOnWrite<ContentsList> m_extraChildren;
         SemanticType m_semanticType = SemanticType::None;
         bool m_pseudo = false;
         bool m_displayReadOnly = false;
@@ -357,17 +370,19 @@ private:
     bool updateDisplayHidden();
     bool updateCustomizable();
     bool updateFailOnInvalid();
-    bool updateExtraAttrs(const XmlWrap::NamesList& names);
-    bool updateExtraChildren(const XmlWrap::NamesList& names);
+    bool updateExtraAttrs(XmlWrap::AtomsListsRefs names);
+    bool updateExtraChildren(XmlWrap::AtomsListsRefs names);
 
     bool verifyName() const;
 
     static const CreateMap& createMap();
 
     ::xmlNodePtr m_node = nullptr;
+    std::string m_schemaPos;
     ProtocolImpl& m_protocol;
-    PropsMap m_props;
+    CopyOnWrite<PropsMap> m_props;
     ReusableState m_state;
+    std::uint64_t m_definitionDigest = 0U;
 };
 
 using FieldImplPtr = FieldImpl::Ptr;
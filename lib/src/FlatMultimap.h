@@ -0,0 +1,201 @@
+//
+// Copyright 2018 - 2020 (C). Alex Robenko. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <algorithm>
+#include <utility>
+#include <vector>
+
+namespace commsdsl
+{
+
+// Sorted vector with the subset of std::multimap interface used for
+// the properties of the schema elements. Elements have only few
+// properties, single contiguous storage is cheaper to build and to
+// search than the tree of separately allocated nodes. Elements with
+// equal keys are kept in their insertion order.
+template <typename TKey, typename TValue>
+class FlatMultimap
+{
+public:
+    using key_type = TKey;
+    using mapped_type = TValue;
+    using value_type = std::pair<TKey, TValue>;
+    using Storage = std::vector<value_type>;
+    using size_type = typename Storage::size_type;
+    using iterator = typename Storage::iterator;
+    using const_iterator = typename Storage::const_iterator;
+
+    FlatMultimap() = default;
+
+    template <typename TIter>
+    FlatMultimap(TIter first, TIter last)
+    {
+        insert(first, last);
+    }
+
+    iterator begin() { return m_elems.begin(); }
+    iterator end() { return m_elems.end(); }
+    const_iterator begin() const { return m_elems.begin(); }
+    const_iterator end() const { return m_elems.end(); }
+    const_iterator cbegin() const { return m_elems.cbegin(); }
+    const_iterator cend() const { return m_elems.cend(); }
+
+    bool empty() const
+    {
+        return m_elems.empty();
+    }
+
+    size_type size() const
+    {
+        return m_elems.size();
+    }
+
+    void reserve(size_type count)
+    {
+        m_elems.reserve(count);
+    }
+
+    void clear()
+    {
+        m_elems.clear();
+    }
+
+    iterator lower_bound(const TKey& key)
+    {
+        return std::lower_bound(m_elems.begin(), m_elems.end(), key, KeyLess());
+    }
+
+    const_iterator lower_bound(const TKey& key) const
+    {
+        return std::lower_bound(m_elems.begin(), m_elems.end(), key, KeyLess());
+    }
+
+    iterator upper_bound(const TKey& key)
+    {
+        return std::upper_bound(m_elems.begin(), m_elems.end(), key, KeyLess());
+    }
+
+    const_iterator upper_bound(const TKey& key) const
+    {
+        return std::upper_bound(m_elems.begin(), m_elems.end(), key, KeyLess());
+    }
+
+    std::pair<iterator, iterator> equal_range(const TKey& key)
+    {
+        return std::equal_range(m_elems.begin(), m_elems.end(), key, KeyLess());
+    }
+
+    std::pair<const_iterator, const_iterator> equal_range(const TKey& key) const
+    {
+        return std::equal_range(m_elems.begin(), m_elems.end(), key, KeyLess());
+    }
+
+    iterator find(const TKey& key)
+    {
+        auto iter = lower_bound(key);
+        if ((iter == m_elems.end()) || (key < iter->first)) {
+            return m_elems.end();
+        }
+        return iter;
+    }
+
+    const_iterator find(const TKey& key) const
+    {
+        auto iter = lower_bound(key);
+        if ((iter == m_elems.end()) || (key < iter->first)) {
+            return m_elems.end();
+        }
+        return iter;
+    }
+
+    size_type count(const TKey& key) const
+    {
+        auto range = equal_range(key);
+        return static_cast<size_type>(std::distance(range.first, range.second));
+    }
+
+    iterator insert(const value_type& value)
+    {
+        return m_elems.insert(upper_bound(value.first), value);
+    }
+
+    iterator insert(value_type&& value)
+    {
+        auto pos = upper_bound(value.first);
+        return m_elems.insert(pos, std::move(value));
+    }
+
+    template <typename TIter>
+    void insert(TIter first, TIter last)
+    {
+        for (; first != last; ++first) {
+            insert(value_type(first->first, first->second));
+        }
+    }
+
+    template <typename... TArgs>
+    iterator emplace(TArgs&&... args)
+    {
+        return insert(value_type(std::forward<TArgs>(args)...));
+    }
+
+    iterator erase(const_iterator pos)
+    {
+        return m_elems.erase(pos);
+    }
+
+    iterator erase(const_iterator first, const_iterator last)
+    {
+        return m_elems.erase(first, last);
+    }
+
+    size_type erase(const TKey& key)
+    {
+        auto range = equal_range(key);
+        auto result = static_cast<size_type>(std::distance(range.first, range.second));
+        m_elems.erase(range.first, range.second);
+        return result;
+    }
+
+    bool operator==(const FlatMultimap& other) const
+    {
+        return m_elems == other.m_elems;
+    }
+
+    bool operator!=(const FlatMultimap& other) const
+    {
+        return m_elems != other.m_elems;
+    }
+
+private:
+    struct KeyLess
+    {
+        bool operator()(const value_type& elem, const TKey& key) const
+        {
+            return elem.first < key;
+        }
+
+        bool operator()(const TKey& key, const value_type& elem) const
+        {
+            return key < elem.first;
+        }
+    };
+
+    Storage m_elems;
+};
+
+} // namespace commsdsl
@@ -158,31 +158,31 @@ FieldImpl::Ptr FloatFieldImpl::cloneImpl() const
     return Ptr(new FloatFieldImpl(*this));
 }
 
-const XmlWrap::NamesList&FloatFieldImpl::extraPropsNamesImpl() const
+const XmlWrap::AtomsList& FloatFieldImpl::extraPropsNamesImpl() const
 {
-    static const XmlWrap::NamesList List = {
-        common::typeStr(),
-        common::defaultValueStr(),
-        common::endianStr(),
-        common::validRangeStr(),
-        common::validFullRangeStr(),
-        common::validValueStr(),
-        common::validMinStr(),
-        common::validMaxStr(),
-        common::validCheckVersionStr(),
-        common::unitsStr(),
-        common::displayDesimalsStr(),
-        common::nonUniqueSpecialsAllowedStr(),
-        common::displaySpecialsStr(),
+    static const XmlWrap::AtomsList List = {
+        Atom::Type,
+        Atom::DefaultValue,
+        Atom::Endian,
+        Atom::ValidRange,
+        Atom::ValidFullRange,
+        Atom::ValidValue,
+        Atom::ValidMin,
+        Atom::ValidMax,
+        Atom::ValidCheckVersion,
+        Atom::Units,
+        Atom::DisplayDesimals,
+        Atom::NonUniqueSpecialsAllowed,
+        Atom::DisplaySpecials,
     };
 
     return List;
 }
 
-const XmlWrap::NamesList&FloatFieldImpl::extraChildrenNamesImpl() const
+const XmlWrap::AtomsList& FloatFieldImpl::extraChildrenNamesImpl() const
 {
-    static const XmlWrap::NamesList List = {
-        common::specialStr()
+    static const XmlWrap::AtomsList List = {
+        Atom::Special
     };
 
     return List;
@@ -247,11 +247,11 @@ bool FloatFieldImpl::strToFpImpl(const std::string& ref, double& val) const
 bool FloatFieldImpl::updateType()
 {
     bool mustHave = (m_state.m_type == Type::NumOfValues);
-    if (!validateSinglePropInstance(common::typeStr(), mustHave)) {
+    if (!validateSinglePropInstance(Atom::Type, mustHave)) {
         return false;
     }
 
-    auto propsIter = props().find(common::typeStr());
+    auto propsIter = props().find(Atom::Type);
     if (propsIter == props().end()) {
         assert(!mustHave);
         return true;
@@ -290,11 +290,11 @@ bool FloatFieldImpl::updateType()
 
 bool FloatFieldImpl::updateEndian()
 {
-    if (!validateSinglePropInstance(common::endianStr())) {
+    if (!validateSinglePropInstance(Atom::Endian)) {
         return false;
     }
 
-    auto& endianStr = common::getStringProp(props(), common::endianStr());
+    auto& endianStr = common::getStringProp(props(), Atom::Endian);
     m_state.m_endian = common::parseEndian(endianStr, protocol().schemaImpl().endian());
     if (m_state.m_endian == Endian_NumOfValues) {
         reportUnexpectedPropertyValue(common::endianStr(), endianStr);
@@ -335,11 +335,11 @@ bool FloatFieldImpl::updateMinMaxValues()
 
 bool FloatFieldImpl::updateDefaultValue()
 {
-    if (!validateSinglePropInstance(common::defaultValueStr())) {
+    if (!validateSinglePropInstance(Atom::DefaultValue)) {
         return false;
     }
 
-    auto& valueStr = common::getStringProp(props(), common::defaultValueStr());
+    auto& valueStr = common::getStringProp(props(), Atom::DefaultValue);
     if (valueStr.empty()) {
         return true;
     }
@@ -371,12 +371,12 @@ bool FloatFieldImpl::updateDefaultValue()
 
 bool FloatFieldImpl::updateValidCheckVersion()
 {
-    return validateAndUpdateBoolPropValue(common::validCheckVersionStr(), m_state.m_validCheckVersion);
+    return validateAndUpdateBoolPropValue(Atom::ValidCheckVersion, m_state.m_validCheckVersion);
 }
 
 bool FloatFieldImpl::updateValidRanges()
 {
-    auto attrs = XmlWrap::parseNodeProps(getNode());
+    auto attrs = XmlWrap::parseNodeAtomProps(getNode());
     bool result =
         checkFullRangeProps(attrs) &&
         checkValidRangeProps(attrs) &&
@@ -490,7 +490,7 @@ bool FloatFieldImpl::updateValidRanges()
 
 bool FloatFieldImpl::updateNonUniqueSpecialsAllowed()
 {
-    return validateAndUpdateBoolPropValue(common::nonUniqueSpecialsAllowedStr(), m_state.m_nonUniqueSpecialsAllowed);
+    return validateAndUpdateBoolPropValue(Atom::NonUniqueSpecialsAllowed, m_state.m_nonUniqueSpecialsAllowed);
 }
 
 bool FloatFieldImpl::updateSpecials()
@@ -502,45 +502,45 @@ bool FloatFieldImpl::updateSpecials()
     std::string prevNanSpecial;
 
     for (auto* s : specials) {
-        static const XmlWrap::NamesList PropNames = {
-            common::nameStr(),
-            common::valStr(),
-            common::sinceVersionStr(),
-            common::deprecatedStr(),
-            common::descriptionStr(),
-            common::displayNameStr()
+        static const XmlWrap::AtomsList PropNames = {
+            Atom::Name,
+            Atom::Val,
+            Atom::SinceVersion,
+            Atom::Deprecated,
+            Atom::Description,
+            Atom::DisplayName
         };
 
-        auto props = XmlWrap::parseNodeProps(s);
+        auto props = XmlWrap::parseNodeAtomProps(s);
         if (!XmlWrap::parseChildrenAsProps(s, PropNames, protocol().logger(), props)) {
             return false;
         }
 
-        if (!XmlWrap::validateSinglePropInstance(s, props, common::nameStr(), protocol().logger(), true)) {
+        if (!XmlWrap::validateSinglePropInstance(s, props, Atom::Name, protocol().logger(), true)) {
             return false;
         }
 
-        if (!XmlWrap::validateSinglePropInstance(s, props, common::valStr(), protocol().logger(), true)) {
+        if (!XmlWrap::validateSinglePropInstance(s, props, Atom::Val, protocol().logger(), true)) {
             return false;
         }
 
-        if (!XmlWrap::validateSinglePropInstance(s, props, common::sinceVersionStr(), protocol().logger())) {
+        if (!XmlWrap::validateSinglePropInstance(s, props, Atom::SinceVersion, protocol().logger())) {
             return false;
         }
 
-        if (!XmlWrap::validateSinglePropInstance(s, props, common::deprecatedStr(), protocol().logger())) {
+        if (!XmlWrap::validateSinglePropInstance(s, props, Atom::Deprecated, protocol().logger())) {
             return false;
         }
 
-        if (!XmlWrap::validateSinglePropInstance(s, props, common::descriptionStr(), protocol().logger())) {
+        if (!XmlWrap::validateSinglePropInstance(s, props, Atom::Description, protocol().logger())) {
             return false;
         }
 
-        if (!XmlWrap::validateSinglePropInstance(s, props, common::displayNameStr(), protocol().logger())) {
+        if (!XmlWrap::validateSinglePropInstance(s, props, Atom::DisplayName, protocol().logger())) {
             return false;
         }
 
-        auto nameIter = props.find(common::nameStr());
+        auto nameIter = props.find(Atom::Name);
         assert(nameIter != props.end());
 
         if (!common::isValidName(nameIter->second)) {
@@ -557,7 +557,7 @@ bool FloatFieldImpl::updateSpecials()
             return false;
         }
 
-        auto valIter = props.find(common::valStr());
+        auto valIter = props.find(Atom::Val);
         assert(valIter != props.end());
 
         double val = 0.0;
@@ -616,12 +616,12 @@ bool FloatFieldImpl::updateSpecials()
             return false;
         }
 
-        auto descIter = props.find(common::descriptionStr());
+        auto descIter = props.find(Atom::Description);
         if (descIter != props.end()) {
             info.m_description = descIter->second;
         }
 
-        auto displayNameIter = props.find(common::displayNameStr());
+        auto displayNameIter = props.find(Atom::DisplayName);
         if (displayNameIter != props.end()) {
             info.m_displayName = displayNameIter->second;
         }
@@ -634,11 +634,11 @@ bool FloatFieldImpl::updateSpecials()
 
 bool FloatFieldImpl::updateUnits()
 {
-    if (!validateSinglePropInstance(common::unitsStr())) {
+    if (!validateSinglePropInstance(Atom::Units)) {
         return false;
     }
 
-    auto iter = props().find(common::unitsStr());
+    auto iter = props().find(Atom::Units);
     if (iter == props().end()) {
         return true;
     }
@@ -655,11 +655,11 @@ bool FloatFieldImpl::updateUnits()
 
 bool FloatFieldImpl::updateDisplayDecimals()
 {
-    if (!validateSinglePropInstance(common::displayDesimalsStr())) {
+    if (!validateSinglePropInstance(Atom::DisplayDesimals)) {
         return false;
     }
 
-    auto iter = props().find(common::displayDesimalsStr());
+    auto iter = props().find(Atom::DisplayDesimals);
     if (iter == props().end()) {
         return true;
     }
@@ -676,12 +676,12 @@ bool FloatFieldImpl::updateDisplayDecimals()
 
 bool FloatFieldImpl::updateDisplaySpecials()
 {
-    return validateAndUpdateBoolPropValue(common::displaySpecialsStr(), m_state.m_displaySpecials);
+    return validateAndUpdateBoolPropValue(Atom::DisplaySpecials, m_state.m_displaySpecials);
 }
 
 bool FloatFieldImpl::checkFullRangeAsAttr(const FieldImpl::PropsMap& xmlAttrs)
 {
-    auto iter = xmlAttrs.find(common::validFullRangeStr());
+    auto iter = xmlAttrs.find(Atom::ValidFullRange);
     if (iter == xmlAttrs.end()) {
         return true;
     }
@@ -740,7 +740,7 @@ bool FloatFieldImpl::checkFullRangeAsChild(::xmlNodePtr child)
 
 bool FloatFieldImpl::checkFullRangeProps(const FieldImpl::PropsMap& xmlAttrs)
 {
-    if (!validateSinglePropInstance(common::validFullRangeStr())) {
+    if (!validateSinglePropInstance(Atom::ValidFullRange)) {
         return false;
     }
 
@@ -760,7 +760,7 @@ bool FloatFieldImpl::checkFullRangeProps(const FieldImpl::PropsMap& xmlAttrs)
 
 bool FloatFieldImpl::checkValidRangeAsAttr(const FieldImpl::PropsMap& xmlAttrs)
 {
-    auto iter = xmlAttrs.find(common::validRangeStr());
+    auto iter = xmlAttrs.find(Atom::ValidRange);
     if (iter == xmlAttrs.end()) {
         return true;
     }
@@ -818,7 +818,7 @@ bool FloatFieldImpl::checkValidRangeProps(const FieldImpl::PropsMap& xmlAttrs)
 
 bool FloatFieldImpl::checkValidValueAsAttr(const FieldImpl::PropsMap& xmlAttrs)
 {
-    auto iter = xmlAttrs.find(common::validValueStr());
+    auto iter = xmlAttrs.find(Atom::ValidValue);
     if (iter == xmlAttrs.end()) {
         return true;
     }
@@ -879,7 +879,7 @@ bool FloatFieldImpl::checkValidValueProps(const FieldImpl::PropsMap& xmlAttrs)
 
 bool FloatFieldImpl::checkValidMinAsAttr(const FieldImpl::PropsMap& xmlAttrs)
 {
-    auto iter = xmlAttrs.find(common::validMinStr());
+    auto iter = xmlAttrs.find(Atom::ValidMin);
     if (iter == xmlAttrs.end()) {
         return true;
     }
@@ -940,7 +940,7 @@ bool FloatFieldImpl::checkValidMinProps(const FieldImpl::PropsMap& xmlAttrs)
 
 bool FloatFieldImpl::checkValidMaxAsAttr(const FieldImpl::PropsMap& xmlAttrs)
 {
-    auto iter = xmlAttrs.find(common::validMaxStr());
+    auto iter = xmlAttrs.find(Atom::ValidMax);
     if (iter == xmlAttrs.end()) {
         return true;
     }
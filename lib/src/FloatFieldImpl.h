@@ -91,8 +91,8 @@ public:
 protected:
     virtual Kind kindImpl() const override final;
     virtual Ptr cloneImpl() const override final;
-    virtual const XmlWrap::NamesList& extraPropsNamesImpl() const override final;
-    virtual const XmlWrap::NamesList& extraChildrenNamesImpl() const override final;
+    virtual const XmlWrap::AtomsList& extraPropsNamesImpl() const override final;
+    virtual const XmlWrap::AtomsList& extraChildrenNamesImpl() const override final;
     virtual bool reuseImpl(const FieldImpl& other) override final;
     virtual bool parseImpl() override final;
     virtual std::size_t minLengthImpl() const override final;
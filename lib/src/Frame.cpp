@@ -71,4 +71,10 @@ const Frame::ElementsList& Frame::extraElements() const
     return m_pImpl->extraChildren();
 }
 
+std::uint64_t Frame::definitionDigest() const
+{
+    assert(m_pImpl != nullptr);
+    return m_pImpl->definitionDigest();
+}
+
 } // namespace commsdsl
@@ -51,6 +51,10 @@ FrameImpl::FrameImpl(::xmlNodePtr node, ProtocolImpl& protocol)
 
 bool FrameImpl::parse()
 {
+    if (m_protocol.isDefinitionDigestMode()) {
+        m_definitionDigest = XmlWrap::updateDigest(XmlWrap::initialDigest(), m_node);
+    }
+
     m_props = XmlWrap::parseNodeProps(m_node);
 
     if (!XmlWrap::parseChildrenAsProps(m_node, commonProps(), m_protocol.logger(), m_props)) {
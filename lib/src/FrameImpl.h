@@ -37,6 +37,7 @@ class FrameImpl : public Object
 public:
     using Ptr = std::unique_ptr<FrameImpl>;
     using PropsMap = XmlWrap::PropsMap;
+    using AttributesMap = XmlWrap::AttributesMap;
     using LayersList = Frame::LayersList;
     using ContentsList = XmlWrap::ContentsList;
 
@@ -64,7 +65,17 @@ public:
 
     std::string externalRef() const;
 
-    const PropsMap& extraAttributes() const
+    std::uint64_t definitionDigest() const
+    {
+        return m_definitionDigest;
+    }
+
+    void setDefinitionDigest(std::uint64_t value)
+    {
+        m_definitionDigest = value;
+    }
+
+    const AttributesMap& extraAttributes() const
     {
         return m_extraAttrs;
     }
@@ -99,11 +110,12 @@ private:
     ::xmlNodePtr m_node = nullptr;
     ProtocolImpl& m_protocol;
     PropsMap m_props;
-    PropsMap m_extraAttrs;
+    AttributesMap m_extraAttrs;
     ContentsList m_extraChildren;
 
     const std::string* m_name = nullptr;
     const std::string* m_description = nullptr;
+    std::uint64_t m_definitionDigest = 0U;
     std::vector<LayerImplPtr> m_layers;
 };
 
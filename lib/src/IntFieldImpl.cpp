@@ -315,36 +315,36 @@ FieldImpl::Ptr IntFieldImpl::cloneImpl() const
     return Ptr(new IntFieldImpl(*this));
 }
 
-const XmlWrap::NamesList& IntFieldImpl::extraPropsNamesImpl() const
+const XmlWrap::AtomsList& IntFieldImpl::extraPropsNamesImpl() const
 {
-    static const XmlWrap::NamesList List = {
-        common::typeStr(),
-        common::defaultValueStr(),
-        common::unitsStr(),
-        common::scalingStr(),
-        common::endianStr(),
-        common::lengthStr(),
-        common::bitLengthStr(),
-        common::serOffsetStr(),
-        common::validRangeStr(),
-        common::validValueStr(),
-        common::validMinStr(),
-        common::validMaxStr(),
-        common::validCheckVersionStr(),
-        common::nonUniqueSpecialsAllowedStr(),
-        common::displayDesimalsStr(),
-        common::displayOffsetStr(),
-        common::signExtStr(),
-        common::displaySpecialsStr(),
+    static const XmlWrap::AtomsList List = {
+        Atom::Type,
+        Atom::DefaultValue,
+        Atom::Units,
+        Atom::Scaling,
+        Atom::Endian,
+        Atom::Length,
+        Atom::BitLength,
+        Atom::SerOffset,
+        Atom::ValidRange,
+        Atom::ValidValue,
+        Atom::ValidMin,
+        Atom::ValidMax,
+        Atom::ValidCheckVersion,
+        Atom::NonUniqueSpecialsAllowed,
+        Atom::DisplayDesimals,
+        Atom::DisplayOffset,
+        Atom::SignExt,
+        Atom::DisplaySpecials,
     };
 
     return List;
 }
 
-const XmlWrap::NamesList& IntFieldImpl::extraChildrenNamesImpl() const
+const XmlWrap::AtomsList& IntFieldImpl::extraChildrenNamesImpl() const
 {
-    static const XmlWrap::NamesList List = {
-        common::specialStr()
+    static const XmlWrap::AtomsList List = {
+        Atom::Special
     };
 
     return List;
@@ -437,8 +437,8 @@ bool IntFieldImpl::strToNumericImpl(const std::string& ref, std::intmax_t& val,
         return true;
     }
 
-    auto iter = m_state.m_specials.find(ref);
-    if (iter == m_state.m_specials.end()) {
+    auto iter = m_state.m_specials->find(ref);
+    if (iter == m_state.m_specials->end()) {
         return false;
     }
 
@@ -485,11 +485,11 @@ bool IntFieldImpl::verifySemanticTypeImpl(::xmlNodePtr node, SemanticType type)
 bool IntFieldImpl::updateType()
 {
     bool mustHave = (m_state.m_type == Type::NumOfValues);
-    if (!validateSinglePropInstance(common::typeStr(), mustHave)) {
+    if (!validateSinglePropInstance(Atom::Type, mustHave)) {
         return false;
     }
 
-    auto propsIter = props().find(common::typeStr());
+    auto propsIter = props().find(Atom::Type);
     if (propsIter == props().end()) {
         assert(m_state.m_type != Type::NumOfValues);
         return true;
@@ -517,11 +517,11 @@ bool IntFieldImpl::updateType()
 
 bool IntFieldImpl::updateEndian()
 {
-    if (!validateSinglePropInstance(common::endianStr())) {
+    if (!validateSinglePropInstance(Atom::Endian)) {
         return false;
     }
 
-    auto& endianStr = common::getStringProp(props(), common::endianStr());
+    auto& endianStr = common::getStringProp(props(), Atom::Endian);
     if ((endianStr.empty()) && (m_state.m_endian != Endian_NumOfValues)) {
         return true;
     }
@@ -536,12 +536,12 @@ bool IntFieldImpl::updateEndian()
 
 bool IntFieldImpl::updateLength()
 {
-    if (!validateSinglePropInstance(common::lengthStr())) {
+    if (!validateSinglePropInstance(Atom::Length)) {
         return false;
     }
 
     auto maxLength = maxTypeLength(m_state.m_type);
-    auto& lengthStr = common::getStringProp(props(), common::lengthStr());
+    auto& lengthStr = common::getStringProp(props(), Atom::Length);
     if (lengthStr.empty()) {
         if (m_state.m_length == 0) {
             m_state.m_length = maxLength;
@@ -587,13 +587,13 @@ bool IntFieldImpl::updateLength()
 
 bool IntFieldImpl::updateBitLength()
 {
-    if (!validateSinglePropInstance(common::bitLengthStr())) {
+    if (!validateSinglePropInstance(Atom::BitLength)) {
         return false;
     }
 
     auto maxBitLength = m_state.m_length * BitsInByte;
     assert((m_state.m_bitLength == 0) || (m_state.m_bitLength == maxBitLength));
-    auto& valStr = common::getStringProp(props(), common::bitLengthStr());
+    auto& valStr = common::getStringProp(props(), Atom::BitLength);
     if (valStr.empty()) {
         assert(0 < m_state.m_length);
         if (m_state.m_bitLength == 0) {
@@ -629,11 +629,11 @@ bool IntFieldImpl::updateBitLength()
 
 bool IntFieldImpl::updateSerOffset()
 {
-    if (!validateSinglePropInstance(common::serOffsetStr())) {
+    if (!validateSinglePropInstance(Atom::SerOffset)) {
         return false;
     }
 
-    auto& valueStr = common::getStringProp(props(), common::serOffsetStr());
+    auto& valueStr = common::getStringProp(props(), Atom::SerOffset);
 
     if (valueStr.empty()) {
         return true;
@@ -731,11 +731,11 @@ bool IntFieldImpl::updateMinMaxValues()
 
 bool IntFieldImpl::updateDefaultValue()
 {
-    if (!validateSinglePropInstance(common::defaultValueStr())) {
+    if (!validateSinglePropInstance(Atom::DefaultValue)) {
         return false;
     }
 
-    auto& valueStr = common::getStringProp(props(), common::defaultValueStr());
+    auto& valueStr = common::getStringProp(props(), Atom::DefaultValue);
     if (valueStr.empty()) {
         return true;
     }
@@ -797,7 +797,7 @@ bool IntFieldImpl::updateDefaultValue()
 
 bool IntFieldImpl::updateScaling()
 {
-    if (!validateSinglePropInstance(common::scalingStr())) {
+    if (!validateSinglePropInstance(Atom::Scaling)) {
         return false;
     }
 
@@ -811,7 +811,7 @@ bool IntFieldImpl::updateScaling()
     }
 
     do {
-        auto& valueStr = common::getStringProp(props(), common::scalingStr());
+        auto& valueStr = common::getStringProp(props(), Atom::Scaling);
         if (valueStr.empty()) {
             break;
         }
@@ -879,12 +879,12 @@ bool IntFieldImpl::updateScaling()
 
 bool IntFieldImpl::updateValidCheckVersion()
 {
-    return validateAndUpdateBoolPropValue(common::validCheckVersionStr(), m_state.m_validCheckVersion);
+    return validateAndUpdateBoolPropValue(Atom::ValidCheckVersion, m_state.m_validCheckVersion);
 }
 
 bool IntFieldImpl::updateValidRanges()
 {
-    auto attrs = XmlWrap::parseNodeProps(getNode());
+    auto attrs = XmlWrap::parseNodeAtomProps(getNode());
     bool result =
         checkValidRangeProps(attrs) &&
         checkValidValueProps(attrs) &&
@@ -995,7 +995,7 @@ bool IntFieldImpl::updateValidRanges()
 
 bool IntFieldImpl::updateNonUniqueSpecialsAllowed()
 {
-    return validateAndUpdateBoolPropValue(common::nonUniqueSpecialsAllowedStr(), m_state.m_nonUniqueSpecialsAllowed);
+    return validateAndUpdateBoolPropValue(Atom::NonUniqueSpecialsAllowed, m_state.m_nonUniqueSpecialsAllowed);
 }
 
 bool IntFieldImpl::updateSpecials()
@@ -1007,45 +1007,45 @@ bool IntFieldImpl::updateSpecials()
     RecSpecials recSpecials;
 
     for (auto* s : specials) {
-        static const XmlWrap::NamesList PropNames = {
-            common::nameStr(),
-            common::valStr(),
-            common::sinceVersionStr(),
-            common::deprecatedStr(),
-            common::descriptionStr(),
-            common::displayNameStr(),
+        static const XmlWrap::AtomsList PropNames = {
+            Atom::Name,
+            Atom::Val,
+            Atom::SinceVersion,
+            Atom::Deprecated,
+            Atom::Description,
+            Atom::DisplayName,
         };
 
-        auto props = XmlWrap::parseNodeProps(s);
+        auto props = XmlWrap::parseNodeAtomProps(s);
         if (!XmlWrap::parseChildrenAsProps(s, PropNames, protocol().logger(), props)) {
             return false;
         }
 
-        if (!XmlWrap::validateSinglePropInstance(s, props, common::nameStr(), protocol().logger(), true)) {
+        if (!XmlWrap::validateSinglePropInstance(s, props, Atom::Name, protocol().logger(), true)) {
             return false;
         }
 
-        if (!XmlWrap::validateSinglePropInstance(s, props, common::valStr(), protocol().logger(), true)) {
+        if (!XmlWrap::validateSinglePropInstance(s, props, Atom::Val, protocol().logger(), true)) {
             return false;
         }
 
-        if (!XmlWrap::validateSinglePropInstance(s, props, common::sinceVersionStr(), protocol().logger())) {
+        if (!XmlWrap::validateSinglePropInstance(s, props, Atom::SinceVersion, protocol().logger())) {
             return false;
         }
 
-        if (!XmlWrap::validateSinglePropInstance(s, props, common::deprecatedStr(), protocol().logger())) {
+        if (!XmlWrap::validateSinglePropInstance(s, props, Atom::Deprecated, protocol().logger())) {
             return false;
         }
 
-        if (!XmlWrap::validateSinglePropInstance(s, props, common::descriptionStr(), protocol().logger())) {
+        if (!XmlWrap::validateSinglePropInstance(s, props, Atom::Description, protocol().logger())) {
             return false;
         }
 
-        if (!XmlWrap::validateSinglePropInstance(s, props, common::displayNameStr(), protocol().logger())) {
+        if (!XmlWrap::validateSinglePropInstance(s, props, Atom::DisplayName, protocol().logger())) {
             return false;
         }
 
-        auto nameIter = props.find(common::nameStr());
+        auto nameIter = props.find(Atom::Name);
         assert(nameIter != props.end());
 
         if (!common::isValidName(nameIter->second)) {
@@ -1055,14 +1055,14 @@ bool IntFieldImpl::updateSpecials()
             return false;
         }
 
-        auto specialsIter = m_state.m_specials.find(nameIter->second);
-        if (specialsIter != m_state.m_specials.end()) {
+        auto specialsIter = m_state.m_specials->find(nameIter->second);
+        if (specialsIter != m_state.m_specials->end()) {
             logError() << XmlWrap::logPrefix(s) << "Special with name \"" << nameIter->second <<
                           "\" was already assigned to \"" << name() << "\" element.";
             return false;
         }
 
-        auto valIter = props.find(common::valStr());
+        auto valIter = props.find(Atom::Val);
         assert(valIter != props.end());
 
         std::intmax_t val = 0;
@@ -1125,17 +1125,17 @@ bool IntFieldImpl::updateSpecials()
             return false;
         }
 
-        auto descIter = props.find(common::descriptionStr());
+        auto descIter = props.find(Atom::Description);
         if (descIter != props.end()) {
             info.m_description = descIter->second;
         }
 
-        auto displayNameIter = props.find(common::displayNameStr());
+        auto displayNameIter = props.find(Atom::DisplayName);
         if (displayNameIter != props.end()) {
             info.m_displayName = displayNameIter->second;
         }
 
-        m_state.m_specials.emplace(nameIter->second, info);
+        m_state.m_specials.modify().emplace(nameIter->second, info);
     }
 
     return true;
@@ -1143,11 +1143,11 @@ bool IntFieldImpl::updateSpecials()
 
 bool IntFieldImpl::updateUnits()
 {
-    if (!validateSinglePropInstance(common::unitsStr())) {
+    if (!validateSinglePropInstance(Atom::Units)) {
         return false;
     }
 
-    auto iter = props().find(common::unitsStr());
+    auto iter = props().find(Atom::Units);
     if (iter == props().end()) {
         return true;
     }
@@ -1164,11 +1164,11 @@ bool IntFieldImpl::updateUnits()
 
 bool IntFieldImpl::updateDisplayDecimals()
 {
-    if (!validateSinglePropInstance(common::displayDesimalsStr())) {
+    if (!validateSinglePropInstance(Atom::DisplayDesimals)) {
         return false;
     }
 
-    auto iter = props().find(common::displayDesimalsStr());
+    auto iter = props().find(Atom::DisplayDesimals);
     if (iter == props().end()) {
         return true;
     }
@@ -1185,11 +1185,11 @@ bool IntFieldImpl::updateDisplayDecimals()
 
 bool IntFieldImpl::updateDisplayOffset()
 {
-    if (!validateSinglePropInstance(common::displayOffsetStr())) {
+    if (!validateSinglePropInstance(Atom::DisplayOffset)) {
         return false;
     }
 
-    auto iter = props().find(common::displayOffsetStr());
+    auto iter = props().find(Atom::DisplayOffset);
     if (iter == props().end()) {
         return true;
     }
@@ -1206,11 +1206,11 @@ bool IntFieldImpl::updateDisplayOffset()
 
 bool IntFieldImpl::updateSignExt()
 {
-    if (!validateAndUpdateBoolPropValue(common::signExtStr(), m_state.m_signExt)) {
+    if (!validateAndUpdateBoolPropValue(Atom::SignExt, m_state.m_signExt)) {
         return false;
     }
 
-    auto& valueStr = common::getStringProp(props(), common::signExtStr());
+    auto& valueStr = common::getStringProp(props(), Atom::SignExt);
     if (valueStr.empty()) {
         return true;
     }
@@ -1226,13 +1226,13 @@ bool IntFieldImpl::updateSignExt()
 
 bool IntFieldImpl::updateDisplaySpecials()
 {
-    return validateAndUpdateBoolPropValue(common::displaySpecialsStr(), m_state.m_displaySpecials);
+    return validateAndUpdateBoolPropValue(Atom::DisplaySpecials, m_state.m_displaySpecials);
 }
 
 
 bool IntFieldImpl::checkValidRangeAsAttr(const FieldImpl::PropsMap& xmlAttrs)
 {
-    auto iter = xmlAttrs.find(common::validRangeStr());
+    auto iter = xmlAttrs.find(Atom::ValidRange);
     if (iter == xmlAttrs.end()) {
         return true;
     }
@@ -1290,7 +1290,7 @@ bool IntFieldImpl::checkValidRangeProps(const FieldImpl::PropsMap& xmlAttrs)
 
 bool IntFieldImpl::checkValidValueAsAttr(const FieldImpl::PropsMap& xmlAttrs)
 {
-    auto iter = xmlAttrs.find(common::validValueStr());
+    auto iter = xmlAttrs.find(Atom::ValidValue);
     if (iter == xmlAttrs.end()) {
         return true;
     }
@@ -1351,7 +1351,7 @@ bool IntFieldImpl::checkValidValueProps(const FieldImpl::PropsMap& xmlAttrs)
 
 bool IntFieldImpl::checkValidMinAsAttr(const FieldImpl::PropsMap& xmlAttrs)
 {
-    auto iter = xmlAttrs.find(common::validMinStr());
+    auto iter = xmlAttrs.find(Atom::ValidMin);
     if (iter == xmlAttrs.end()) {
         return true;
     }
@@ -1412,7 +1412,7 @@ bool IntFieldImpl::checkValidMinProps(const FieldImpl::PropsMap& xmlAttrs)
 
 bool IntFieldImpl::checkValidMaxAsAttr(const FieldImpl::PropsMap& xmlAttrs)
 {
-    auto iter = xmlAttrs.find(common::validMaxStr());
+    auto iter = xmlAttrs.find(Atom::ValidMax);
     if (iter == xmlAttrs.end()) {
         return true;
     }
@@ -1581,8 +1581,8 @@ bool IntFieldImpl::strToValue(
 {
     if (common::isValidName(str)) {
         // Check among specials
-        auto iter = m_state.m_specials.find(str);
-        if (iter != m_state.m_specials.end()) {
+        auto iter = m_state.m_specials->find(str);
+        if (iter != m_state.m_specials->end()) {
             val = iter->second.m_value;
             return true;
         }
@@ -84,7 +84,7 @@ public:
 
     const SpecialValues& specialValues() const
     {
-        return m_state.m_specials;
+        return *m_state.m_specials;
     }
 
     bool validCheckVersion() const
@@ -135,8 +135,8 @@ public:
 protected:
     virtual Kind kindImpl() const override final;
     virtual Ptr cloneImpl() const override final;
-    virtual const XmlWrap::NamesList& extraPropsNamesImpl() const override final;
-    virtual const XmlWrap::NamesList& extraChildrenNamesImpl() const override final;
+    virtual const XmlWrap::AtomsList& extraPropsNamesImpl() const override final;
+    virtual const XmlWrap::AtomsList& extraChildrenNamesImpl() const override final;
     virtual bool reuseImpl(const FieldImpl& other) override final;
     virtual bool parseImpl() override final;
     virtual std::size_t minLengthImpl() const override final;
@@ -196,7 +196,7 @@ private:
         std::intmax_t m_defaultValue = 0;
         ScalingRatio m_scaling;
         ValidRangesList m_validRanges;
-        SpecialValues m_specials;
+        CopyOnWrite<SpecialValues> m_specials;
         Units m_units = Units::Unknown;
         unsigned m_displayDecimals = 0U;
         std::intmax_t m_displayOffset = 0U;
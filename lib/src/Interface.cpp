@@ -77,4 +77,10 @@ const Interface::ElementsList& Interface::extraElements() const
     return m_pImpl->extraChildren();
 }
 
+std::uint64_t Interface::definitionDigest() const
+{
+    assert(m_pImpl != nullptr);
+    return m_pImpl->definitionDigest();
+}
+
 } // namespace commsdsl
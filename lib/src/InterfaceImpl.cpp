@@ -52,6 +52,10 @@ InterfaceImpl::InterfaceImpl(::xmlNodePtr node, ProtocolImpl& protocol)
 
 bool InterfaceImpl::parse()
 {
+    if (m_protocol.isDefinitionDigestMode()) {
+        m_definitionDigest = XmlWrap::updateDigest(XmlWrap::initialDigest(), m_node);
+    }
+
     m_props = XmlWrap::parseNodeProps(m_node);
 
     if (!XmlWrap::parseChildrenAsProps(m_node, commonProps(), m_protocol.logger(), m_props)) {
@@ -248,6 +252,11 @@ bool InterfaceImpl::copyFields()
     }
 
     cloneFieldsFrom(*m_copyFieldsFromInterface);
+
+    if (m_protocol.isDefinitionDigestMode()) {
+        // Changes in the copied interface must be propagated
+        m_definitionDigest = XmlWrap::combineDigests(m_definitionDigest, m_copyFieldsFromInterface->m_definitionDigest);
+    }
     return true;
 }
 
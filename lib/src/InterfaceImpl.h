@@ -38,6 +38,7 @@ class InterfaceImpl : public Object
 public:
     using Ptr = std::unique_ptr<InterfaceImpl>;
     using PropsMap = XmlWrap::PropsMap;
+    using AttributesMap = XmlWrap::AttributesMap;
     using FieldsList = Interface::FieldsList;
     using AliasesList = Interface::AliasesList;
     using ContentsList = XmlWrap::ContentsList;
@@ -68,7 +69,17 @@ public:
 
     std::string externalRef() const;
 
-    const PropsMap& extraAttributes() const
+    std::uint64_t definitionDigest() const
+    {
+        return m_definitionDigest;
+    }
+
+    void setDefinitionDigest(std::uint64_t value)
+    {
+        m_definitionDigest = value;
+    }
+
+    const AttributesMap& extraAttributes() const
     {
         return m_extraAttrs;
     }
@@ -109,11 +120,12 @@ private:
     ::xmlNodePtr m_node = nullptr;
     ProtocolImpl& m_protocol;
     PropsMap m_props;
-    PropsMap m_extraAttrs;
+    AttributesMap m_extraAttrs;
     ContentsList m_extraChildren;
 
     const std::string* m_name = nullptr;
     const std::string* m_description = nullptr;
+    std::uint64_t m_definitionDigest = 0U;
     const InterfaceImpl* m_copyFieldsFromInterface = nullptr;
     std::vector<FieldImplPtr> m_fields;
     std::vector<AliasImplPtr> m_aliases;
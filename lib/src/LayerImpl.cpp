@@ -87,20 +87,12 @@ bool LayerImpl::parse()
         return false;
     }
 
-    XmlWrap::NamesList expectedProps = commonProps();
-    expectedProps.insert(expectedProps.end(), commonPossibleProps().begin(), commonPossibleProps().end());
-    expectedProps.insert(expectedProps.end(), extraPropsNames.begin(), extraPropsNames.end());
-    if (!updateExtraAttrs(expectedProps)) {
+    if (!updateExtraAttrs({&commonProps(), &commonPossibleProps(), &extraPropsNames})) {
         return false;
     }
 
-    XmlWrap::NamesList expectedChildren = commonProps();
-    expectedChildren.insert(expectedChildren.end(), commonPossibleProps().begin(), commonPossibleProps().end());
-    expectedChildren.insert(expectedChildren.end(), extraPropsNames.begin(), extraPropsNames.end());
-
-    auto supportedFields = FieldImpl::supportedTypes();
-    expectedChildren.insert(expectedChildren.end(), supportedFields.begin(), supportedFields.end());
-    if (!updateExtraChildren(expectedChildren)) {
+    static const XmlWrap::NamesList SupportedFields = FieldImpl::supportedTypes();
+    if (!updateExtraChildren({&commonProps(), &commonPossibleProps(), &extraPropsNames, &SupportedFields})) {
         return false;
     }
     return true;
@@ -361,7 +353,7 @@ bool LayerImpl::updateField()
     return false;
 }
 
-bool LayerImpl::updateExtraAttrs(const XmlWrap::NamesList& names)
+bool LayerImpl::updateExtraAttrs(XmlWrap::NamesListsRefs names)
 {
     auto extraAttrs = XmlWrap::getExtraAttributes(m_node, names, m_protocol);
     if (extraAttrs.empty()) {
@@ -377,7 +369,7 @@ bool LayerImpl::updateExtraAttrs(const XmlWrap::NamesList& names)
     return true;
 }
 
-bool LayerImpl::updateExtraChildren(const XmlWrap::NamesList& names)
+bool LayerImpl::updateExtraChildren(XmlWrap::NamesListsRefs names)
 {
     auto extraChildren = XmlWrap::getExtraChildren(m_node, names, m_protocol);
     if (extraChildren.empty()) {
@@ -36,6 +36,7 @@ class LayerImpl : public Object
 public:
     using Ptr = std::unique_ptr<LayerImpl>;
     using PropsMap = XmlWrap::PropsMap;
+    using AttributesMap = XmlWrap::AttributesMap;
     using ContentsList = XmlWrap::ContentsList;
     using LayersList = std::vector<Ptr>;
     using Kind = Layer::Kind;
@@ -90,12 +91,12 @@ public:
         return extraPropsNamesImpl();
     }
 
-    const PropsMap& extraAttributes() const
+    const AttributesMap& extraAttributes() const
     {
         return m_extraAttrs;
     }
 
-    PropsMap& extraAttributes()
+    AttributesMap& extraAttributes()
     {
         return m_extraAttrs;
     }
@@ -156,8 +157,8 @@ private:
     bool updateName();
     bool updateDescription();
     bool updateField();
-    bool updateExtraAttrs(const XmlWrap::NamesList& names);
-    bool updateExtraChildren(const XmlWrap::NamesList& names);
+    bool updateExtraAttrs(XmlWrap::NamesListsRefs names);
+    bool updateExtraChildren(XmlWrap::NamesListsRefs names);
     bool checkFieldFromRef();
     bool checkFieldAsChild();
 
@@ -170,7 +171,7 @@ private:
     const std::string* m_description = nullptr;
     const FieldImpl* m_extField = nullptr;
     FieldImplPtr m_field;
-    PropsMap m_extraAttrs;
+    AttributesMap m_extraAttrs;
     ContentsList m_extraChildren;
 };
 
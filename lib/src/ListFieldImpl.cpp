@@ -37,13 +37,13 @@ const XmlWrap::NamesList& listSupportedTypes()
     return Names;
 }
 
-XmlWrap::NamesList getExtraNames()
+XmlWrap::AtomsList getExtraNames()
 {
-    auto names = listSupportedTypes();
-    names.push_back(common::elementStr());
-    names.push_back(common::countPrefixStr());
-    names.push_back(common::lengthPrefixStr());
-    names.push_back(common::elemLengthPrefixStr());
+    auto names = toAtoms(listSupportedTypes());
+    names.push_back(Atom::Element);
+    names.push_back(Atom::CountPrefix);
+    names.push_back(Atom::LengthPrefix);
+    names.push_back(Atom::ElemLengthPrefix);
     return names;
 }
 
@@ -72,30 +72,30 @@ FieldImpl::Ptr ListFieldImpl::cloneImpl() const
     return Ptr(new ListFieldImpl(*this));
 }
 
-const XmlWrap::NamesList& ListFieldImpl::extraPropsNamesImpl() const
+const XmlWrap::AtomsList& ListFieldImpl::extraPropsNamesImpl() const
 {
-    static const XmlWrap::NamesList List = {
-        common::countStr(),
-        common::elemFixedLengthStr()
+    static const XmlWrap::AtomsList List = {
+        Atom::Count,
+        Atom::ElemFixedLength
     };
 
     return List;
 }
 
-const XmlWrap::NamesList& ListFieldImpl::extraPossiblePropsNamesImpl() const
+const XmlWrap::AtomsList& ListFieldImpl::extraPossiblePropsNamesImpl() const
 {
-    static const XmlWrap::NamesList List = {
-        common::elementStr(),
-        common::countPrefixStr(),
-        common::lengthPrefixStr(),
-        common::elemLengthPrefixStr(),
+    static const XmlWrap::AtomsList List = {
+        Atom::Element,
+        Atom::CountPrefix,
+        Atom::LengthPrefix,
+        Atom::ElemLengthPrefix,
     };
     return List;
 }
 
-const XmlWrap::NamesList& ListFieldImpl::extraChildrenNamesImpl() const
+const XmlWrap::AtomsList& ListFieldImpl::extraChildrenNamesImpl() const
 {
-    static const XmlWrap::NamesList List = getExtraNames();
+    static const XmlWrap::AtomsList List = getExtraNames();
     return List;
 }
 
@@ -264,11 +264,11 @@ bool ListFieldImpl::updateElement()
 
 bool ListFieldImpl::updateCount()
 {
-    if (!validateSinglePropInstance(common::countStr())) {
+    if (!validateSinglePropInstance(Atom::Count)) {
         return false;
     }
 
-    auto iter = props().find(common::countStr());
+    auto iter = props().find(Atom::Count);
     if (iter == props().end()) {
         return true;
     }
@@ -292,8 +292,8 @@ bool ListFieldImpl::updateCount()
 
 bool ListFieldImpl::updateCountPrefix()
 {
-    if ((!checkPrefixFromRef(common::countPrefixStr(), m_state.m_extCountPrefixField, m_countPrefixField, m_state.m_detachedCountPrefixField)) ||
-        (!checkPrefixAsChild(common::countPrefixStr(), m_state.m_extCountPrefixField, m_countPrefixField, m_state.m_detachedCountPrefixField))) {
+    if ((!checkPrefixFromRef(Atom::CountPrefix, m_state.m_extCountPrefixField, m_countPrefixField, m_state.m_detachedCountPrefixField)) ||
+        (!checkPrefixAsChild(Atom::CountPrefix, m_state.m_extCountPrefixField, m_countPrefixField, m_state.m_detachedCountPrefixField))) {
         return false;
     }
 
@@ -318,8 +318,8 @@ bool ListFieldImpl::updateCountPrefix()
 
 bool ListFieldImpl::updateLengthPrefix()
 {
-    if ((!checkPrefixFromRef(common::lengthPrefixStr(), m_state.m_extLengthPrefixField, m_lengthPrefixField, m_state.m_detachedLengthPrefixField)) ||
-        (!checkPrefixAsChild(common::lengthPrefixStr(), m_state.m_extLengthPrefixField, m_lengthPrefixField, m_state.m_detachedLengthPrefixField))) {
+    if ((!checkPrefixFromRef(Atom::LengthPrefix, m_state.m_extLengthPrefixField, m_lengthPrefixField, m_state.m_detachedLengthPrefixField)) ||
+        (!checkPrefixAsChild(Atom::LengthPrefix, m_state.m_extLengthPrefixField, m_lengthPrefixField, m_state.m_detachedLengthPrefixField))) {
         return false;
     }
 
@@ -344,8 +344,8 @@ bool ListFieldImpl::updateLengthPrefix()
 
 bool ListFieldImpl::updateElemLengthPrefix()
 {
-    if ((!checkPrefixFromRef(common::elemLengthPrefixStr(), m_state.m_extElemLengthPrefixField, m_elemLengthPrefixField, m_state.m_detachedElemLengthPrefixField)) ||
-        (!checkPrefixAsChild(common::elemLengthPrefixStr(), m_state.m_extElemLengthPrefixField, m_elemLengthPrefixField, m_state.m_detachedElemLengthPrefixField))) {
+    if ((!checkPrefixFromRef(Atom::ElemLengthPrefix, m_state.m_extElemLengthPrefixField, m_elemLengthPrefixField, m_state.m_detachedElemLengthPrefixField)) ||
+        (!checkPrefixAsChild(Atom::ElemLengthPrefix, m_state.m_extElemLengthPrefixField, m_elemLengthPrefixField, m_state.m_detachedElemLengthPrefixField))) {
         return false;
     }
 
@@ -362,12 +362,12 @@ bool ListFieldImpl::updateElemLengthPrefix()
 
 bool ListFieldImpl::updateElemFixedLength()
 {
-    if (!validateSinglePropInstance(common::elemFixedLengthStr())) {
+    if (!validateSinglePropInstance(Atom::ElemFixedLength)) {
         return false;
     }
 
     do {
-        auto iter = props().find(common::elemFixedLengthStr());
+        auto iter = props().find(Atom::ElemFixedLength);
         if (iter == props().end()) {
             break;
         }
@@ -397,11 +397,11 @@ bool ListFieldImpl::updateElemFixedLength()
 
 bool ListFieldImpl::checkElementFromRef()
 {
-    if (!validateSinglePropInstance(common::elementStr())) {
+    if (!validateSinglePropInstance(Atom::Element)) {
         return false;
     }
 
-    auto iter = props().find(common::elementStr());
+    auto iter = props().find(Atom::Element);
     if (iter == props().end()) {
         return true;
     }
@@ -466,7 +466,7 @@ bool ListFieldImpl::checkElementAsChild()
             return false;
         }
 
-        if (props().find(common::elementStr()) != props().end()) {
+        if (props().find(Atom::Element) != props().end()) {
             logError() << "There must be only one occurance of \"" << common::elementStr() << "\" definition.";
             return false;
         }
@@ -491,7 +491,7 @@ bool ListFieldImpl::checkElementAsChild()
             return false;
         }
 
-        if (props().find(common::elementStr()) == props().end()) {
+        if (props().find(Atom::Element) == props().end()) {
             if (!fields.empty()) {
                 fieldNode = fields.front();
                 break;
@@ -535,16 +535,17 @@ bool ListFieldImpl::checkElementAsChild()
 }
 
 bool ListFieldImpl::checkPrefixFromRef(
-    const std::string& type,
+    Atom prop,
     const FieldImpl*& extField,
     FieldImplPtr& locField,
     std::string& detachedPrefix)
 {
-    if (!validateSinglePropInstance(type)) {
+    if (!validateSinglePropInstance(prop)) {
         return false;
     }
 
-    auto iter = props().find(type);
+    auto& type = atomStr(prop);
+    auto iter = props().find(prop);
     if (iter == props().end()) {
         return true;
     }
@@ -595,11 +596,12 @@ bool ListFieldImpl::checkPrefixFromRef(
 }
 
 bool ListFieldImpl::checkPrefixAsChild(
-    const std::string& type,
+    Atom prop,
     const FieldImpl*& extField,
     FieldImplPtr& locField,
     std::string& detachedPrefix)
 {
+    auto& type = atomStr(prop);
     auto children = XmlWrap::getChildren(getNode(), type);
     if (children.empty()) {
         return true;
@@ -619,7 +621,7 @@ bool ListFieldImpl::checkPrefixAsChild(
         return false;
     }
 
-    auto iter = props().find(type);
+    auto iter = props().find(prop);
     bool hasInProps = iter != props().end();
     if (prefixFields.empty()) {
         if (hasInProps) {
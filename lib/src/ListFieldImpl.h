@@ -123,9 +123,9 @@ public:
 protected:
     virtual Kind kindImpl() const override final;
     virtual Ptr cloneImpl() const override final;
-    virtual const XmlWrap::NamesList& extraPropsNamesImpl() const override final;
-    virtual const XmlWrap::NamesList& extraPossiblePropsNamesImpl() const override final;
-    virtual const XmlWrap::NamesList& extraChildrenNamesImpl() const override final;
+    virtual const XmlWrap::AtomsList& extraPropsNamesImpl() const override final;
+    virtual const XmlWrap::AtomsList& extraPossiblePropsNamesImpl() const override final;
+    virtual const XmlWrap::AtomsList& extraChildrenNamesImpl() const override final;
     virtual bool reuseImpl(const FieldImpl& other) override final;
     virtual bool parseImpl() override final;
     virtual bool verifySiblingsImpl(const FieldsList& fields) const override final;
@@ -143,12 +143,12 @@ private:
     bool checkElementFromRef();
     bool checkElementAsChild();
     bool checkPrefixFromRef(
-        const std::string& type,
+        Atom prop,
         const FieldImpl*& extField,
         FieldImplPtr& locField,
         std::string& detachedPrefix);
     bool checkPrefixAsChild(
-        const std::string& type,
+        Atom prop,
         const FieldImpl*& extField,
         FieldImplPtr& locField,
         std::string& detachedPrefix);
@@ -16,6 +16,7 @@
 #pragma once
 
 #include <sstream>
+#include <mutex>
 
 #include "commsdsl/ErrorLevel.h"
 #include "commsdsl/Protocol.h"
@@ -43,72 +44,87 @@ public:
         m_minLevel = val;
     }
 
-    void setCurrLevel(ErrorLevel val)
+    bool isEnabled(ErrorLevel level) const
     {
-        m_currLevel = val;
+        return m_minLevel <= level;
     }
 
-    void flush()
+    void log(ErrorLevel level, const std::string& msg)
     {
-        if (m_minLevel <= m_currLevel) {
-            m_func(m_currLevel, m_stream.str());
-            m_stream = std::stringstream();
+        if (!isEnabled(level)) {
+            return;
         }
-    }
 
-    template <typename T>
-    Logger& operator<<(T&& val)
-    {
-        if (m_minLevel <= m_currLevel) {
-            m_stream << std::forward<T>(val);
-        }
-        return *this;
+        // The report function may be invoked by const queries
+        // of the same protocol object from multiple threads.
+        std::lock_guard<std::mutex> guard(m_mutex);
+        m_func(level, msg);
     }
 
 private:
     ErrorLevel m_minLevel = ErrorLevel_Debug;
-    ErrorLevel m_currLevel = ErrorLevel_Debug;
     ReportFunc m_func;
-
-    std::stringstream m_stream;
+    std::mutex m_mutex;
 };
 
 class LogWrapper
 {
 public:
-    LogWrapper(Logger& logger) : m_logger(logger) {}
-    ~LogWrapper() { m_logger.flush(); }
+    LogWrapper(Logger& logger, ErrorLevel level)
+      : m_logger(logger),
+        m_level(level),
+        m_enabled(logger.isEnabled(level))
+    {
+    }
+
+    LogWrapper(LogWrapper&& other)
+      : m_logger(other.m_logger),
+        m_level(other.m_level),
+        m_enabled(other.m_enabled),
+        m_stream(std::move(other.m_stream))
+    {
+        other.m_enabled = false;
+    }
+
+    ~LogWrapper()
+    {
+        if (m_enabled) {
+            m_logger.log(m_level, m_stream.str());
+        }
+    }
 
     template <typename T>
     LogWrapper& operator<<(T&& val)
     {
-        m_logger << std::forward<T>(val);
+        if (m_enabled) {
+            m_stream << std::forward<T>(val);
+        }
         return *this;
     }
 
 private:
     Logger& m_logger;
+    ErrorLevel m_level = ErrorLevel_Debug;
+    bool m_enabled = false;
+    std::stringstream m_stream;
 };
 
 inline
 LogWrapper logError(Logger& logger)
 {
-    logger.setCurrLevel(ErrorLevel_Error);
-    return LogWrapper(logger);
+    return LogWrapper(logger, ErrorLevel_Error);
 }
 
 inline
 LogWrapper logWarning(Logger& logger)
 {
-    logger.setCurrLevel(ErrorLevel_Warning);
-    return LogWrapper(logger);
+    return LogWrapper(logger, ErrorLevel_Warning);
 }
 
 inline
 LogWrapper logInfo(Logger& logger)
 {
-    logger.setCurrLevel(ErrorLevel_Info);
-    return LogWrapper(logger);
+    return LogWrapper(logger, ErrorLevel_Info);
 }
 
 } // namespace commsdsl
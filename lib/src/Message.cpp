@@ -143,5 +143,11 @@ const Message::PlatformsList& Message::platforms() const
     return m_pImpl->platforms();
 }
 
+std::uint64_t Message::definitionDigest() const
+{
+    assert(m_pImpl != nullptr);
+    return m_pImpl->definitionDigest();
+}
+
 
 } // namespace commsdsl
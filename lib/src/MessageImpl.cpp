@@ -50,6 +50,10 @@ MessageImpl::MessageImpl(::xmlNodePtr node, ProtocolImpl& protocol)
 
 bool MessageImpl::parse()
 {
+    if (m_protocol.isDefinitionDigestMode()) {
+        m_definitionDigest = XmlWrap::updateDigest(XmlWrap::initialDigest(), m_node);
+    }
+
     m_props = XmlWrap::parseNodeProps(m_node);
 
     if (!XmlWrap::parseChildrenAsProps(m_node, commonProps(), m_protocol.logger(), m_props)) {
@@ -535,6 +539,11 @@ bool MessageImpl::copyFields()
 
     cloneFieldsFrom(*m_copyFieldsFromMsg);
 
+    if (m_protocol.isDefinitionDigestMode()) {
+        // Changes in the copied message must be propagated
+        m_definitionDigest = XmlWrap::combineDigests(m_definitionDigest, m_copyFieldsFromMsg->m_definitionDigest);
+    }
+
     if (!m_fields.empty()) {
         m_fields.erase(
             std::remove_if(
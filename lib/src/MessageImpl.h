@@ -38,6 +38,7 @@ class MessageImpl : public Object
 public:
     using Ptr = std::unique_ptr<MessageImpl>;
     using PropsMap = XmlWrap::PropsMap;
+    using AttributesMap = XmlWrap::AttributesMap;
     using FieldsList = Message::FieldsList;
     using AliasesList = Message::AliasesList;
     using ContentsList = XmlWrap::ContentsList;
@@ -84,7 +85,7 @@ public:
 
     std::string externalRef() const;
 
-    const PropsMap& extraAttributes() const
+    const AttributesMap& extraAttributes() const
     {
         return m_extraAttrs;
     }
@@ -99,6 +100,16 @@ public:
         return m_platforms;
     }
 
+    std::uint64_t definitionDigest() const
+    {
+        return m_definitionDigest;
+    }
+
+    void setDefinitionDigest(std::uint64_t value)
+    {
+        m_definitionDigest = value;
+    }
+
     bool isCustomizable() const
     {
         return m_customizable;
@@ -145,7 +156,7 @@ private:
     ::xmlNodePtr m_node = nullptr;
     ProtocolImpl& m_protocol;
     PropsMap m_props;
-    PropsMap m_extraAttrs;
+    AttributesMap m_extraAttrs;
     ContentsList m_extraChildren;
 
     std::string m_name;
@@ -158,6 +169,7 @@ private:
     PlatformsList m_platforms;
     Sender m_sender = Sender::Both;
     const MessageImpl* m_copyFieldsFromMsg = nullptr;
+    std::uint64_t m_definitionDigest = 0U;
     bool m_customizable = false;
 };
 
@@ -46,6 +46,21 @@ static const XmlWrap::NamesList ChildrenNames = {
     common::interfaceStr()
 };
 
+// Records the global fields looked up during parsing to be combined
+// into the definition digest of the parsed element.
+template <typename TElem>
+bool parseRecordingFieldsAccess(TElem& elem, ProtocolImpl& protocol, ProtocolImpl::FieldsAccessList& accessed)
+{
+    if (!protocol.isDefinitionDigestMode()) {
+        return elem.parse();
+    }
+
+    auto* prevAccess = protocol.setFieldsAccessRecorder(&accessed);
+    bool result = elem.parse();
+    protocol.setFieldsAccessRecorder(prevAccess);
+    return result;
+}
+
 XmlWrap::NamesList allNames()
 {
     XmlWrap::NamesList names = PropNames;
@@ -255,6 +270,7 @@ const FieldImpl* NamespaceImpl::findField(const std::string& fieldName) const
     }
 
     assert(iter->second);
+    m_protocol.recordFieldAccess(iter->second.get());
     return iter->second.get();
 }
 
@@ -476,10 +492,16 @@ bool NamespaceImpl::processMultipleFields(::xmlNodePtr node)
 
         field->setParent(this);
 
-        if (!field->parse()) {
+        ProtocolImpl::FieldsAccessList accessedFields;
+        if (!parseRecordingFieldsAccess(*field, m_protocol, accessedFields)) {
             return false;
         }
 
+        if (m_protocol.isDefinitionDigestMode()) {
+            auto digest = XmlWrap::updateDigest(XmlWrap::initialDigest(), c);
+            field->setDefinitionDigest(ProtocolImpl::combineFieldsDigests(digest, accessedFields));
+        }
+
         auto& name = field->name();
         if (name.empty()) {
             logError() << XmlWrap::logPrefix(c) << "Field \"" << cName << "\" doesn't have any name.";
@@ -503,10 +525,15 @@ bool NamespaceImpl::processMessage(::xmlNodePtr node)
 {
     auto msg = std::make_unique<MessageImpl>(node, m_protocol);
     msg->setParent(this);
-    if (!msg->parse()) {
+    ProtocolImpl::FieldsAccessList accessedFields;
+    if (!parseRecordingFieldsAccess(*msg, m_protocol, accessedFields)) {
         return false;
     }
 
+    if (m_protocol.isDefinitionDigestMode()) {
+        msg->setDefinitionDigest(ProtocolImpl::combineFieldsDigests(msg->definitionDigest(), accessedFields));
+    }
+
     auto msgPtr = findMessage(msg->name());
     auto& msgName = msg->name();
     if (msgPtr != nullptr) {
@@ -544,10 +571,15 @@ bool NamespaceImpl::processInterface(::xmlNodePtr node)
 {
     auto interface = std::make_unique<InterfaceImpl>(node, m_protocol);
     interface->setParent(this);
-    if (!interface->parse()) {
+    ProtocolImpl::FieldsAccessList accessedFields;
+    if (!parseRecordingFieldsAccess(*interface, m_protocol, accessedFields)) {
         return false;
     }
 
+    if (m_protocol.isDefinitionDigestMode()) {
+        interface->setDefinitionDigest(ProtocolImpl::combineFieldsDigests(interface->definitionDigest(), accessedFields));
+    }
+
     auto intPtr = findInterface(interface->name());
     auto& intName = interface->name();
     if (intPtr != nullptr) {
@@ -585,10 +617,15 @@ bool NamespaceImpl::processFrame(::xmlNodePtr node)
 {
     auto frame = std::make_unique<FrameImpl>(node, m_protocol);
     frame->setParent(this);
-    if (!frame->parse()) {
+    ProtocolImpl::FieldsAccessList accessedFields;
+    if (!parseRecordingFieldsAccess(*frame, m_protocol, accessedFields)) {
         return false;
     }
 
+    if (m_protocol.isDefinitionDigestMode()) {
+        frame->setDefinitionDigest(ProtocolImpl::combineFieldsDigests(frame->definitionDigest(), accessedFields));
+    }
+
     auto framePtr = findFrame(frame->name());
     auto& frameName = frame->name();
     if (framePtr != nullptr) {
@@ -645,6 +682,7 @@ bool NamespaceImpl::strToValue(const std::string& ref, StrToValueNsConvertFunc&&
         }
 
         assert(fieldIter->second);
+        m_protocol.recordFieldAccess(fieldIter->second.get());
         return fFunc(*fieldIter->second, common::emptyString());
     }
 
@@ -663,6 +701,7 @@ bool NamespaceImpl::strToValue(const std::string& ref, StrToValueNsConvertFunc&&
     }
 
     assert(fieldIter->second);
+    m_protocol.recordFieldAccess(fieldIter->second.get());
     return fFunc(*fieldIter->second, restName);
 }
 
@@ -61,6 +61,7 @@ public:
 
     using Ptr = std::unique_ptr<NamespaceImpl>;
     using PropsMap = XmlWrap::PropsMap;
+    using AttributesMap = XmlWrap::AttributesMap;
     using ContentsList = XmlWrap::ContentsList;
     using NamespacesList = Namespace::NamespacesList;
     using FieldsList = Namespace::FieldsList;
@@ -129,12 +130,12 @@ public:
         return m_messages;
     }
 
-    const PropsMap& extraAttributes() const
+    const AttributesMap& extraAttributes() const
     {
         return m_extraAttrs;
     }
 
-    PropsMap& extraAttributes()
+    AttributesMap& extraAttributes()
     {
         return m_extraAttrs;
     }
@@ -197,7 +198,7 @@ private:
     ProtocolImpl& m_protocol;
 
     PropsMap m_props;
-    PropsMap m_extraAttrs;
+    AttributesMap m_extraAttrs;
     ContentsList m_extraChildren;
 
     std::string m_name;
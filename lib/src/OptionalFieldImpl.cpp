@@ -37,12 +37,12 @@ const XmlWrap::NamesList& optionalSupportedTypes()
     return Names;
 }
 
-XmlWrap::NamesList getExtraNames()
+XmlWrap::AtomsList getExtraNames()
 {
-    auto names = optionalSupportedTypes();
-    names.push_back(common::fieldStr());
-    names.push_back(common::andStr());
-    names.push_back(common::orStr());
+    auto names = toAtoms(optionalSupportedTypes());
+    names.push_back(Atom::Field);
+    names.push_back(Atom::And);
+    names.push_back(Atom::Or);
     return names;
 }
 
@@ -78,29 +78,29 @@ FieldImpl::Ptr OptionalFieldImpl::cloneImpl() const
     return Ptr(new OptionalFieldImpl(*this));
 }
 
-const XmlWrap::NamesList& OptionalFieldImpl::extraPropsNamesImpl() const
+const XmlWrap::AtomsList& OptionalFieldImpl::extraPropsNamesImpl() const
 {
-    static const XmlWrap::NamesList List = {
-        common::defaultModeStr(),
-        common::condStr(),
-        common::displayExtModeCtrlStr()
+    static const XmlWrap::AtomsList List = {
+        Atom::DefaultMode,
+        Atom::Cond,
+        Atom::DisplayExtModeCtrl
     };
 
     return List;
 }
 
-const XmlWrap::NamesList&OptionalFieldImpl::extraPossiblePropsNamesImpl() const
+const XmlWrap::AtomsList& OptionalFieldImpl::extraPossiblePropsNamesImpl() const
 {
-    static const XmlWrap::NamesList List = {
-        common::fieldStr(),
+    static const XmlWrap::AtomsList List = {
+        Atom::Field,
     };
 
     return List;
 }
 
-const XmlWrap::NamesList& OptionalFieldImpl::extraChildrenNamesImpl() const
+const XmlWrap::AtomsList& OptionalFieldImpl::extraChildrenNamesImpl() const
 {
-    static const XmlWrap::NamesList List = getExtraNames();
+    static const XmlWrap::AtomsList List = getExtraNames();
     return List;
 }
 
@@ -227,11 +227,11 @@ bool OptionalFieldImpl::strToDataImpl(const std::string& ref, std::vector<std::u
 
 bool OptionalFieldImpl::updateMode()
 {
-    if (!validateSinglePropInstance(common::defaultModeStr())) {
+    if (!validateSinglePropInstance(Atom::DefaultMode)) {
         return false;
     }
 
-    auto iter = props().find(common::defaultModeStr());
+    auto iter = props().find(Atom::DefaultMode);
     if (iter == props().end()) {
         return true;
     }
@@ -261,7 +261,7 @@ bool OptionalFieldImpl::updateMode()
 
 bool OptionalFieldImpl::updateExternalModeCtrl()
 {
-    return validateAndUpdateBoolPropValue(common::displayExtModeCtrlStr(), m_state.m_externalModeCtrl);
+    return validateAndUpdateBoolPropValue(Atom::DisplayExtModeCtrl, m_state.m_externalModeCtrl);
 }
 
 bool OptionalFieldImpl::updateField()
@@ -282,11 +282,11 @@ bool OptionalFieldImpl::updateField()
 
 bool OptionalFieldImpl::updateSingleCondition()
 {
-    if (!validateSinglePropInstance(common::condStr())) {
+    if (!validateSinglePropInstance(Atom::Cond)) {
         return false;
     }
 
-    auto iter = props().find(common::condStr());
+    auto iter = props().find(Atom::Cond);
     if (iter == props().end()) {
         return true;
     }
@@ -324,7 +324,7 @@ bool OptionalFieldImpl::updateMultiCondition()
         return true;
     }
 
-    if (props().find(common::condStr()) != props().end()) {
+    if (props().find(Atom::Cond) != props().end()) {
         logError() << XmlWrap::logPrefix(multiChildren.front()) <<
             "Cannot use \"" << multiChildren.front()->name << "\" condition bundling together with \"" <<
             common::condStr() << "\" property.";
@@ -356,11 +356,11 @@ bool OptionalFieldImpl::updateMultiCondition()
 
 bool OptionalFieldImpl::checkFieldFromRef()
 {
-    if (!validateSinglePropInstance(common::fieldStr())) {
+    if (!validateSinglePropInstance(Atom::Field)) {
         return false;
     }
 
-    auto iter = props().find(common::fieldStr());
+    auto iter = props().find(Atom::Field);
     if (iter == props().end()) {
         return true;
     }
@@ -422,7 +422,7 @@ bool OptionalFieldImpl::checkFieldAsChild()
             return false;
         }
 
-        if (props().find(common::fieldStr()) != props().end()) {
+        if (props().find(Atom::Field) != props().end()) {
             logError() << "There must be only one occurance of \"" << common::fieldStr() << "\" definition.";
             return false;
         }
@@ -448,7 +448,7 @@ bool OptionalFieldImpl::checkFieldAsChild()
             return false;
         }
 
-        if (props().find(common::fieldStr()) == props().end()) {
+        if (props().find(Atom::Field) == props().end()) {
             fieldNode = fields.front();
             break;
         }
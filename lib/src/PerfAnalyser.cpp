@@ -0,0 +1,496 @@
+//
+// Copyright 2018 - 2020 (C). Alex Robenko. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "PerfAnalyser.h"
+
+#include <cassert>
+#include <limits>
+
+#include "commsdsl/IntField.h"
+#include "commsdsl/BundleField.h"
+#include "commsdsl/DataField.h"
+#include "commsdsl/ListField.h"
+#include "commsdsl/RefField.h"
+#include "commsdsl/OptionalField.h"
+#include "commsdsl/StringField.h"
+#include "commsdsl/VariantField.h"
+#include "commsdsl/Layer.h"
+
+namespace commsdsl
+{
+
+namespace
+{
+
+const std::size_t MaxLen = std::numeric_limits<std::size_t>::max();
+const char Deref = '$';
+
+Field resolveRef(const Field& field)
+{
+    if (field.valid() && (field.kind() == Field::Kind::Ref)) {
+        return resolveRef(RefField(field).field());
+    }
+    return field;
+}
+
+std::string memberName(const std::string& elem, const Field& member)
+{
+    if (member.name().empty()) {
+        return elem;
+    }
+
+    return elem + '.' + member.name();
+}
+
+// Same conditions as the ones required by the generated code
+// to read the variant member by the key value
+bool isValidKey(const Field& field)
+{
+    if ((field.kind() != Field::Kind::Int) ||
+        (!field.isFailOnInvalid()) ||
+        (field.isPseudo())) {
+        return false;
+    }
+
+    IntField intField(field);
+    auto& validRanges = intField.validRanges();
+    if (validRanges.size() != 1U) {
+        return false;
+    }
+
+    auto& r = validRanges.front();
+    return (r.m_min == r.m_max) && (r.m_min == intField.defaultValue());
+}
+
+// Same as the generator, the members of the bundle that require
+// custom read preparation
+bool hasCustomReadMember(const BundleField::Members& members)
+{
+    for (auto& m : members) {
+        switch (m.kind()) {
+        case Field::Kind::Data:
+            if (!DataField(m).detachedPrefixFieldName().empty()) {
+                return true;
+            }
+            break;
+        case Field::Kind::String:
+            if (!StringField(m).detachedPrefixFieldName().empty()) {
+                return true;
+            }
+            break;
+        case Field::Kind::List:
+        {
+            ListField listField(m);
+            if ((!listField.detachedCountPrefixFieldName().empty()) ||
+                (!listField.detachedLengthPrefixFieldName().empty()) ||
+                (!listField.detachedElemLengthPrefixFieldName().empty())) {
+                return true;
+            }
+            break;
+        }
+        case Field::Kind::Optional:
+            if (OptionalField(m).cond().valid()) {
+                return true;
+            }
+            break;
+        default:
+            break;
+        }
+    }
+
+    return false;
+}
+
+// Mirrors the generator, which doesn't resolve references: the member
+// must be a bundle directly starting with the integer key field and
+// without custom read.
+Field variantMemberKey(const Field& member)
+{
+    if (member.kind() != Field::Kind::Bundle) {
+        return Field(nullptr);
+    }
+
+    auto members = BundleField(member).members();
+    if (members.empty()) {
+        return Field(nullptr);
+    }
+
+    auto& key = members.front();
+    if ((!isValidKey(key)) || hasCustomReadMember(members)) {
+        return Field(nullptr);
+    }
+
+    return key;
+}
+
+// Compares the properties used by the generator to define the key field type
+bool sameKeyType(const Field& first, const Field& second)
+{
+    IntField firstInt(first);
+    IntField secondInt(second);
+    return
+        (firstInt.type() == secondInt.type()) &&
+        (firstInt.endian() == secondInt.endian()) &&
+        (firstInt.serOffset() == secondInt.serOffset()) &&
+        (firstInt.minLength() == secondInt.minLength()) &&
+        (firstInt.maxLength() == secondInt.maxLength()) &&
+        (firstInt.bitLength() == secondInt.bitLength()) &&
+        (firstInt.scaling() == secondInt.scaling()) &&
+        (firstInt.units() == secondInt.units());
+}
+
+bool isNestedDeref(const std::string& str)
+{
+    return (!str.empty()) && (str[0] == Deref) && (str.find('.') != std::string::npos);
+}
+
+bool isIdLayer(const Layer& layer)
+{
+    if (layer.kind() == Layer::Kind::Id) {
+        return true;
+    }
+
+    return
+        (layer.kind() == Layer::Kind::Custom) &&
+        (CustomLayer(layer).isIdReplacement());
+}
+
+} // namespace
+
+PerfAnalyser::PerfAnalyser(const Protocol& protocol)
+  : m_protocol(protocol)
+{
+}
+
+PerfAnalyser::HazardsList PerfAnalyser::analyse()
+{
+    m_hazards.clear();
+    for (auto& ns : m_protocol.namespaces()) {
+        analyseNamespace(ns);
+    }
+
+    return std::move(m_hazards);
+}
+
+void PerfAnalyser::analyseNamespace(const Namespace& ns)
+{
+    for (auto& f : ns.fields()) {
+        analyseField(f, f.externalRef(), 0U);
+    }
+
+    for (auto& i : ns.interfaces()) {
+        analyseInterface(i);
+    }
+
+    for (auto& m : ns.messages()) {
+        analyseMessage(m);
+    }
+
+    for (auto& f : ns.frames()) {
+        analyseFrame(f);
+    }
+
+    for (auto& n : ns.namespaces()) {
+        analyseNamespace(n);
+    }
+}
+
+void PerfAnalyser::analyseMessage(const Message& msg)
+{
+    auto msgRef = msg.externalRef();
+    for (auto& f : msg.fields()) {
+        analyseField(f, memberName(msgRef, f), 0U);
+    }
+
+    if (msg.maxLength() != MaxLen) {
+        return;
+    }
+
+    report(
+        Kind::UnboundedLength,
+        Severity::Low,
+        msgRef,
+        "Message has no maximal serialisation length, the output buffer can't be "
+        "allocated in advance.",
+        "Limit the length of the variable length fields reported for the message "
+        "or the fields it references.");
+}
+
+void PerfAnalyser::analyseInterface(const Interface& iface)
+{
+    auto ifaceRef = iface.externalRef();
+    for (auto& f : iface.fields()) {
+        analyseField(f, memberName(ifaceRef, f), 0U);
+    }
+}
+
+void PerfAnalyser::analyseFrame(const Frame& frame)
+{
+    auto frameRef = frame.externalRef();
+    std::size_t minOffset = 0U;
+    std::string varLayers;
+    for (auto& l : frame.layers()) {
+        if (l.kind() == Layer::Kind::Payload) {
+            // ID is after the payload
+            return;
+        }
+
+        if (isIdLayer(l)) {
+            break;
+        }
+
+        if (!l.hasField()) {
+            continue;
+        }
+
+        auto field = l.field();
+        minOffset += field.minLength();
+        if (field.minLength() == field.maxLength()) {
+            continue;
+        }
+
+        if (!varLayers.empty()) {
+            varLayers += ", ";
+        }
+        varLayers += '\"' + l.name() + '\"';
+    }
+
+    if (varLayers.empty()) {
+        return;
+    }
+
+    report(
+        Kind::IdVarOffset,
+        Severity::High,
+        frameRef,
+        "Message ID is not at a fixed offset (at least " + std::to_string(minOffset) +
+        " bytes) due to variable length layer(s) " + varLayers + ", the preceding layers "
+        "must be processed before the message type is known.",
+        "Move the variable length layers after the \"id\" layer or use fixed length "
+        "fields for them.");
+}
+
+void PerfAnalyser::analyseField(const Field& field, const std::string& elem, unsigned optDepth)
+{
+    switch (field.kind()) {
+    case Field::Kind::Ref:
+        // The referenced field is analysed as a member of its namespace
+        return;
+    case Field::Kind::Bundle:
+        for (auto& m : BundleField(field).members()) {
+            analyseField(m, memberName(elem, m), optDepth);
+        }
+        break;
+    case Field::Kind::Variant:
+        analyseVariant(field, elem);
+        break;
+    case Field::Kind::List:
+        analyseList(field, elem);
+        break;
+    case Field::Kind::Optional:
+        analyseOptional(field, elem, optDepth);
+        break;
+    default:
+        break;
+    }
+
+    analyseLength(field, elem);
+}
+
+void PerfAnalyser::analyseVariant(const Field& field, const std::string& elem)
+{
+    auto members = VariantField(field).members();
+    for (auto& m : members) {
+        analyseField(m, memberName(elem, m), 0U);
+    }
+
+    if (members.size() <= 1U) {
+        return;
+    }
+
+    auto firstKey = variantMemberKey(members.front());
+    for (auto idx = 0U; idx < members.size(); ++idx) {
+        auto key = variantMemberKey(members[idx]);
+        if (!key.valid()) {
+            if ((idx == (members.size() - 1U)) &&
+                (members[idx].kind() == Field::Kind::Bundle)) {
+                // Last "catch all" member
+                break;
+            }
+
+            report(
+                Kind::VariantNoKey,
+                Severity::High,
+                elem,
+                "Variant member \"" + members[idx].name() + "\" doesn't start with a key "
+                "field, all the members are read in turn until one of them succeeds.",
+                "Define every member directly (not as a reference) as a bundle starting with "
+                "a \"failOnInvalid\" integer field having a single valid value equal to its "
+                "default value and without detached prefixes or optional conditions among "
+                "its members. Only the last member may omit such key, but it still needs "
+                "to be a bundle.");
+            return;
+        }
+
+        if (!sameKeyType(firstKey, key)) {
+            report(
+                Kind::VariantNoKey,
+                Severity::High,
+                elem,
+                "Key field of variant member \"" + members[idx].name() + "\" has different "
+                "type than in the first member, all the members are read in turn "
+                "until one of them succeeds.",
+                "Use the same integer type, length and endian for the key fields of all "
+                "the members, for example by copying a common field with \"copyFrom\".");
+            return;
+        }
+    }
+}
+
+void PerfAnalyser::analyseList(const Field& field, const std::string& elem)
+{
+    ListField listField(field);
+    auto elemField = listField.elementField();
+    analyseField(elemField, memberName(elem, elemField), 0U);
+
+    if (elemField.minLength() == elemField.maxLength()) {
+        return;
+    }
+
+    std::string lengthStr = std::to_string(elemField.minLength()) + " - ";
+    if (elemField.maxLength() == MaxLen) {
+        lengthStr += "unlimited";
+    }
+    else {
+        lengthStr += std::to_string(elemField.maxLength());
+    }
+
+    report(
+        Kind::ListElemVarLength,
+        Severity::Medium,
+        elem,
+        "List element length is not fixed (" + lengthStr + " bytes), the list length is "
+        "calculated by iterating over all the elements.",
+        "Use element with fixed serialisation length, such as fixed length strings "
+        "and data or lists with fixed count, so the list length is the number "
+        "of elements multiplied by the element length.");
+}
+
+void PerfAnalyser::analyseOptional(const Field& field, const std::string& elem, unsigned optDepth)
+{
+    OptionalField optField(field);
+    auto cond = optField.cond();
+    if (cond.valid()) {
+        analyseOptCond(cond, elem);
+    }
+
+    if (0U < optDepth) {
+        report(
+            Kind::OptionalNesting,
+            Severity::Medium,
+            elem,
+            "Optional field is nested in another optional field (depth " +
+            std::to_string(optDepth + 1U) + "), every level performs its own "
+            "existence check on read, write, length calculation and refresh.",
+            "Flatten the nested optional fields into a single optional with the combined "
+            "condition (using \"and\" / \"or\" lists).");
+    }
+
+    auto wrapped = optField.field();
+    analyseField(wrapped, memberName(elem, wrapped), optDepth + 1U);
+}
+
+void PerfAnalyser::analyseOptCond(const OptCond& cond, const std::string& elem)
+{
+    if (cond.kind() == OptCond::Kind::List) {
+        for (auto& c : OptCondList(cond).conditions()) {
+            analyseOptCond(c, elem);
+        }
+        return;
+    }
+
+    assert(cond.kind() == OptCond::Kind::Expr);
+    OptCondExpr expr(cond);
+    for (auto* str : {&expr.left(), &expr.right()}) {
+        if (!isNestedDeref(*str)) {
+            continue;
+        }
+
+        report(
+            Kind::OptionalNesting,
+            Severity::Low,
+            elem,
+            "Optional field condition references nested member \"" + str->substr(1) +
+            "\", the member is accessed through its containing fields on every "
+            "existence check.",
+            "Reference a sibling field directly, for example by moving the referenced "
+            "member out of its containing field.");
+    }
+}
+
+void PerfAnalyser::analyseLength(const Field& field, const std::string& elem)
+{
+    if (field.maxLength() != MaxLen) {
+        return;
+    }
+
+    auto kind = field.kind();
+    if ((kind == Field::Kind::String) || (kind == Field::Kind::Data)) {
+        report(
+            Kind::UnboundedLength,
+            Severity::Medium,
+            elem,
+            "Field has no maximal serialisation length.",
+            "Use fixed \"length\" or a \"prefix\" field with limited valid values range.");
+        return;
+    }
+
+    if (kind != Field::Kind::List) {
+        // Unbounded due to its members, which are reported separately
+        return;
+    }
+
+    ListField listField(field);
+    if (resolveRef(listField.elementField()).maxLength() == MaxLen) {
+        // Unbounded due to its element, which is reported separately
+        return;
+    }
+
+    report(
+        Kind::UnboundedLength,
+        Severity::Medium,
+        elem,
+        "List has no maximal serialisation length.",
+        "Use fixed \"count\", or a \"countPrefix\" / \"lengthPrefix\" field with limited "
+        "valid values range.");
+}
+
+void PerfAnalyser::report(
+    Kind kind,
+    Severity severity,
+    const std::string& elem,
+    const std::string& description,
+    const std::string& suggestion)
+{
+    Protocol::PerfHazardInfo info;
+    info.m_kind = kind;
+    info.m_severity = severity;
+    info.m_element = elem;
+    info.m_description = description;
+    info.m_suggestion = suggestion;
+    m_hazards.push_back(std::move(info));
+}
+
+} // namespace commsdsl
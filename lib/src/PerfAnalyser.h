@@ -0,0 +1,63 @@
+//
+// Copyright 2018 - 2020 (C). Alex Robenko. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <string>
+
+#include "commsdsl/Protocol.h"
+#include "commsdsl/Frame.h"
+#include "commsdsl/OptCond.h"
+
+namespace commsdsl
+{
+
+// Walks the validated model using the public API only and collects the
+// runtime performance hazards reported by Protocol::analysePerformance().
+class PerfAnalyser
+{
+public:
+    using HazardsList = Protocol::PerfHazardsList;
+
+    explicit PerfAnalyser(const Protocol& protocol);
+
+    HazardsList analyse();
+
+private:
+    using Kind = Protocol::PerfHazardKind;
+    using Severity = Protocol::PerfHazardSeverity;
+
+    void analyseNamespace(const Namespace& ns);
+    void analyseMessage(const Message& msg);
+    void analyseInterface(const Interface& iface);
+    void analyseFrame(const Frame& frame);
+    void analyseField(const Field& field, const std::string& elem, unsigned optDepth);
+    void analyseVariant(const Field& field, const std::string& elem);
+    void analyseList(const Field& field, const std::string& elem);
+    void analyseOptional(const Field& field, const std::string& elem, unsigned optDepth);
+    void analyseOptCond(const OptCond& cond, const std::string& elem);
+    void analyseLength(const Field& field, const std::string& elem);
+    void report(
+        Kind kind,
+        Severity severity,
+        const std::string& elem,
+        const std::string& description,
+        const std::string& suggestion);
+
+    const Protocol& m_protocol;
+    HazardsList m_hazards;
+};
+
+} // namespace commsdsl
@@ -16,6 +16,7 @@
 #include "commsdsl/Protocol.h"
 
 #include "ProtocolImpl.h"
+#include "PerfAnalyser.h"
 
 namespace commsdsl
 {
@@ -30,6 +31,31 @@ void Protocol::setErrorReportCallback(Protocol::ErrorReportFunction&& cb)
     m_pImpl->setErrorReportCallback(std::move(cb));
 }
 
+void Protocol::setDocReportCallback(Protocol::DocReportFunction&& cb)
+{
+    m_pImpl->setDocReportCallback(std::move(cb));
+}
+
+void Protocol::setDetachedModelMode(bool enabled)
+{
+    m_pImpl->setDetachedModelMode(enabled);
+}
+
+void Protocol::setStreamingParseMode(bool enabled)
+{
+    m_pImpl->setStreamingParseMode(enabled);
+}
+
+void Protocol::setLazyValidationMode(bool enabled)
+{
+    m_pImpl->setLazyValidationMode(enabled);
+}
+
+void Protocol::setDefinitionDigestMode(bool enabled)
+{
+    m_pImpl->setDefinitionDigestMode(enabled);
+}
+
 Protocol::~Protocol() = default;
 
 bool Protocol::parse(const std::string& input)
@@ -37,11 +63,31 @@ bool Protocol::parse(const std::string& input)
     return m_pImpl->parse(input);
 }
 
+bool Protocol::parseAll(const FilesList& files, unsigned threads)
+{
+    return m_pImpl->parseAll(files, threads);
+}
+
+bool Protocol::parseBuffer(const char* buf, std::size_t size, const std::string& name)
+{
+    return m_pImpl->parseBuffer(buf, size, name);
+}
+
+bool Protocol::parseStream(std::istream& input, const std::string& name)
+{
+    return m_pImpl->parseStream(input, name);
+}
+
 bool Protocol::validate()
 {
     return m_pImpl->validate();
 }
 
+bool Protocol::validateAll()
+{
+    return m_pImpl->validateAll();
+}
+
 Schema Protocol::schema() const
 {
     return m_pImpl->schema();
@@ -57,6 +103,16 @@ Field Protocol::findField(const std::string& externalRef) const
     return Field(m_pImpl->findField(externalRef));
 }
 
+Message Protocol::findMessage(const std::string& externalRef) const
+{
+    return Message(m_pImpl->findMessage(externalRef));
+}
+
+Interface Protocol::findInterface(const std::string& externalRef) const
+{
+    return Interface(m_pImpl->findInterface(externalRef));
+}
+
 Protocol::MessagesList Protocol::allMessages() const
 {
     return m_pImpl->allMessages();
@@ -72,4 +128,14 @@ const Protocol::PlatformsList&Protocol::platforms() const
     return m_pImpl->platforms();
 }
 
+std::uint64_t Protocol::commonDefinitionDigest() const
+{
+    return m_pImpl->commonDefinitionDigest();
+}
+
+Protocol::PerfHazardsList Protocol::analysePerformance() const
+{
+    return PerfAnalyser(*this).analyse();
+}
+
 } // namespace commsdsl
@@ -20,6 +20,13 @@
 #include <cassert>
 #include <algorithm>
 #include <numeric>
+#include <thread>
+#include <atomic>
+#include <sstream>
+#include <iterator>
+#include <limits>
+
+#include <libxml/parserInternals.h>
 
 #include "XmlWrap.h"
 #include "FieldImpl.h"
@@ -28,6 +35,65 @@
 namespace commsdsl
 {
 
+namespace
+{
+
+void initXmlParser()
+{
+    // libxml2 requires its global initialisation to be performed
+    // only once and before any concurrent use.
+    static const bool Initialised =
+        [] ()
+        {
+            ::xmlInitParser();
+            return true;
+        }();
+    static_cast<void>(Initialised);
+}
+
+bool isBlankTextNode(::xmlNodePtr node)
+{
+    return (node->type == XML_TEXT_NODE) && (::xmlIsBlankNode(node) != 0);
+}
+
+// Copies the node into the target document dropping the formatting
+// whitespaces between elements, which are never accessed by the model.
+// The comments are kept, otherwise the text nodes around them are merged.
+::xmlNodePtr copyModelNode(::xmlNodePtr node, ::xmlDocPtr doc)
+{
+    if (node->type != XML_ELEMENT_NODE) {
+        return ::xmlDocCopyNode(node, doc, 1);
+    }
+
+    auto* copy = ::xmlDocCopyNode(node, doc, 2);
+    if (copy == nullptr) {
+        return nullptr;
+    }
+
+    bool hasElements = false;
+    for (auto* child = node->children; child != nullptr; child = child->next) {
+        if (child->type == XML_ELEMENT_NODE) {
+            hasElements = true;
+            break;
+        }
+    }
+
+    for (auto* child = node->children; child != nullptr; child = child->next) {
+        if (hasElements && isBlankTextNode(child)) {
+            continue;
+        }
+
+        auto* childCopy = copyModelNode(child, doc);
+        if (childCopy != nullptr) {
+            ::xmlAddChild(copy, childCopy);
+        }
+    }
+
+    return copy;
+}
+
+} // namespace
+
 ProtocolImpl::ProtocolImpl()
   : m_logger(
         [this](ErrorLevel level, const std::string& msg)
@@ -51,7 +117,7 @@ ProtocolImpl::ProtocolImpl()
         }
     )
 {
-    xmlSetStructuredErrorFunc(this, &ProtocolImpl::cbXmlErrorFunc);
+    initXmlParser();
     m_logger.setMinLevel(m_minLevel);
 }
 
@@ -62,13 +128,85 @@ bool ProtocolImpl::parse(const std::string& input)
         return false;
     }
 
-    XmlDocPtr doc(xmlParseFile(input.c_str()));
-    if (!doc) {
-        std::cerr << "ERROR: Failed to parse" << input << std::endl;
+    ParseResult result;
+    parseFile(input, m_streamingParse, result);
+    return acceptParseResult(input, result);
+}
+
+bool ProtocolImpl::parseBuffer(const char* buf, std::size_t size, const std::string& name)
+{
+    if (m_validated) {
+        logError() << "Parsing extra files after validation is not allowed";
+        return false;
+    }
+
+    auto docName = name;
+    if (docName.empty()) {
+        docName = "memory";
+    }
+
+    ParseResult result;
+    parseMemory(buf, size, docName, m_streamingParse, result);
+    return acceptParseResult(docName, result);
+}
+
+bool ProtocolImpl::parseStream(std::istream& input, const std::string& name)
+{
+    std::string contents(std::istreambuf_iterator<char>(input), (std::istreambuf_iterator<char>()));
+    return parseBuffer(contents.c_str(), contents.size(), name);
+}
+
+bool ProtocolImpl::parseAll(const FilesList& files, unsigned threads)
+{
+    if (m_validated) {
+        logError() << "Parsing extra files after validation is not allowed";
         return false;
     }
 
-    m_docs.push_back(std::move(doc));
+    if (threads == 0U) {
+        threads = std::max(std::thread::hardware_concurrency(), 1U);
+    }
+
+    threads = static_cast<unsigned>(std::min(static_cast<std::size_t>(threads), files.size()));
+
+    // The documents are parsed concurrently, but the diagnostics are
+    // reported and the documents are accepted in the order of the files
+    // list, exactly as if they were parsed one by one.
+    std::vector<ParseResult> results(files.size());
+    std::atomic<std::size_t> nextIdx(0U);
+    bool streaming = m_streamingParse;
+    auto parseFunc =
+        [&files, &results, &nextIdx, streaming]()
+        {
+            while (true) {
+                auto idx = nextIdx++;
+                if (files.size() <= idx) {
+                    break;
+                }
+
+                parseFile(files[idx], streaming, results[idx]);
+            }
+        };
+
+    std::vector<std::thread> workers;
+    if (1U < threads) {
+        workers.reserve(threads - 1U);
+        for (auto idx = 1U; idx < threads; ++idx) {
+            workers.emplace_back(parseFunc);
+        }
+    }
+
+    parseFunc();
+    for (auto& w : workers) {
+        w.join();
+    }
+
+    for (auto idx = 0U; idx < files.size(); ++idx) {
+        if (!acceptParseResult(files[idx], results[idx])) {
+            return false;
+        }
+    }
+
     return true;
 }
 
@@ -83,23 +221,94 @@ bool ProtocolImpl::validate()
         return false;
     }
 
-    for (auto& d : m_docs) {
-        if (!validateDoc(d.get())) {
-            return false;
-        }
+    FieldsAccessList* prevFieldsAccess = nullptr;
+    if (m_definitionDigest) {
+        prevFieldsAccess = setFieldsAccessRecorder(&m_commonFieldsAccess);
     }
 
-    if (!validateAllMessages()) {
+    bool docsValid =
+        std::all_of(
+            m_docs.begin(), m_docs.end(),
+            [this](auto& d)
+            {
+                return validateDoc(d.get());
+            });
+
+    if (m_definitionDigest) {
+        setFieldsAccessRecorder(prevFieldsAccess);
+    }
+
+    if (!docsValid) {
         return false;
     }
 
-    auto messageIdsCount = countMessageIds();
-    if (1U < messageIdsCount) {
-        logError() << "Only single field with \"" << common::messageIdStr() << "\" as semantic type is allowed.";
+    if (m_definitionDigest) {
+        // The messages, global fields, interfaces and frames are digested
+        // individually when parsed
+        static const XmlWrap::NamesList SkipNames = {
+            common::messageStr(),
+            common::messagesStr(),
+            common::fieldsStr(),
+            common::interfaceStr(),
+            common::interfacesStr(),
+            common::frameStr(),
+            common::framesStr()
+        };
+
+        m_commonDefinitionDigest = XmlWrap::initialDigest();
+        for (auto& d : m_docs) {
+            m_commonDefinitionDigest =
+                XmlWrap::updateNamespaceDigest(m_commonDefinitionDigest, ::xmlDocGetRootElement(d.get()), SkipNames);
+        }
+    }
+
+    if (m_lazyValidation) {
+        // The namespaces are validated on first access, the documents
+        // must be kept until all of them are processed.
+        m_validated = true;
+        return true;
+    }
+
+    if (!validateGlobals()) {
         return false;
     }
 
     m_validated = true;
+    m_allValidated = true;
+
+    if (m_detachedModel) {
+        // All the information required by the queries has been copied
+        // into the model objects, the nodes are not accessed any more.
+        m_docs.clear();
+    }
+
+    return true;
+}
+
+bool ProtocolImpl::validateAll()
+{
+    if (!validate()) {
+        return false;
+    }
+
+    if (m_allValidated) {
+        return true;
+    }
+
+    if (m_lazyFailed || (!validateAllPendingNamespaces())) {
+        return false;
+    }
+
+    if (!validateGlobals()) {
+        return false;
+    }
+
+    m_allValidated = true;
+
+    if (m_detachedModel) {
+        m_docs.clear();
+    }
+
     return true;
 }
 
@@ -127,6 +336,7 @@ const SchemaImpl& ProtocolImpl::schemaImpl() const
 
 ProtocolImpl::NamespacesList ProtocolImpl::namespacesList() const
 {
+    ensureAllNamespacesValidated();
     NamespacesList result;
     result.reserve(m_namespaces.size());
     for (auto& n : m_namespaces) {
@@ -277,8 +487,38 @@ bool ProtocolImpl::strToData(
             });
 }
 
+std::uint64_t ProtocolImpl::commonDefinitionDigest() const
+{
+    if ((!m_definitionDigest) || (!m_validated)) {
+        return 0U;
+    }
+
+    // The lazily validated namespaces can reference more global fields
+    ensureAllNamespacesValidated();
+    return combineFieldsDigests(m_commonDefinitionDigest, m_commonFieldsAccess);
+}
+
+std::uint64_t ProtocolImpl::combineFieldsDigests(std::uint64_t digest, const FieldsAccessList& fields)
+{
+    // The same field is usually looked up multiple times, the access order
+    // of the first lookups is deterministic for the same definitions.
+    FieldsAccessList processed;
+    processed.reserve(fields.size());
+    for (auto* f : fields) {
+        assert(f != nullptr);
+        if (std::find(processed.begin(), processed.end(), f) != processed.end()) {
+            continue;
+        }
+
+        processed.push_back(f);
+        digest = XmlWrap::combineDigests(digest, f->definitionDigest());
+    }
+    return digest;
+}
+
 ProtocolImpl::MessagesList ProtocolImpl::allMessages() const
 {
+    ensureAllNamespacesValidated();
     auto total =
         std::accumulate(
             m_namespaces.begin(), m_namespaces.end(), static_cast<std::size_t>(0U),
@@ -348,12 +588,23 @@ bool ProtocolImpl::isFieldAliasSupported() const
     return isFeatureSupported(3U);
 }
 
-void ProtocolImpl::cbXmlErrorFunc(void* userData, xmlErrorPtr err)
+void ProtocolImpl::cbXmlCollectErrorFunc(void* userData, xmlErrorPtr err)
+{
+    auto* ctxt = reinterpret_cast<::xmlParserCtxtPtr>(userData);
+    assert(ctxt != nullptr);
+    auto* errors = reinterpret_cast<XmlErrorsList*>(ctxt->_private);
+    assert(errors != nullptr);
+    errors->push_back(xmlErrorToInfo(err));
+}
+
+void ProtocolImpl::cbXmlCollectReaderErrorFunc(void* userData, xmlErrorPtr err)
 {
-    reinterpret_cast<ProtocolImpl*>(userData)->handleXmlError(err);
+    auto* errors = reinterpret_cast<XmlErrorsList*>(userData);
+    assert(errors != nullptr);
+    errors->push_back(xmlErrorToInfo(err));
 }
 
-void ProtocolImpl::handleXmlError(xmlErrorPtr err)
+ProtocolImpl::XmlErrorInfo ProtocolImpl::xmlErrorToInfo(xmlErrorPtr err)
 {
     static const ErrorLevel Map[] = {
         /* XML_ERR_NONE */ ErrorLevel_Debug,
@@ -365,28 +616,173 @@ void ProtocolImpl::handleXmlError(xmlErrorPtr err)
     static_assert(XML_ERR_NONE == 0, "Invalid assumption");
     static_assert(XML_ERR_FATAL == 3, "Invalid assumption");
 
-    ErrorLevel level = ErrorLevel_Error;
+    XmlErrorInfo info(ErrorLevel_Error, std::string());
+    if (err == nullptr) {
+        return info;
+    }
+
     if ((XML_ERR_NONE <= err->level) && (err->level <= XML_ERR_FATAL)) {
-        level = Map[err->level];
+        info.first = Map[err->level];
     }
 
-    m_logger.setCurrLevel(level);
-    do {
-        if (err == nullptr) {
-            break;
+    std::stringstream stream;
+    if (err->file != nullptr) {
+        stream << err->file << ':';
+    }
+
+    if (err->line != 0) {
+        stream << err->line << ": ";
+    }
+
+    if (err->message != nullptr) {
+        stream << err->message;
+    }
+
+    info.second = stream.str();
+    return info;
+}
+
+ProtocolImpl::XmlParserCtxtPtr ProtocolImpl::createParserCtxt(ParseResult& result)
+{
+    XmlParserCtxtPtr ctxt(::xmlNewParserCtxt());
+    if (!ctxt) {
+        return ctxt;
+    }
+
+    // Report errors of this particular parse to its own errors list
+    // instead of process wide (or thread wide) structured error handler.
+    ctxt->_private = &result.m_errors;
+    ctxt->sax->serror = &ProtocolImpl::cbXmlCollectErrorFunc;
+    return ctxt;
+}
+
+void ProtocolImpl::parseFile(const std::string& input, bool streaming, ParseResult& result)
+{
+    auto ctxt = createParserCtxt(result);
+    if (!ctxt) {
+        return;
+    }
+
+    if (streaming) {
+        // Open the file with the same loader as the tree parser
+        auto* stream = ::xmlLoadExternalEntity(input.c_str(), nullptr, ctxt.get());
+        ::xmlParserInputBufferPtr buf = nullptr;
+        if (stream != nullptr) {
+            buf = stream->buf;
+            stream->buf = nullptr;
+            ::xmlFreeInputStream(stream);
         }
 
-        if (err->file != nullptr) {
-            m_logger << std::string(err->file) << ':';
+        if ((buf != nullptr) && streamDoc(buf, input, result)) {
+            return;
         }
 
-        if (err->line != 0) {
-            m_logger << err->line << ": ";
+        // The reader stops on the first error while the tree parser
+        // recovers and may report more, the tree parse is repeated
+        // to report exactly the same errors.
+        result.m_errors.clear();
+    }
+
+    result.m_doc.reset(::xmlCtxtReadFile(ctxt.get(), input.c_str(), nullptr, 0));
+}
+
+void ProtocolImpl::parseMemory(const char* buf, std::size_t size, const std::string& name, bool streaming, ParseResult& result)
+{
+    if (static_cast<std::size_t>(std::numeric_limits<int>::max()) < size) {
+        result.m_errors.emplace_back(ErrorLevel_Error, name + ": Input buffer is too big.");
+        return;
+    }
+
+    if (streaming) {
+        auto* input = ::xmlParserInputBufferCreateMem(buf, static_cast<int>(size), XML_CHAR_ENCODING_NONE);
+        if ((input != nullptr) && streamDoc(input, name, result)) {
+            return;
         }
 
-        m_logger << err->message;
-    } while (false);
-    m_logger.flush();
+        // Same errors as the tree parse are reported on failure
+        result.m_errors.clear();
+    }
+
+    auto ctxt = createParserCtxt(result);
+    if (!ctxt) {
+        return;
+    }
+
+    result.m_doc.reset(::xmlCtxtReadMemory(ctxt.get(), buf, static_cast<int>(size), name.c_str(), nullptr, 0));
+}
+
+bool ProtocolImpl::streamDoc(::xmlParserInputBufferPtr input, const std::string& name, ParseResult& result)
+{
+    XmlTextReaderPtr reader(::xmlNewTextReader(input, name.c_str()));
+    if (!reader) {
+        ::xmlFreeParserInputBuffer(input);
+        return false;
+    }
+
+    ::xmlTextReaderSetStructuredErrorHandler(reader.get(), &ProtocolImpl::cbXmlCollectReaderErrorFunc, &result.m_errors);
+
+    XmlDocPtr doc(::xmlNewDoc(reinterpret_cast<const xmlChar*>("1.0")));
+    doc->URL = ::xmlStrdup(reinterpret_cast<const xmlChar*>(name.c_str()));
+    doc->dict = ::xmlDictCreate();
+
+    // Every top level element is expanded and copied into the resulting
+    // document one at a time, the reader releases its own copy of the
+    // subtree when moving to the next sibling.
+    ::xmlNodePtr root = nullptr;
+    auto ret = ::xmlTextReaderRead(reader.get());
+    while (ret == 1) {
+        auto depth = ::xmlTextReaderDepth(reader.get());
+        if ((depth == 0) && (::xmlTextReaderNodeType(reader.get()) == XML_READER_TYPE_ELEMENT)) {
+            root = ::xmlDocCopyNode(::xmlTextReaderCurrentNode(reader.get()), doc.get(), 2);
+            ::xmlDocSetRootElement(doc.get(), root);
+            ret = ::xmlTextReaderRead(reader.get());
+            continue;
+        }
+
+        if ((depth != 1) || (root == nullptr)) {
+            ret = ::xmlTextReaderRead(reader.get());
+            continue;
+        }
+
+        auto* node = ::xmlTextReaderExpand(reader.get());
+        if (node == nullptr) {
+            ret = -1;
+            break;
+        }
+
+        auto* copy = isBlankTextNode(node) ? nullptr : copyModelNode(node, doc.get());
+        if (copy != nullptr) {
+            ::xmlAddChild(root, copy);
+        }
+
+        ret = ::xmlTextReaderNext(reader.get());
+    }
+
+    if (ret != 0) {
+        return false;
+    }
+
+    result.m_doc = std::move(doc);
+    return true;
+}
+
+bool ProtocolImpl::acceptParseResult(const std::string& input, ParseResult& result)
+{
+    if (m_docReportCb && (!m_docReportCb(input))) {
+        return false;
+    }
+
+    for (auto& e : result.m_errors) {
+        m_logger.log(e.first, e.second);
+    }
+
+    if (!result.m_doc) {
+        logError() << "Failed to parse \"" << input << "\"";
+        return false;
+    }
+
+    m_docs.push_back(std::move(result.m_doc));
+    return true;
 }
 
 bool ProtocolImpl::validateDoc(::xmlDocPtr doc)
@@ -422,7 +818,7 @@ bool ProtocolImpl::validateSchema(::xmlNodePtr node)
 
         if (m_schema->name().empty()) {
             logError() << XmlWrap::logPrefix(m_schema->getNode()) <<
-                "First schema definition must define \"" << common::nameStr << "\" property.";
+                "First schema definition must define \"" << common::nameStr() << "\" property.";
             return false;
         }
         return true;
@@ -554,65 +950,141 @@ bool ProtocolImpl::validateNamespaces(::xmlNodePtr root)
                 return false;
             }
 
-            auto& nsName = ns->name();
-            auto iter = m_namespaces.find(nsName);
-            NamespaceImpl* nsToProcess = nullptr;
-            NamespaceImpl* realNs = nullptr;
-            do {
-                if (iter == m_namespaces.end()) {
-                    m_namespaces.insert(std::make_pair(nsName, std::move(ns)));
-                    iter = m_namespaces.find(nsName);
-                    assert(iter != m_namespaces.end());
-                    nsToProcess = iter->second.get();
-                    break;
-                }
+            if (m_lazyValidation) {
+                auto& elems = pendingNamespaceElems(ns->name());
+                elems.push_back(PendingNsElem());
+                elems.back().m_ns = std::move(ns);
+                continue;
+            }
 
-                nsToProcess = ns.get();
-                realNs = iter->second.get();
-
-                if ((!nsToProcess->description().empty()) &&
-                    (nsToProcess->description() != realNs->description())) {
-                    if (realNs->description().empty()) {
-                        realNs->updateDescription(nsToProcess->description());
-                    }
-                    else {
-                        logWarning() << XmlWrap::logPrefix(nsToProcess->getNode()) <<
-                            "Description of namespace \"" << nsToProcess->name() << "\" differs to "
-                            "one encountered before.";
-                    }
-                }
+            if (!processNamespace(std::move(ns))) {
+                return false;
+            }
 
-                if (!nsToProcess->extraAttributes().empty()) {
-                    for (auto& a : nsToProcess->extraAttributes()) {
-                        auto attIter = realNs->extraAttributes().find(a.first);
-                        if (attIter == realNs->extraAttributes().end()) {
-                            realNs->extraAttributes().insert(a);
-                        }
-                        else if (a.second != attIter->second) {
-                            logWarning() << XmlWrap::logPrefix(nsToProcess->getNode()) <<
-                                "Value of attribute \"" << a.first << "\" differs to one defined before.";
-                        }
-                    }
-                }
+            continue;
+        }
 
-                realNs->extraChildren().insert(realNs->extraChildren().end(), nsToProcess->extraChildren().begin(), nsToProcess->extraChildren().end());
+        if (m_lazyValidation) {
+            auto& elems = pendingNamespaceElems(common::emptyString());
+            elems.push_back(PendingNsElem());
+            elems.back().m_node = c;
+            continue;
+        }
 
-            } while (false);
+        if (!processGlobalNsChild(c)) {
+            return false;
+        }
+    }
 
-            assert(iter->second);
-            if (!nsToProcess->parseChildren(realNs)) {
-                return false;
+    return true;
+}
+
+bool ProtocolImpl::processNamespace(NamespaceImplPtr ns)
+{
+    auto& nsName = ns->name();
+    auto iter = m_namespaces.find(nsName);
+    NamespaceImpl* nsToProcess = nullptr;
+    NamespaceImpl* realNs = nullptr;
+    do {
+        if (iter == m_namespaces.end()) {
+            m_namespaces.insert(std::make_pair(nsName, std::move(ns)));
+            iter = m_namespaces.find(nsName);
+            assert(iter != m_namespaces.end());
+            nsToProcess = iter->second.get();
+            break;
+        }
+
+        nsToProcess = ns.get();
+        realNs = iter->second.get();
+
+        if ((!nsToProcess->description().empty()) &&
+            (nsToProcess->description() != realNs->description())) {
+            if (realNs->description().empty()) {
+                realNs->updateDescription(nsToProcess->description());
             }
+            else {
+                logWarning() << XmlWrap::logPrefix(nsToProcess->getNode()) <<
+                    "Description of namespace \"" << nsToProcess->name() << "\" differs to "
+                    "one encountered before.";
+            }
+        }
 
-            continue;
+        if (!nsToProcess->extraAttributes().empty()) {
+            for (auto& a : nsToProcess->extraAttributes()) {
+                auto attIter = realNs->extraAttributes().find(a.first);
+                if (attIter == realNs->extraAttributes().end()) {
+                    realNs->extraAttributes().insert(a);
+                }
+                else if (a.second != attIter->second) {
+                    logWarning() << XmlWrap::logPrefix(nsToProcess->getNode()) <<
+                        "Value of attribute \"" << a.first << "\" differs to one defined before.";
+                }
+            }
+        }
+
+        realNs->extraChildren().insert(realNs->extraChildren().end(), nsToProcess->extraChildren().begin(), nsToProcess->extraChildren().end());
+
+    } while (false);
+
+    assert(iter->second);
+    return nsToProcess->parseChildren(realNs);
+}
+
+bool ProtocolImpl::processGlobalNsChild(::xmlNodePtr node)
+{
+    auto& globalNsPtr = m_namespaces[common::emptyString()]; // create if needed
+    if (!globalNsPtr) {
+        globalNsPtr.reset(new NamespaceImpl(nullptr, *this));
+    }
+
+    return globalNsPtr->processChild(node);
+}
+
+ProtocolImpl::PendingNsElemsList& ProtocolImpl::pendingNamespaceElems(const std::string& name)
+{
+    auto iter = m_pendingNamespaces.find(name);
+    if (iter != m_pendingNamespaces.end()) {
+        return iter->second;
+    }
+
+    m_pendingNamesOrder.push_back(name);
+    return m_pendingNamespaces[name];
+}
+
+bool ProtocolImpl::validatePendingNamespace(const std::string& name)
+{
+    auto iter = m_pendingNamespaces.find(name);
+    if (iter == m_pendingNamespaces.end()) {
+        return true;
+    }
+
+    // The elements are removed from the pending list before being processed
+    // to allow references back into the namespace being validated.
+    auto elems = std::move(iter->second);
+    m_pendingNamespaces.erase(iter);
+    for (auto& e : elems) {
+        // The validation may be triggered by a lookup during parsing of
+        // a definition in other namespace, the lookups performed here
+        // don't belong to it.
+        FieldsAccessList* prevFieldsAccess = nullptr;
+        if (m_definitionDigest) {
+            prevFieldsAccess = setFieldsAccessRecorder(&m_commonFieldsAccess);
+        }
+
+        bool result = false;
+        if (e.m_ns) {
+            result = processNamespace(std::move(e.m_ns));
+        }
+        else {
+            result = processGlobalNsChild(e.m_node);
         }
 
-        auto& globalNsPtr = m_namespaces[common::emptyString()]; // create if needed
-        if (!globalNsPtr) {
-            globalNsPtr.reset(new NamespaceImpl(nullptr, *this));
+        if (m_definitionDigest) {
+            setFieldsAccessRecorder(prevFieldsAccess);
         }
 
-        if (!globalNsPtr->processChild(c)) {
+        if (!result) {
+            m_lazyFailed = true;
             return false;
         }
     }
@@ -620,6 +1092,56 @@ bool ProtocolImpl::validateNamespaces(::xmlNodePtr root)
     return true;
 }
 
+bool ProtocolImpl::validateAllPendingNamespaces()
+{
+    // Process the namespaces in order of their appearance in the schema files
+    // to report the errors in the same order as the full validation.
+    for (auto& n : m_pendingNamesOrder) {
+        if (!validatePendingNamespace(n)) {
+            return false;
+        }
+    }
+
+    assert(m_pendingNamespaces.empty());
+    m_pendingNamesOrder.clear();
+    return true;
+}
+
+bool ProtocolImpl::ensureNamespaceValidated(const std::string& name) const
+{
+    if (m_pendingNamespaces.empty()) {
+        return true;
+    }
+
+    // Lazy validation updates the model on first access, which is
+    // performed by the const lookup functions.
+    return const_cast<ProtocolImpl*>(this)->validatePendingNamespace(name);
+}
+
+bool ProtocolImpl::ensureAllNamespacesValidated() const
+{
+    if (m_pendingNamespaces.empty()) {
+        return true;
+    }
+
+    return const_cast<ProtocolImpl*>(this)->validateAllPendingNamespaces();
+}
+
+bool ProtocolImpl::validateGlobals()
+{
+    if (!validateAllMessages()) {
+        return false;
+    }
+
+    auto messageIdsCount = countMessageIds();
+    if (1U < messageIdsCount) {
+        logError() << "Only single field with \"" << common::messageIdStr() << "\" as semantic type is allowed.";
+        return false;
+    }
+
+    return true;
+}
+
 bool ProtocolImpl::validateAllMessages()
 {
     assert(m_schema);
@@ -660,6 +1182,7 @@ bool ProtocolImpl::validateAllMessages()
 
 unsigned ProtocolImpl::countMessageIds() const
 {
+    ensureAllNamespacesValidated();
     return
         std::accumulate(
             m_namespaces.begin(), m_namespaces.end(), unsigned(0U),
@@ -686,6 +1209,7 @@ const NamespaceImpl* ProtocolImpl::getNsFromPath(const std::string& ref, bool ch
     const NamespaceImpl* ns = nullptr;
     do {
         if (nameSepPos == std::string::npos) {
+            ensureNamespaceValidated(common::emptyString());
             auto iter = m_namespaces.find(common::emptyString());
             if (iter == m_namespaces.end()) {
                 return nullptr;
@@ -712,6 +1236,9 @@ const NamespaceImpl* ProtocolImpl::getNsFromPath(const std::string& ref, bool ch
             if (ns != nullptr) {
                 nsMap = &(ns->namespacesMap());
             }
+            else {
+                ensureNamespaceValidated(nsName);
+            }
 
             auto iter = nsMap->find(nsName);
             if (iter == nsMap->end()) {
@@ -747,6 +1274,7 @@ bool ProtocolImpl::strToValue(const std::string& ref, bool checkRef, StrToValueC
     auto redirectToGlobalNs =
         [this, &func, &ref]() -> bool
         {
+            ensureNamespaceValidated(common::emptyString());
             auto iter = m_namespaces.find(common::emptyString());
             if (iter == m_namespaces.end()) {
                 return false;
@@ -762,6 +1290,7 @@ bool ProtocolImpl::strToValue(const std::string& ref, bool checkRef, StrToValueC
 
     std::string ns(ref, 0, firstDotPos);
     assert(!ns.empty());
+    ensureNamespaceValidated(ns);
     auto nsIter = m_namespaces.find(ns);
     if (nsIter == m_namespaces.end()) {
         return redirectToGlobalNs();
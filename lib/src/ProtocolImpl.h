@@ -15,13 +15,16 @@
 
 #pragma once
 
+#include <cstdint>
 #include <string>
 #include <memory>
 #include <vector>
+#include <map>
 
 #include <libxml/xmlmemory.h>
 #include <libxml/parser.h>
 #include <libxml/xmlerror.h>
+#include <libxml/xmlreader.h>
 
 #include "commsdsl/Protocol.h"
 #include "commsdsl/ErrorLevel.h"
@@ -37,15 +40,22 @@ class ProtocolImpl
 {
 public:
     using ErrorReportFunction = Protocol::ErrorReportFunction;
+    using DocReportFunction = Protocol::DocReportFunction;
     using NamespacesList = Protocol::NamespacesList;
     using MessagesList = Protocol::MessagesList;
     using ExtraPrefixes = std::vector<std::string>;
     using PlatformsList = Protocol::PlatformsList;
     using NamespacesMap = NamespaceImpl::NamespacesMap;
+    using FilesList = Protocol::FilesList;
+    using FieldsAccessList = std::vector<const FieldImpl*>;
 
     ProtocolImpl();
     bool parse(const std::string& input);
+    bool parseAll(const FilesList& files, unsigned threads);
+    bool parseBuffer(const char* buf, std::size_t size, const std::string& name);
+    bool parseStream(std::istream& input, const std::string& name);
     bool validate();
+    bool validateAll();
 
     Schema schema() const;
 
@@ -58,6 +68,57 @@ public:
         m_errorReportCb = std::move(cb);
     }
 
+    void setDocReportCallback(DocReportFunction&& cb)
+    {
+        m_docReportCb = std::move(cb);
+    }
+
+    void setDetachedModelMode(bool enabled)
+    {
+        m_detachedModel = enabled;
+    }
+
+    void setStreamingParseMode(bool enabled)
+    {
+        m_streamingParse = enabled;
+    }
+
+    void setLazyValidationMode(bool enabled)
+    {
+        m_lazyValidation = enabled;
+    }
+
+    void setDefinitionDigestMode(bool enabled)
+    {
+        m_definitionDigest = enabled;
+    }
+
+    bool isDefinitionDigestMode() const
+    {
+        return m_definitionDigest;
+    }
+
+    std::uint64_t commonDefinitionDigest() const;
+
+    // The global fields looked up while the recorder is set are added to it,
+    // their digests are combined into the digest of the definition being
+    // parsed. Returns the previous recorder, which needs to be restored.
+    FieldsAccessList* setFieldsAccessRecorder(FieldsAccessList* recorder)
+    {
+        auto* prev = m_fieldsAccess;
+        m_fieldsAccess = recorder;
+        return prev;
+    }
+
+    void recordFieldAccess(const FieldImpl* field) const
+    {
+        if (m_fieldsAccess != nullptr) {
+            m_fieldsAccess->push_back(field);
+        }
+    }
+
+    static std::uint64_t combineFieldsDigests(std::uint64_t digest, const FieldsAccessList& fields);
+
     Logger& logger() const
     {
         return m_logger;
@@ -119,18 +180,65 @@ private:
         }
     };
 
+    struct XmlParserCtxtFree
+    {
+        void operator()(::xmlParserCtxtPtr p) const
+        {
+            ::xmlFreeParserCtxt(p);
+        }
+    };
+
+    struct XmlTextReaderFree
+    {
+        void operator()(::xmlTextReaderPtr p) const
+        {
+            ::xmlFreeTextReader(p);
+        }
+    };
+
     using XmlDocPtr = std::unique_ptr<::xmlDoc, XmlDocFree>;
+    using XmlParserCtxtPtr = std::unique_ptr<::xmlParserCtxt, XmlParserCtxtFree>;
+    using XmlTextReaderPtr = std::unique_ptr<::xmlTextReader, XmlTextReaderFree>;
+    using XmlErrorInfo = std::pair<ErrorLevel, std::string>;
+    using XmlErrorsList = std::vector<XmlErrorInfo>;
+
+    struct ParseResult
+    {
+        XmlDocPtr m_doc;
+        XmlErrorsList m_errors;
+    };
     using DocsList = std::vector<XmlDocPtr>;
+    struct PendingNsElem
+    {
+        NamespaceImplPtr m_ns;
+        ::xmlNodePtr m_node = nullptr;
+    };
+    using PendingNsElemsList = std::vector<PendingNsElem>;
+    using PendingNamespacesMap = std::map<std::string, PendingNsElemsList>;
     using SchemaImplPtr = std::unique_ptr<SchemaImpl>;
     using StrToValueConvertFunc = std::function<bool (const NamespaceImpl& ns, const std::string& ref)>;
 
-    static void cbXmlErrorFunc(void* userData, xmlErrorPtr err);
-    void handleXmlError(xmlErrorPtr err);
+    static void cbXmlCollectErrorFunc(void* userData, xmlErrorPtr err);
+    static void cbXmlCollectReaderErrorFunc(void* userData, xmlErrorPtr err);
+    static XmlErrorInfo xmlErrorToInfo(xmlErrorPtr err);
+    static XmlParserCtxtPtr createParserCtxt(ParseResult& result);
+    static void parseFile(const std::string& input, bool streaming, ParseResult& result);
+    static void parseMemory(const char* buf, std::size_t size, const std::string& name, bool streaming, ParseResult& result);
+    static bool streamDoc(::xmlParserInputBufferPtr input, const std::string& name, ParseResult& result);
+    bool acceptParseResult(const std::string& input, ParseResult& result);
     bool validateDoc(::xmlDocPtr doc);
     bool validateSchema(::xmlNodePtr node);
     bool validatePlatforms(::xmlNodePtr root);
     bool validateSinglePlatform(::xmlNodePtr node);
     bool validateNamespaces(::xmlNodePtr root);
+    bool processNamespace(NamespaceImplPtr ns);
+    bool processGlobalNsChild(::xmlNodePtr node);
+    PendingNsElemsList& pendingNamespaceElems(const std::string& name);
+    bool validatePendingNamespace(const std::string& name);
+    bool validateAllPendingNamespaces();
+    bool ensureNamespaceValidated(const std::string& name) const;
+    bool ensureAllNamespacesValidated() const;
+    bool validateGlobals();
     bool validateAllMessages();
     unsigned countMessageIds() const;
     const NamespaceImpl* getNsFromPath(const std::string& ref, bool checkRef, std::string& remName) const;
@@ -140,14 +248,26 @@ private:
     LogWrapper logWarning() const;
 
     ErrorReportFunction m_errorReportCb;
+    DocReportFunction m_docReportCb;
     DocsList m_docs;
     bool m_validated = false;
+    bool m_detachedModel = false;
+    bool m_streamingParse = false;
+    bool m_lazyValidation = false;
+    bool m_definitionDigest = false;
+    bool m_lazyFailed = false;
+    bool m_allValidated = false;
+    std::uint64_t m_commonDefinitionDigest = 0U;
+    FieldsAccessList* m_fieldsAccess = nullptr;
+    FieldsAccessList m_commonFieldsAccess;
     ErrorLevel m_minLevel = ErrorLevel_Info;
     mutable Logger m_logger;
     SchemaImplPtr m_schema;
     NamespacesMap m_namespaces;
     ExtraPrefixes m_extraPrefixes;
     PlatformsList m_platforms;
+    PendingNamespacesMap m_pendingNamespaces;
+    std::vector<std::string> m_pendingNamesOrder;
 };
 
 } // namespace commsdsl
@@ -47,11 +47,11 @@ FieldImpl::Ptr RefFieldImpl::cloneImpl() const
     return Ptr(new RefFieldImpl(*this));
 }
 
-const XmlWrap::NamesList& RefFieldImpl::extraPropsNamesImpl() const
+const XmlWrap::AtomsList& RefFieldImpl::extraPropsNamesImpl() const
 {
-    static const XmlWrap::NamesList List = {
-        common::fieldStr(),
-        common::bitLengthStr(),
+    static const XmlWrap::AtomsList List = {
+        Atom::Field,
+        Atom::BitLength,
     };
 
     return List;
@@ -70,11 +70,11 @@ bool RefFieldImpl::reuseImpl(const FieldImpl& other)
 bool RefFieldImpl::parseImpl()
 {
     bool mustHaveField = (m_field == nullptr);
-    if (!validateSinglePropInstance(common::fieldStr(), mustHaveField)) {
+    if (!validateSinglePropInstance(Atom::Field, mustHaveField)) {
         return false;
     }
 
-    auto propsIter = props().find(common::fieldStr());
+    auto propsIter = props().find(Atom::Field);
     if (propsIter == props().end()) {
         assert(m_field != nullptr);
         assert(!name().empty());
@@ -217,11 +217,11 @@ bool RefFieldImpl::verifySemanticTypeImpl(::xmlNodePtr node, SemanticType type)
 
 bool RefFieldImpl::updateBitLength()
 {
-    if (!validateSinglePropInstance(common::bitLengthStr())) {
+    if (!validateSinglePropInstance(Atom::BitLength)) {
         return false;
     }
 
-    auto& valStr = common::getStringProp(props(), common::bitLengthStr());
+    auto& valStr = common::getStringProp(props(), Atom::BitLength);
     assert(0 < maxLength());
     auto maxBitLength = maxLength() * BitsInByte;
     if (valStr.empty()) {
@@ -27,6 +27,7 @@ class SchemaImpl
 {
 public:
     using PropsMap = XmlWrap::PropsMap;
+    using AttributesMap = XmlWrap::AttributesMap;
     using ContentsList = XmlWrap::ContentsList;
 
     SchemaImpl(::xmlNodePtr node, ProtocolImpl& protocol);
@@ -78,12 +79,12 @@ public:
         return m_nonUniqueMsgIdAllowed;
     }
 
-    const PropsMap& extraAttributes() const
+    const AttributesMap& extraAttributes() const
     {
         return m_extraAttrs;
     }
 
-    PropsMap& extraAttributes()
+    AttributesMap& extraAttributes()
     {
         return m_extraAttrs;
     }
@@ -111,7 +112,7 @@ private:
     ProtocolImpl& m_protocol;
 
     PropsMap m_props;
-    PropsMap m_extraAttrs;
+    AttributesMap m_extraAttrs;
     ContentsList m_extraChildren;
     std::string m_name;
     std::string m_description;
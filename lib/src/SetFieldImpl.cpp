@@ -48,7 +48,7 @@ bool SetFieldImpl::isUnique() const
 {
     unsigned prevIdx = 0;
     bool firstElem = true;
-    for (auto& b : m_state.m_revBits) {
+    for (auto& b : *m_state.m_revBits) {
         if (firstElem) {
             prevIdx = b.first;
             firstElem = false;
@@ -76,26 +76,26 @@ FieldImpl::Ptr SetFieldImpl::cloneImpl() const
     return Ptr(new SetFieldImpl(*this));
 }
 
-const XmlWrap::NamesList& SetFieldImpl::extraPropsNamesImpl() const
+const XmlWrap::AtomsList& SetFieldImpl::extraPropsNamesImpl() const
 {
-    static const XmlWrap::NamesList List = {
-        common::defaultValueStr(),
-        common::endianStr(),
-        common::lengthStr(),
-        common::bitLengthStr(),
-        common::reservedValueStr(),
-        common::validCheckVersionStr(),
-        common::typeStr(),
-        common::nonUniqueAllowedStr()
+    static const XmlWrap::AtomsList List = {
+        Atom::DefaultValue,
+        Atom::Endian,
+        Atom::Length,
+        Atom::BitLength,
+        Atom::ReservedValue,
+        Atom::ValidCheckVersion,
+        Atom::Type,
+        Atom::NonUniqueAllowed
     };
 
     return List;
 }
 
-const XmlWrap::NamesList& SetFieldImpl::extraChildrenNamesImpl() const
+const XmlWrap::AtomsList& SetFieldImpl::extraChildrenNamesImpl() const
 {
-    static const XmlWrap::NamesList List = {
-        common::bitStr()
+    static const XmlWrap::AtomsList List = {
+        Atom::Bit
     };
 
     return List;
@@ -138,8 +138,8 @@ std::size_t SetFieldImpl::bitLengthImpl() const
 
 bool SetFieldImpl::isBitCheckableImpl(const std::string& val) const
 {
-    auto iter = m_state.m_bits.find(val);
-    return iter != m_state.m_bits.end();
+    auto iter = m_state.m_bits->find(val);
+    return iter != m_state.m_bits->end();
 }
 
 bool SetFieldImpl::strToNumericImpl(const std::string& ref, std::intmax_t& val, bool& isBigUnsigned) const
@@ -154,8 +154,8 @@ bool SetFieldImpl::strToNumericImpl(const std::string& ref, std::intmax_t& val,
         return true;
     }
 
-    auto iter = m_state.m_bits.find(ref);
-    if (iter == m_state.m_bits.end()) {
+    auto iter = m_state.m_bits->find(ref);
+    if (iter == m_state.m_bits->end()) {
         return false;
     }
 
@@ -174,8 +174,8 @@ bool SetFieldImpl::strToBoolImpl(const std::string& ref, bool& val) const
         return true;
     }
 
-    auto iter = m_state.m_bits.find(ref);
-    if (iter == m_state.m_bits.end()) {
+    auto iter = m_state.m_bits->find(ref);
+    if (iter == m_state.m_bits->end()) {
         return false;
     }
 
@@ -199,11 +199,11 @@ bool SetFieldImpl::validateBitLengthValueImpl(::xmlNodePtr node, std::size_t bit
 
 bool SetFieldImpl::updateEndian()
 {
-    if (!validateSinglePropInstance(common::endianStr())) {
+    if (!validateSinglePropInstance(Atom::Endian)) {
         return false;
     }
 
-    auto& endianStr = common::getStringProp(props(), common::endianStr());
+    auto& endianStr = common::getStringProp(props(), Atom::Endian);
     if ((endianStr.empty()) && (m_state.m_endian != Endian_NumOfValues)) {
         return true;
     }
@@ -218,11 +218,11 @@ bool SetFieldImpl::updateEndian()
 
 bool SetFieldImpl::updateType()
 {
-    if (!validateSinglePropInstance(common::typeStr())) {
+    if (!validateSinglePropInstance(Atom::Type)) {
         return false;
     }
 
-    auto typeIter = props().find(common::typeStr());
+    auto typeIter = props().find(Atom::Type);
     if (typeIter == props().end()) {
         return true;
     }
@@ -254,7 +254,7 @@ bool SetFieldImpl::updateLength()
             (m_state.m_type == Type::NumOfValues) &&
             (m_state.m_length == 0U) &&
             (!isBitfieldMember());
-    if (!validateSinglePropInstance(common::lengthStr(), mustHaveLength)) {
+    if (!validateSinglePropInstance(Atom::Length, mustHaveLength)) {
         return false;
     }
 
@@ -263,7 +263,7 @@ bool SetFieldImpl::updateLength()
         maxLength = IntFieldImpl::maxTypeLength(m_state.m_type);
     }
 
-    auto& lengthStr = common::getStringProp(props(), common::lengthStr());
+    auto& lengthStr = common::getStringProp(props(), Atom::Length);
     do {
         if (lengthStr.empty()) {
             if ((m_state.m_length == 0U) && (m_state.m_type != Type::NumOfValues)) {
@@ -294,11 +294,11 @@ bool SetFieldImpl::updateLength()
     } while (false);
 
     bool mustHaveBitLength = (isBitfieldMember() && m_state.m_bitLength == 0U && (m_state.m_length == 0U));
-    if (!validateSinglePropInstance(common::bitLengthStr(), mustHaveBitLength)) {
+    if (!validateSinglePropInstance(Atom::BitLength, mustHaveBitLength)) {
         return false;
     }
 
-    auto& bitLengthStr = common::getStringProp(props(), common::bitLengthStr());
+    auto& bitLengthStr = common::getStringProp(props(), Atom::BitLength);
     do {
         if (bitLengthStr.empty()) {
             if (m_state.m_bitLength == 0U) {
@@ -366,11 +366,11 @@ bool SetFieldImpl::updateNonUniqueAllowed()
 {
     bool wasAllowed = m_state.m_nonUniqueAllowed;
     bool newAllowed = false;
-    if (!validateAndUpdateBoolPropValue(common::nonUniqueAllowedStr(), newAllowed)) {
+    if (!validateAndUpdateBoolPropValue(Atom::NonUniqueAllowed, newAllowed)) {
         return false;
     }
 
-    auto& valueStr = common::getStringProp(props(), common::nonUniqueAllowedStr());
+    auto& valueStr = common::getStringProp(props(), Atom::NonUniqueAllowed);
     if (valueStr.empty()) {
         return true;
     }
@@ -387,12 +387,12 @@ bool SetFieldImpl::updateNonUniqueAllowed()
 
 bool SetFieldImpl::updateValidCheckVersion()
 {
-    return validateAndUpdateBoolPropValue(common::validCheckVersionStr(), m_state.m_validCheckVersion);
+    return validateAndUpdateBoolPropValue(Atom::ValidCheckVersion, m_state.m_validCheckVersion);
 }
 
 bool SetFieldImpl::updateDefaultValue()
 {
-    auto& propName = common::defaultValueStr();
+    auto propName = Atom::DefaultValue;
     auto iter = props().find(propName);
     if (iter == props().end()) {
         return true;
@@ -408,7 +408,7 @@ bool SetFieldImpl::updateDefaultValue()
 
 bool SetFieldImpl::updateReservedValue()
 {
-    auto& propName = common::reservedValueStr();
+    auto propName = Atom::ReservedValue;
     auto iter = props().find(propName);
     if (iter == props().end()) {
         return true;
@@ -426,8 +426,8 @@ bool SetFieldImpl::updateBits()
 {
     auto bits = XmlWrap::getChildren(getNode(), common::bitStr());
     if (bits.empty()) {
-        if (!m_state.m_bits.empty()) {
-            assert(!m_state.m_revBits.empty());
+        if (!m_state.m_bits->empty()) {
+            assert(!m_state.m_revBits->empty());
             return true; // already has values
         }
 
@@ -437,56 +437,56 @@ bool SetFieldImpl::updateBits()
     }
 
     for (auto* b : bits) {
-        static const XmlWrap::NamesList PropNames = {
-            common::nameStr(),
-            common::idxStr(),
-            common::defaultValueStr(),
-            common::reservedValueStr(),
-            common::reservedStr(),
-            common::sinceVersionStr(),
-            common::deprecatedStr(),
-            common::descriptionStr(),
-            common::displayNameStr()
+        static const XmlWrap::AtomsList PropNames = {
+            Atom::Name,
+            Atom::Idx,
+            Atom::DefaultValue,
+            Atom::ReservedValue,
+            Atom::Reserved,
+            Atom::SinceVersion,
+            Atom::Deprecated,
+            Atom::Description,
+            Atom::DisplayName
         };
 
-        auto props = XmlWrap::parseNodeProps(b);
+        auto props = XmlWrap::parseNodeAtomProps(b);
         if (!XmlWrap::parseChildrenAsProps(b, PropNames, protocol().logger(), props)) {
             return false;
         }
 
-        if (!XmlWrap::validateSinglePropInstance(b, props, common::nameStr(), protocol().logger(), true)) {
+        if (!XmlWrap::validateSinglePropInstance(b, props, Atom::Name, protocol().logger(), true)) {
             return false;
         }
 
-        if (!XmlWrap::validateSinglePropInstance(b, props, common::idxStr(), protocol().logger(), true)) {
+        if (!XmlWrap::validateSinglePropInstance(b, props, Atom::Idx, protocol().logger(), true)) {
             return false;
         }
 
-        if (!XmlWrap::validateSinglePropInstance(b, props, common::defaultValueStr(), protocol().logger())) {
+        if (!XmlWrap::validateSinglePropInstance(b, props, Atom::DefaultValue, protocol().logger())) {
             return false;
         }
 
-        if (!XmlWrap::validateSinglePropInstance(b, props, common::reservedValueStr(), protocol().logger())) {
+        if (!XmlWrap::validateSinglePropInstance(b, props, Atom::ReservedValue, protocol().logger())) {
             return false;
         }
 
-        if (!XmlWrap::validateSinglePropInstance(b, props, common::reservedStr(), protocol().logger())) {
+        if (!XmlWrap::validateSinglePropInstance(b, props, Atom::Reserved, protocol().logger())) {
             return false;
         }
 
-        if (!XmlWrap::validateSinglePropInstance(b, props, common::sinceVersionStr(), protocol().logger())) {
+        if (!XmlWrap::validateSinglePropInstance(b, props, Atom::SinceVersion, protocol().logger())) {
             return false;
         }
 
-        if (!XmlWrap::validateSinglePropInstance(b, props, common::deprecatedStr(), protocol().logger())) {
+        if (!XmlWrap::validateSinglePropInstance(b, props, Atom::Deprecated, protocol().logger())) {
             return false;
         }
 
-        if (!XmlWrap::validateSinglePropInstance(b, props, common::descriptionStr(), protocol().logger())) {
+        if (!XmlWrap::validateSinglePropInstance(b, props, Atom::Description, protocol().logger())) {
             return false;
         }
 
-        if (!XmlWrap::validateSinglePropInstance(b, props, common::displayNameStr(), protocol().logger())) {
+        if (!XmlWrap::validateSinglePropInstance(b, props, Atom::DisplayName, protocol().logger())) {
             return false;
         }
 
@@ -495,7 +495,7 @@ bool SetFieldImpl::updateBits()
         auto extraChildren = XmlWrap::getExtraChildren(b, PropNames, protocol());
         static_cast<void>(extraChildren);        
 
-        auto nameIter = props.find(common::nameStr());
+        auto nameIter = props.find(Atom::Name);
         assert(nameIter != props.end());
 
         if (!common::isValidName(nameIter->second)) {
@@ -505,14 +505,14 @@ bool SetFieldImpl::updateBits()
             return false;
         }
 
-        auto bitsIter = m_state.m_bits.find(nameIter->second);
-        if (bitsIter != m_state.m_bits.end()) {
+        auto bitsIter = m_state.m_bits->find(nameIter->second);
+        if (bitsIter != m_state.m_bits->end()) {
             logError() << XmlWrap::logPrefix(b) << "Bit with name \"" << nameIter->second <<
                           "\" has already been defined for set \"" << name() << "\".";
             return false;
         }
 
-        auto idxIter = props.find(common::idxStr());
+        auto idxIter = props.find(Atom::Idx);
         assert(idxIter != props.end());
 
         bool ok = false;
@@ -529,8 +529,8 @@ bool SetFieldImpl::updateBits()
             return false;
         }
         if (!m_state.m_nonUniqueAllowed) {
-            auto revBitsIter = m_state.m_revBits.find(idx);
-            if (revBitsIter != m_state.m_revBits.end()) {
+            auto revBitsIter = m_state.m_revBits->find(idx);
+            if (revBitsIter != m_state.m_revBits->end()) {
                 logError() << XmlWrap::logPrefix(b) <<
                       "Bit \"" << revBitsIter->first << "\" has been already defined "
                       "as \"" << revBitsIter->second << "\".";
@@ -545,7 +545,7 @@ bool SetFieldImpl::updateBits()
         info.m_sinceVersion = getSinceVersion();
         info.m_deprecatedSince = getDeprecated();
         do {
-            auto& bitDefaultValueStr = common::getStringProp(props, common::defaultValueStr());
+            auto& bitDefaultValueStr = common::getStringProp(props, Atom::DefaultValue);
             if (bitDefaultValueStr.empty()) {
                 break;
             }
@@ -558,7 +558,7 @@ bool SetFieldImpl::updateBits()
         } while (false);
 
         do{
-            auto& bitReservedStr = common::getStringProp(props, common::reservedStr());
+            auto& bitReservedStr = common::getStringProp(props, Atom::Reserved);
             if (bitReservedStr.empty()) {
                 break;
             }
@@ -572,7 +572,7 @@ bool SetFieldImpl::updateBits()
 
 
         do {
-            auto& bitReservedValueStr = common::getStringProp(props, common::reservedValueStr());
+            auto& bitReservedValueStr = common::getStringProp(props, Atom::ReservedValue);
             if (bitReservedValueStr.empty()) {
                 break;
             }
@@ -605,19 +605,19 @@ bool SetFieldImpl::updateBits()
         do {
             if (!m_state.m_nonUniqueAllowed) {
                 // The bit hasn't been processed earlier
-                assert(m_state.m_revBits.find(idx) == m_state.m_revBits.end());
+                assert(m_state.m_revBits->find(idx) == m_state.m_revBits->end());
                 break;
             }
 
-            auto revIters = m_state.m_revBits.equal_range(idx);
+            auto revIters = m_state.m_revBits->equal_range(idx);
             if (revIters.first == revIters.second) {
                 // The bit hasn't been processed earlier
                 break;
             }
 
             for (auto rIter = revIters.first; rIter != revIters.second; ++rIter) {
-                auto iter = m_state.m_bits.find(rIter->second);
-                assert(iter != m_state.m_bits.end());
+                auto iter = m_state.m_bits->find(rIter->second);
+                assert(iter != m_state.m_bits->end());
 
                 if (iter->second.m_deprecatedSince <= info.m_sinceVersion) {
                     assert(iter->second.m_sinceVersion < info.m_sinceVersion);
@@ -652,20 +652,20 @@ bool SetFieldImpl::updateBits()
             }
         } while(false);
 
-        auto descIter = props.find(common::descriptionStr());
+        auto descIter = props.find(Atom::Description);
         if (descIter != props.end()) {
             info.m_description = descIter->second;
         }
 
-        auto dispNameIter = props.find(common::displayNameStr());
+        auto dispNameIter = props.find(Atom::DisplayName);
         if ((dispNameIter != props.end()) &&
             (!protocol().strToStringValue(dispNameIter->second, info.m_displayName))) {
             XmlWrap::reportUnexpectedPropertyValue(b, nameIter->second, common::displayNameStr(), dispNameIter->second, protocol().logger());
             return false;
         }
 
-        m_state.m_bits.emplace(nameIter->second, info);
-        m_state.m_revBits.emplace(idx, nameIter->second);
+        m_state.m_bits.modify().emplace(nameIter->second, info);
+        m_state.m_revBits.modify().emplace(idx, nameIter->second);
     }
 
     return true;
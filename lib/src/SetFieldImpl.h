@@ -60,12 +60,12 @@ public:
 
     const Bits& bits() const
     {
-        return m_state.m_bits;
+        return *m_state.m_bits;
     }
 
     const RevBits& revBits() const
     {
-        return m_state.m_revBits;
+        return *m_state.m_revBits;
     }
 
     bool isNonUniqueAllowed() const
@@ -83,8 +83,8 @@ public:
 protected:
     virtual Kind kindImpl() const override final;
     virtual Ptr cloneImpl() const override final;
-    virtual const XmlWrap::NamesList& extraPropsNamesImpl() const override final;
-    virtual const XmlWrap::NamesList& extraChildrenNamesImpl() const override final;
+    virtual const XmlWrap::AtomsList& extraPropsNamesImpl() const override final;
+    virtual const XmlWrap::AtomsList& extraChildrenNamesImpl() const override final;
     virtual bool reuseImpl(const FieldImpl& other) override final;
     virtual bool parseImpl() override final;
     virtual std::size_t minLengthImpl() const override final;
@@ -111,8 +111,8 @@ private:
         Endian m_endian = Endian_NumOfValues;
         std::size_t m_length = 0U;
         std::size_t m_bitLength = 0U;
-        Bits m_bits;
-        RevBits m_revBits;
+        CopyOnWrite<Bits> m_bits;
+        CopyOnWrite<RevBits> m_revBits;
         bool m_nonUniqueAllowed = false;
         bool m_defaultBitValue = false;
         bool m_reservedBitValue = false;
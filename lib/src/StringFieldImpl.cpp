@@ -61,31 +61,31 @@ FieldImpl::Ptr StringFieldImpl::cloneImpl() const
     return Ptr(new StringFieldImpl(*this));
 }
 
-const XmlWrap::NamesList& StringFieldImpl::extraPropsNamesImpl() const
+const XmlWrap::AtomsList& StringFieldImpl::extraPropsNamesImpl() const
 {
-    static const XmlWrap::NamesList List = {
-        common::lengthStr(),
-        common::encodingStr(),
-        common::zeroTermSuffixStr(),
-        common::defaultValueStr()
+    static const XmlWrap::AtomsList List = {
+        Atom::Length,
+        Atom::Encoding,
+        Atom::ZeroTermSuffix,
+        Atom::DefaultValue
     };
 
     return List;
 }
 
-const XmlWrap::NamesList& StringFieldImpl::extraPossiblePropsNamesImpl() const
+const XmlWrap::AtomsList& StringFieldImpl::extraPossiblePropsNamesImpl() const
 {
-    static const XmlWrap::NamesList List = {
-        common::lengthPrefixStr(),
+    static const XmlWrap::AtomsList List = {
+        Atom::LengthPrefix,
     };
 
     return List;
 }
 
-const XmlWrap::NamesList& StringFieldImpl::extraChildrenNamesImpl() const
+const XmlWrap::AtomsList& StringFieldImpl::extraChildrenNamesImpl() const
 {
-    static const XmlWrap::NamesList List = {
-        common::lengthPrefixStr()
+    static const XmlWrap::AtomsList List = {
+        Atom::LengthPrefix
     };
 
     return List;
@@ -186,7 +186,7 @@ bool StringFieldImpl::strToStringImpl(const std::string& ref, std::string& val)
 
 bool StringFieldImpl::updateDefaultValue()
 {
-    auto& propName = common::defaultValueStr();
+    auto propName = Atom::DefaultValue;
     if (!validateSinglePropInstance(propName)) {
         return false;
     }
@@ -214,11 +214,11 @@ bool StringFieldImpl::updateDefaultValue()
 
 bool StringFieldImpl::updateEncoding()
 {
-    if (!validateSinglePropInstance(common::encodingStr())) {
+    if (!validateSinglePropInstance(Atom::Encoding)) {
         return false;
     }
 
-    auto iter = props().find(common::encodingStr());
+    auto iter = props().find(Atom::Encoding);
     if (iter != props().end()) {
         m_state.m_encoding = iter->second;
     }
@@ -228,11 +228,11 @@ bool StringFieldImpl::updateEncoding()
 
 bool StringFieldImpl::updateLength()
 {
-    if (!validateSinglePropInstance(common::lengthStr())) {
+    if (!validateSinglePropInstance(Atom::Length)) {
         return false;
     }
 
-    auto iter = props().find(common::lengthStr());
+    auto iter = props().find(Atom::Length);
     if (iter == props().end()) {
         return true;
     }
@@ -292,11 +292,11 @@ bool StringFieldImpl::updatePrefix()
 
 bool StringFieldImpl::updateZeroTerm()
 {
-    if (!validateSinglePropInstance(common::zeroTermSuffixStr())) {
+    if (!validateSinglePropInstance(Atom::ZeroTermSuffix)) {
         return false;
     }
 
-    auto iter = props().find(common::zeroTermSuffixStr());
+    auto iter = props().find(Atom::ZeroTermSuffix);
     if (iter == props().end()) {
         return true;
     }
@@ -335,11 +335,11 @@ bool StringFieldImpl::updateZeroTerm()
 
 bool StringFieldImpl::checkPrefixFromRef()
 {
-    if (!validateSinglePropInstance(common::lengthPrefixStr())) {
+    if (!validateSinglePropInstance(Atom::LengthPrefix)) {
         return false;
     }
 
-    auto iter = props().find(common::lengthPrefixStr());
+    auto iter = props().find(Atom::LengthPrefix);
     if (iter == props().end()) {
         return true;
     }
@@ -411,7 +411,7 @@ bool StringFieldImpl::checkPrefixAsChild()
         return false;
     }
 
-    auto iter = props().find(common::lengthPrefixStr());
+    auto iter = props().find(Atom::LengthPrefix);
     bool hasInProps = iter != props().end();
     if (prefixFields.empty()) {
         if (hasInProps) {
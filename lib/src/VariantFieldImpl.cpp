@@ -37,10 +37,10 @@ const XmlWrap::NamesList& variantSupportedTypes()
     return Names;
 }
 
-XmlWrap::NamesList getExtraNames()
+XmlWrap::AtomsList getExtraNames()
 {
-    auto names = variantSupportedTypes();
-    names.push_back(common::membersStr());
+    auto names = toAtoms(variantSupportedTypes());
+    names.push_back(Atom::Members);
     return names;
 }
 
@@ -84,19 +84,19 @@ FieldImpl::Ptr VariantFieldImpl::cloneImpl() const
     return Ptr(new VariantFieldImpl(*this));
 }
 
-const XmlWrap::NamesList& VariantFieldImpl::extraPropsNamesImpl() const
+const XmlWrap::AtomsList& VariantFieldImpl::extraPropsNamesImpl() const
 {
-    static const XmlWrap::NamesList List = {
-        common::defaultMemberStr(),
-        common::displayIdxReadOnlyHiddenStr()
+    static const XmlWrap::AtomsList List = {
+        Atom::DefaultMember,
+        Atom::DisplayIdxReadOnlyHidden
     };
 
     return List;
 }
 
-const XmlWrap::NamesList& VariantFieldImpl::extraChildrenNamesImpl() const
+const XmlWrap::AtomsList& VariantFieldImpl::extraChildrenNamesImpl() const
 {
-    static const XmlWrap::NamesList Names = getExtraNames();
+    static const XmlWrap::AtomsList Names = getExtraNames();
     return Names;
 }
 
@@ -291,7 +291,7 @@ bool VariantFieldImpl::updateMembers()
 
 bool VariantFieldImpl::updateDefaultMember()
 {
-    auto& propName = common::defaultMemberStr();
+    auto propName = Atom::DefaultMember;
     if (!validateSinglePropInstance(propName)) {
         return false;
     }
@@ -357,7 +357,7 @@ bool VariantFieldImpl::updateDefaultMember()
     
 bool VariantFieldImpl::updateIdxHidden()
 {
-    return validateAndUpdateBoolPropValue(common::displayIdxReadOnlyHiddenStr(), m_state.m_idxHidden);
+    return validateAndUpdateBoolPropValue(Atom::DisplayIdxReadOnlyHidden, m_state.m_idxHidden);
 }
 
 } // namespace commsdsl
@@ -24,25 +24,300 @@
 namespace commsdsl
 {
 
+namespace
+{
+
+inline
+const char* toStr(const ::xmlChar* str)
+{
+    return reinterpret_cast<const char*>(str);
+}
+
+// Compares the element and property names in place, without creating
+// temporary std::string objects.
+inline
+bool isNameInList(const ::xmlChar* name, const XmlWrap::NamesList& names)
+{
+    auto* nameStr = toStr(name);
+    return
+        std::any_of(
+            names.begin(), names.end(),
+            [nameStr](const std::string& n)
+            {
+                return n == nameStr;
+            });
+}
+
+inline
+bool isNameInLists(const ::xmlChar* name, XmlWrap::NamesListsRefs names)
+{
+    return
+        std::any_of(
+            names.begin(), names.end(),
+            [name](const XmlWrap::NamesList* n)
+            {
+                return isNameInList(name, *n);
+            });
+}
+
+inline
+bool isNameInLists(const ::xmlChar* name, XmlWrap::AtomsListsRefs atoms)
+{
+    return isAtomInLists(toAtom(toStr(name)), atoms);
+}
+
+inline
+const std::string& propName(const std::string& str)
+{
+    return str;
+}
+
+inline
+const std::string& propName(Atom atom)
+{
+    return atomStr(atom);
+}
+
+// Most of the attributes have single text node as a value, which
+// doesn't require an allocation of the concatenated string.
+std::string getPropValue(::xmlNodePtr node, ::xmlAttrPtr prop)
+{
+    auto* child = prop->children;
+    if (child == nullptr) {
+        return std::string();
+    }
+
+    std::string result;
+    if ((child->next == nullptr) && (child->type == XML_TEXT_NODE) && (child->content != nullptr)) {
+        result = toStr(child->content);
+    }
+    else {
+        XmlWrap::StringPtr valuePtr(::xmlNodeListGetString(node->doc, child, 1));
+        if (valuePtr) {
+            result = toStr(valuePtr.get());
+        }
+    }
+
+    common::removeHeadingTrailingWhitespaces(result);
+    return result;
+}
+
+template <typename TNames>
+XmlWrap::AttributesMap getUnknownPropsImpl(::xmlNodePtr node, TNames names)
+{
+    XmlWrap::AttributesMap props;
+    for (auto* prop = node->properties; prop != nullptr; prop = prop->next) {
+        if (!isNameInLists(prop->name, names)) {
+            props.emplace(toStr(prop->name), getPropValue(node, prop));
+        }
+    }
+    return props;
+}
+
+template <typename TNames>
+XmlWrap::NodesList getUnknownChildrenImpl(::xmlNodePtr node, TNames names)
+{
+    XmlWrap::NodesList result;
+    for (auto* c = node->children; c != nullptr; c = c->next) {
+        if ((c->type == XML_ELEMENT_NODE) && (!isNameInLists(c->name, names))) {
+            result.push_back(c);
+        }
+    }
+    return result;
+}
+
+template <typename TProps, typename TKey>
+bool validateSinglePropInstanceImpl(
+    ::xmlNodePtr node,
+    const TProps& props,
+    const TKey& key,
+    Logger& logger,
+    bool mustHave)
+{
+    auto count = props.count(key);
+    if (1U < count) {
+        commsdsl::logError(logger) << XmlWrap::logPrefix(node) <<
+                      "Too many values of \"" << propName(key) << "\" property for \"" << node->name << "\" element.";
+        return false;
+    }
+
+    if ((count == 0U) && mustHave) {
+        commsdsl::logError(logger) << XmlWrap::logPrefix(node) <<
+                      "Missing value for mandatory property \"" << propName(key) << "\" for \"" << node->name << "\" element.";
+        return false;
+    }
+
+    return true;
+}
+
+template <typename TProps, typename TKey>
+bool validateNoPropInstanceImpl(::xmlNodePtr node, const TProps& props, const TKey& key, Logger& logger)
+{
+    auto iter = props.find(key);
+    if (iter != props.end()) {
+        commsdsl::logError(logger) << XmlWrap::logPrefix(node) <<
+                      "Preperty \"" << propName(key) << "\" defined when should not.";
+        return false;
+    }
+
+    return true;
+}
+
+template <typename TProps, typename TKey>
+bool getAndCheckVersionsImpl(
+    ::xmlNodePtr node,
+    const std::string& name,
+    const TProps& props,
+    const TKey& sinceVersionKey,
+    const TKey& deprecatedKey,
+    unsigned& sinceVersion,
+    unsigned& deprecatedSince,
+    ProtocolImpl& protocol)
+{
+    auto parentVersion = sinceVersion;
+    auto parentDeprecated = deprecatedSince;
+    auto sinceVerIter = props.find(sinceVersionKey);
+    do {
+        if (sinceVerIter == props.end()) {
+            assert(sinceVersion <= protocol.schemaImpl().version());
+            break;
+        }
+
+        auto& sinceVerStr = sinceVerIter->second;
+        bool ok = false;
+        sinceVersion = common::strToUnsigned(sinceVerStr, &ok);
+        if (!ok) {
+            XmlWrap::reportUnexpectedPropertyValue(node, name, common::sinceVersionStr(), sinceVerStr, protocol.logger());
+            return false;
+        }
+
+    } while (false);
+
+    auto deprecatedIter = props.find(deprecatedKey);
+    do {
+        if (deprecatedIter == props.end()) {
+            break;
+        }
+
+        auto& deprecatedStr = deprecatedIter->second;
+        bool ok = false;
+        deprecatedSince = common::strToUnsigned(deprecatedStr, &ok);
+        if (!ok) {
+            XmlWrap::reportUnexpectedPropertyValue(node, name, common::deprecatedStr(), deprecatedStr, protocol.logger());
+            return false;
+        }
+
+    } while (false);
+
+    if (!XmlWrap::checkVersions(node, sinceVersion, deprecatedSince, protocol, parentVersion, parentDeprecated)) {
+        return false;
+    }
+
+    return true;
+}
+
+template <typename TNames>
+XmlWrap::AttributesMap getExtraAttributesImpl(::xmlNodePtr node, TNames names, ProtocolImpl& protocol)
+{
+    auto attrs = XmlWrap::getUnknownProps(node, names);
+    auto& expectedPrefixes = protocol.extraElementPrefixes();
+    for (auto& a : attrs) {
+        bool expected =
+            std::any_of(
+                expectedPrefixes.begin(), expectedPrefixes.end(),
+                [&a](const std::string& prefix)
+                {
+                    if (a.first.size() < prefix.size()) {
+                        return false;
+                    }
+
+                    return (a.first.compare(0, prefix.size(), prefix) == 0);
+                });
+
+        if (!expected) {
+            commsdsl::logWarning(protocol.logger()) << XmlWrap::logPrefix(node) <<
+                "Unexpected attribute \"" << a.first << "\".";
+        }
+    }
+
+    return attrs;
+}
+
+template <typename TNames>
+XmlWrap::ContentsList getExtraChildrenImpl(::xmlNodePtr node, TNames names, ProtocolImpl& protocol)
+{
+    XmlWrap::ContentsList result;
+    auto extraChildren = XmlWrap::getUnknownChildren(node, names);
+    auto& expectedPrefixes = protocol.extraElementPrefixes();
+    for (auto c : extraChildren) {
+        std::string name(reinterpret_cast<const char*>(c->name));
+        bool expected =
+            std::any_of(
+                expectedPrefixes.begin(), expectedPrefixes.end(),
+                [&name](const std::string& prefix)
+                {
+                    if (name.size() < prefix.size()) {
+                        return false;
+                    }
+
+                    return (name.compare(0, prefix.size(), prefix) == 0);
+                });
+
+        if (!expected) {
+            commsdsl::logWarning(protocol.logger()) << XmlWrap::logPrefix(c) <<
+                "Unexpected element \"" << name << "\".";
+        }
+        result.push_back(XmlWrap::getElementContent(c));
+    }
+    return result;
+}
+
+} // namespace
+
 const XmlWrap::NamesList& XmlWrap::emptyNamesList()
 {
     static const NamesList List;
     return List;
 }
 
+const XmlWrap::AtomsList& XmlWrap::emptyAtomsList()
+{
+    static const AtomsList List;
+    return List;
+}
+
 XmlWrap::PropsMap XmlWrap::parseNodeProps(::xmlNodePtr node)
 {
     assert(node != nullptr);
     PropsMap map;
-    auto* prop = node->properties;
-    while (prop != nullptr) {
-        StringPtr valuePtr(::xmlNodeListGetString(node->doc, prop->children, 1));
-        auto iter = map.insert(
-            std::make_pair(
-                reinterpret_cast<const char*>(prop->name),
-                reinterpret_cast<const char*>(valuePtr.get())));
-        common::removeHeadingTrailingWhitespaces(iter->second);
-        prop = prop->next;
+    std::size_t count = 0U;
+    for (auto* prop = node->properties; prop != nullptr; prop = prop->next) {
+        ++count;
+    }
+
+    map.reserve(count);
+    for (auto* prop = node->properties; prop != nullptr; prop = prop->next) {
+        map.emplace(toStr(prop->name), getPropValue(node, prop));
+    }
+
+    return map;
+}
+
+XmlWrap::AtomPropsMap XmlWrap::parseNodeAtomProps(::xmlNodePtr node)
+{
+    assert(node != nullptr);
+    AtomPropsMap map;
+    std::size_t count = 0U;
+    for (auto* prop = node->properties; prop != nullptr; prop = prop->next) {
+        ++count;
+    }
+
+    map.reserve(count);
+    for (auto* prop = node->properties; prop != nullptr; prop = prop->next) {
+        auto atom = toAtom(toStr(prop->name));
+        if (atom != Atom::Unknown) {
+            map.emplace(atom, getPropValue(node, prop));
+        }
     }
 
     return map;
@@ -50,11 +325,17 @@ XmlWrap::PropsMap XmlWrap::parseNodeProps(::xmlNodePtr node)
 
 XmlWrap::NodesList XmlWrap::getChildren(::xmlNodePtr node, const std::string& name)
 {
-    NamesList names;
-    if (!name.empty()) {
-        names.push_back(name);
+    NodesList result;
+    for (auto* cur = node->children; cur != nullptr; cur = cur->next) {
+        if (cur->type != XML_ELEMENT_NODE) {
+            continue;
+        }
+
+        if (name.empty() || (name == toStr(cur->name))) {
+            result.push_back(cur);
+        }
     }
-    return getChildren(node, names);
+    return result;
 }
 
 XmlWrap::NodesList XmlWrap::getChildren(::xmlNodePtr node, const NamesList& names)
@@ -67,14 +348,7 @@ XmlWrap::NodesList XmlWrap::getChildren(::xmlNodePtr node, const NamesList& name
                 break;
             }
 
-            if (names.empty()) {
-                result.push_back(cur);
-                break;
-            }
-
-            std::string elemName(reinterpret_cast<const char*>(cur->name));
-            auto iter = std::find(names.begin(), names.end(), elemName);
-            if (iter != names.end()) {
+            if (names.empty() || isNameInList(cur->name, names)) {
                 result.push_back(cur);
                 break;
             }
@@ -114,13 +388,13 @@ bool XmlWrap::parseNodeValue(
     std::string& value,
     bool mustHaveValue)
 {
-    auto props = parseNodeProps(node);
     static const std::string ValueAttr("value");
-    auto valIter = props.find(ValueAttr);
     std::string valueTmp;
-    if (valIter != props.end()) {
-        valueTmp = valIter->second;
-        common::removeHeadingTrailingWhitespaces(valueTmp);
+    for (auto* prop = node->properties; prop != nullptr; prop = prop->next) {
+        if (ValueAttr == toStr(prop->name)) {
+            valueTmp = getPropValue(node, prop);
+            break;
+        }
     }
 
     auto text = getText(node);
@@ -160,11 +434,8 @@ bool XmlWrap::parseChildrenAsProps(
     PropsMap& result,
     bool mustHaveValue)
 {
-    auto children = getChildren(node);
-    for (auto* c : children) {
-        std::string cName(reinterpret_cast<const char*>(c->name));
-        auto iter = std::find(names.begin(), names.end(), cName);
-        if (iter == names.end()) {
+    for (auto* c = node->children; c != nullptr; c = c->next) {
+        if ((c->type != XML_ELEMENT_NODE) || (!isNameInList(c->name, names))) {
             continue;
         }
 
@@ -177,38 +448,72 @@ bool XmlWrap::parseChildrenAsProps(
             continue;
         }
 
-        result.insert(std::make_pair(cName, std::move(value)));
+        result.emplace(toStr(c->name), std::move(value));
     }
 
     return true;
 }
 
-XmlWrap::PropsMap XmlWrap::getUnknownProps(::xmlNodePtr node, const XmlWrap::NamesList& names)
+bool XmlWrap::parseChildrenAsProps(
+    ::xmlNodePtr node,
+    const AtomsList& names,
+    Logger& logger,
+    AtomPropsMap& result,
+    bool mustHaveValue)
 {
-    auto props = parseNodeProps(node);
-    for (auto& n : names) {
-        auto iters = props.equal_range(n);
-        if (iters.first == iters.second) {
+    for (auto* c = node->children; c != nullptr; c = c->next) {
+        if (c->type != XML_ELEMENT_NODE) {
+            continue;
+        }
+
+        auto atom = toAtom(toStr(c->name));
+        if ((atom == Atom::Unknown) || (!isAtomInLists(atom, {&names}))) {
             continue;
         }
 
-        props.erase(iters.first, iters.second);
+        std::string value;
+        if ((!parseNodeValue(c, logger, value, mustHaveValue)) && (mustHaveValue)) {
+            return false;
+        }
+
+        if (value.empty()) {
+            continue;
+        }
+
+        result.emplace(atom, std::move(value));
     }
-    return props;
+
+    return true;
+}
+
+XmlWrap::AttributesMap XmlWrap::getUnknownProps(::xmlNodePtr node, const XmlWrap::NamesList& names)
+{
+    return getUnknownProps(node, {&names});
+}
+
+XmlWrap::AttributesMap XmlWrap::getUnknownProps(::xmlNodePtr node, NamesListsRefs names)
+{
+    return getUnknownPropsImpl(node, names);
+}
+
+XmlWrap::AttributesMap XmlWrap::getUnknownProps(::xmlNodePtr node, AtomsListsRefs names)
+{
+    return getUnknownPropsImpl(node, names);
 }
 
 XmlWrap::NodesList XmlWrap::getUnknownChildren(::xmlNodePtr node, const XmlWrap::NamesList& names)
 {
-    NodesList result;
-    auto children = getChildren(node);
-    for (auto* c : children) {
-        std::string cName(reinterpret_cast<const char*>(c->name));
-        auto iter = std::find(names.begin(), names.end(), cName);
-        if (iter == names.end()) {
-            result.push_back(c);
-        }
-    }
-    return result;
+    return getUnknownChildren(node, {&names});
+}
+
+XmlWrap::NodesList XmlWrap::getUnknownChildren(::xmlNodePtr node, NamesListsRefs names)
+{
+    return getUnknownChildrenImpl(node, names);
+}
+
+XmlWrap::NodesList XmlWrap::getUnknownChildren(::xmlNodePtr node, AtomsListsRefs names)
+{
+    return getUnknownChildrenImpl(node, names);
 }
 
 std::string XmlWrap::getElementContent(::xmlNodePtr node)
@@ -253,42 +558,33 @@ bool XmlWrap::validateSinglePropInstance(
     Logger& logger,
     bool mustHave)
 {
-    auto count = props.count(str);
-    if (1U < count) {
-        commsdsl::logError(logger) << XmlWrap::logPrefix(node) <<
-                      "Too many values of \"" << str << "\" property for \"" << node->name << "\" element.";
-        return false;
-    }
-
-    if ((count == 0U) && mustHave) {
-        commsdsl::logError(logger) << XmlWrap::logPrefix(node) <<
-                      "Missing value for mandatory property \"" << str << "\" for \"" << node->name << "\" element.";
-        return false;
-    }
+    return validateSinglePropInstanceImpl(node, props, str, logger, mustHave);
+}
 
-    return true;
+bool XmlWrap::validateSinglePropInstance(
+    ::xmlNodePtr node,
+    const AtomPropsMap& props,
+    Atom prop,
+    Logger& logger,
+    bool mustHave)
+{
+    return validateSinglePropInstanceImpl(node, props, prop, logger, mustHave);
 }
 
 bool XmlWrap::validateNoPropInstance(::xmlNodePtr node, const XmlWrap::PropsMap& props, const std::string& str, Logger& logger)
 {
-    auto iter = props.find(str);
-    if (iter != props.end()) {
-        commsdsl::logError(logger) << XmlWrap::logPrefix(node) <<
-                      "Preperty \"" << str << "\" defined when should not.";
-        return false;
-    }
+    return validateNoPropInstanceImpl(node, props, str, logger);
+}
 
-    return true;
+bool XmlWrap::validateNoPropInstance(::xmlNodePtr node, const AtomPropsMap& props, Atom prop, Logger& logger)
+{
+    return validateNoPropInstanceImpl(node, props, prop, logger);
 }
 
 bool XmlWrap::hasAnyChild(::xmlNodePtr node, const XmlWrap::NamesList& names)
 {
-    ContentsList result;
-    auto children = getChildren(node);
-    for (auto* c : children) {
-        std::string cName(reinterpret_cast<const char*>(c->name));
-        auto iter = std::find(names.begin(), names.end(), cName);
-        if (iter != names.end()) {
+    for (auto* c = node->children; c != nullptr; c = c->next) {
+        if ((c->type == XML_ELEMENT_NODE) && isNameInList(c->name, names)) {
             return true;
         }
     }
@@ -371,46 +667,24 @@ bool XmlWrap::getAndCheckVersions(
     unsigned& deprecatedSince,
     ProtocolImpl& protocol)
 {
-    auto parentVersion = sinceVersion;
-    auto parentDeprecated = deprecatedSince;
-    auto sinceVerIter = props.find(common::sinceVersionStr());
-    do {
-        if (sinceVerIter == props.end()) {
-            assert(sinceVersion <= protocol.schemaImpl().version());
-            break;
-        }
-
-        auto& sinceVerStr = sinceVerIter->second;
-        bool ok = false;
-        sinceVersion = common::strToUnsigned(sinceVerStr, &ok);
-        if (!ok) {
-            reportUnexpectedPropertyValue(node, name, common::sinceVersionStr(), sinceVerStr, protocol.logger());
-            return false;
-        }
-
-    } while (false);
-
-    auto deprecatedIter = props.find(common::deprecatedStr());
-    do {
-        if (deprecatedIter == props.end()) {
-            break;
-        }
-
-        auto& deprecatedStr = deprecatedIter->second;
-        bool ok = false;
-        deprecatedSince = common::strToUnsigned(deprecatedStr, &ok);
-        if (!ok) {
-            XmlWrap::reportUnexpectedPropertyValue(node, name, common::deprecatedStr(), deprecatedStr, protocol.logger());
-            return false;
-        }
-
-    } while (false);
-
-    if (!checkVersions(node, sinceVersion, deprecatedSince, protocol, parentVersion, parentDeprecated)) {
-        return false;
-    }
+    return
+        getAndCheckVersionsImpl(
+            node, name, props, common::sinceVersionStr(), common::deprecatedStr(),
+            sinceVersion, deprecatedSince, protocol);
+}
 
-    return true;
+bool XmlWrap::getAndCheckVersions(
+    ::xmlNodePtr node,
+    const std::string& name,
+    const AtomPropsMap& props,
+    unsigned& sinceVersion,
+    unsigned& deprecatedSince,
+    ProtocolImpl& protocol)
+{
+    return
+        getAndCheckVersionsImpl(
+            node, name, props, Atom::SinceVersion, Atom::Deprecated,
+            sinceVersion, deprecatedSince, protocol);
 }
 
 bool XmlWrap::getAndCheckVersions(
@@ -433,58 +707,145 @@ bool XmlWrap::getAndCheckVersions(
     return getAndCheckVersions(node, name, props, sinceVersion, deprecatedSince, protocol);
 }
 
-XmlWrap::PropsMap XmlWrap::getExtraAttributes(::xmlNodePtr node, const XmlWrap::NamesList& names, ProtocolImpl& protocol)
+XmlWrap::AttributesMap XmlWrap::getExtraAttributes(::xmlNodePtr node, const XmlWrap::NamesList& names, ProtocolImpl& protocol)
 {
-    PropsMap attrs = XmlWrap::getUnknownProps(node, names);
-    auto& expectedPrefixes = protocol.extraElementPrefixes();
-    for (auto& a : attrs) {
-        bool expected =
-            std::any_of(
-                expectedPrefixes.begin(), expectedPrefixes.end(),
-                [&a](const std::string& prefix)
-                {
-                    if (a.first.size() < prefix.size()) {
-                        return false;
-                    }
+    return getExtraAttributes(node, {&names}, protocol);
+}
 
-                    return (a.first.compare(0, prefix.size(), prefix) == 0);
-                });
+XmlWrap::AttributesMap XmlWrap::getExtraAttributes(::xmlNodePtr node, NamesListsRefs names, ProtocolImpl& protocol)
+{
+    return getExtraAttributesImpl(node, names, protocol);
+}
 
-        if (!expected) {
-            commsdsl::logWarning(protocol.logger()) << logPrefix(node) <<
-                "Unexpected attribute \"" << a.first << "\".";
+XmlWrap::AttributesMap XmlWrap::getExtraAttributes(::xmlNodePtr node, const AtomsList& names, ProtocolImpl& protocol)
+{
+    return getExtraAttributes(node, {&names}, protocol);
+}
+
+XmlWrap::AttributesMap XmlWrap::getExtraAttributes(::xmlNodePtr node, AtomsListsRefs names, ProtocolImpl& protocol)
+{
+    return getExtraAttributesImpl(node, names, protocol);
+}
+
+XmlWrap::ContentsList XmlWrap::getExtraChildren(::xmlNodePtr node, const XmlWrap::NamesList& names, ProtocolImpl& protocol)
+{
+    return getExtraChildren(node, {&names}, protocol);
+}
+
+XmlWrap::ContentsList XmlWrap::getExtraChildren(::xmlNodePtr node, NamesListsRefs names, ProtocolImpl& protocol)
+{
+    return getExtraChildrenImpl(node, names, protocol);
+}
+
+XmlWrap::ContentsList XmlWrap::getExtraChildren(::xmlNodePtr node, const AtomsList& names, ProtocolImpl& protocol)
+{
+    return getExtraChildren(node, {&names}, protocol);
+}
+
+XmlWrap::ContentsList XmlWrap::getExtraChildren(::xmlNodePtr node, AtomsListsRefs names, ProtocolImpl& protocol)
+{
+    return getExtraChildrenImpl(node, names, protocol);
+}
+
+namespace
+{
+
+const std::uint64_t DigestPrime = 1099511628211ULL;
+
+std::uint64_t updateDigestWithData(std::uint64_t digest, const ::xmlChar* data)
+{
+    if (data != nullptr) {
+        for (; *data != 0; ++data) {
+            digest ^= static_cast<std::uint64_t>(*data);
+            digest *= DigestPrime;
         }
     }
 
-    return attrs;
+    // Separator
+    digest ^= 0xffU;
+    digest *= DigestPrime;
+    return digest;
 }
 
-XmlWrap::ContentsList XmlWrap::getExtraChildren(::xmlNodePtr node, const XmlWrap::NamesList& names, ProtocolImpl& protocol)
+bool isBlank(const ::xmlChar* data)
 {
-    ContentsList result;
-    auto extraChildren = XmlWrap::getUnknownChildren(node, names);
-    auto& expectedPrefixes = protocol.extraElementPrefixes();
-    for (auto c : extraChildren) {
-        std::string name(reinterpret_cast<const char*>(c->name));
-        bool expected =
-            std::any_of(
-                expectedPrefixes.begin(), expectedPrefixes.end(),
-                [&name](const std::string& prefix)
-                {
-                    if (name.size() < prefix.size()) {
-                        return false;
-                    }
+    if (data == nullptr) {
+        return true;
+    }
 
-                    return (name.compare(0, prefix.size(), prefix) == 0);
-                });
+    for (; *data != 0; ++data) {
+        if ((*data != ' ') && (*data != '\t') && (*data != '\n') && (*data != '\r')) {
+            return false;
+        }
+    }
+    return true;
+}
 
-        if (!expected) {
-            commsdsl::logWarning(protocol.logger()) << logPrefix(c) <<
-                "Unexpected element \"" << name << "\".";
+std::uint64_t updateDigestWithElement(std::uint64_t digest, ::xmlNodePtr node)
+{
+    digest = updateDigestWithData(digest, node->name);
+    for (auto* attr = node->properties; attr != nullptr; attr = attr->next) {
+        digest = updateDigestWithData(digest, attr->name);
+        XmlWrap::StringPtr value(::xmlNodeListGetString(node->doc, attr->children, 1));
+        digest = updateDigestWithData(digest, value.get());
+    }
+    return digest;
+}
+
+} // namespace
+
+std::uint64_t XmlWrap::combineDigests(std::uint64_t first, std::uint64_t second)
+{
+    for (auto idx = 0U; idx < sizeof(second); ++idx) {
+        first ^= (second >> (idx * 8U)) & 0xffU;
+        first *= DigestPrime;
+    }
+    return first;
+}
+
+std::uint64_t XmlWrap::updateDigest(std::uint64_t digest, ::xmlNodePtr node)
+{
+    if (node->type == XML_ELEMENT_NODE) {
+        digest = updateDigestWithElement(digest, node);
+        for (auto* child = node->children; child != nullptr; child = child->next) {
+            digest = updateDigest(digest, child);
         }
-        result.push_back(XmlWrap::getElementContent(c));
+
+        // Closes the element to distinguish siblings from children
+        return updateDigestWithData(digest, nullptr);
     }
-    return result;
+
+    if (((node->type == XML_TEXT_NODE) || (node->type == XML_CDATA_SECTION_NODE)) &&
+        (!isBlank(node->content))) {
+        digest = updateDigestWithData(digest, node->content);
+    }
+
+    return digest;
+}
+
+std::uint64_t XmlWrap::updateNamespaceDigest(std::uint64_t digest, ::xmlNodePtr node, const NamesList& skipNames)
+{
+    digest = updateDigestWithElement(digest, node);
+    for (auto* child = node->children; child != nullptr; child = child->next) {
+        if (child->type != XML_ELEMENT_NODE) {
+            digest = updateDigest(digest, child);
+            continue;
+        }
+
+        std::string name(reinterpret_cast<const char*>(child->name));
+        if (std::find(skipNames.begin(), skipNames.end(), name) != skipNames.end()) {
+            continue;
+        }
+
+        if (name == common::nsStr()) {
+            digest = updateNamespaceDigest(digest, child, skipNames);
+            continue;
+        }
+
+        digest = updateDigest(digest, child);
+    }
+
+    return updateDigestWithData(digest, nullptr);
 }
 
 } // namespace commsdsl
@@ -15,6 +15,8 @@
 
 #pragma once
 
+#include <cstdint>
+#include <initializer_list>
 #include <map>
 #include <string>
 #include <memory>
@@ -23,6 +25,7 @@
 #include <libxml/xmlmemory.h>
 #include <libxml/parser.h>
 
+#include "Atom.h"
 #include "Logger.h"
 #include "common.h"
 
@@ -32,7 +35,11 @@ namespace commsdsl
 class ProtocolImpl;
 struct XmlWrap
 {
-    using PropsMap = std::multimap<std::string, std::string>;
+    using PropsMap = common::PropsMap;
+    using AtomPropsMap = common::AtomPropsMap;
+    using AtomsList = commsdsl::AtomsList;
+    using AtomsListsRefs = commsdsl::AtomsListsRefs;
+    using AttributesMap = std::multimap<std::string, std::string>;
     struct CharFree
     {
         void operator()(::xmlChar* p) const
@@ -55,8 +62,17 @@ struct XmlWrap
     using NodesList = std::vector<::xmlNodePtr>;
     using ContentsList = std::vector<std::string>;
 
+    // Several names lists checked together without
+    // creating their concatenated copy.
+    using NamesListsRefs = std::initializer_list<const NamesList*>;
+
     static const NamesList& emptyNamesList();
+    static const AtomsList& emptyAtomsList();
     static PropsMap parseNodeProps(::xmlNodePtr node);
+
+    // Same as parseNodeProps(), the names are resolved to atoms, the
+    // attributes with unknown names are skipped.
+    static AtomPropsMap parseNodeAtomProps(::xmlNodePtr node);
     static NodesList getChildren(::xmlNodePtr node, const std::string& name = common::emptyString());
     static NodesList getChildren(::xmlNodePtr node, const NamesList& names);
     static std::string getText(::xmlNodePtr node);
@@ -73,8 +89,19 @@ struct XmlWrap
         PropsMap& props,
         bool mustHaveValues = true);
 
-    static PropsMap getUnknownProps(::xmlNodePtr node, const NamesList& names);
+    static bool parseChildrenAsProps(
+        ::xmlNodePtr node,
+        const AtomsList& names,
+        Logger& logger,
+        AtomPropsMap& props,
+        bool mustHaveValues = true);
+
+    static AttributesMap getUnknownProps(::xmlNodePtr node, const NamesList& names);
+    static AttributesMap getUnknownProps(::xmlNodePtr node, NamesListsRefs names);
+    static AttributesMap getUnknownProps(::xmlNodePtr node, AtomsListsRefs names);
     static NodesList getUnknownChildren(::xmlNodePtr node, const NamesList& names);
+    static NodesList getUnknownChildren(::xmlNodePtr node, NamesListsRefs names);
+    static NodesList getUnknownChildren(::xmlNodePtr node, AtomsListsRefs names);
     static std::string getElementContent(::xmlNodePtr node);
     static ContentsList getUnknownChildrenContents(::xmlNodePtr node, const NamesList& names);
     static std::string logPrefix(::xmlNodePtr node);
@@ -85,12 +112,25 @@ struct XmlWrap
         Logger& logger,
         bool mustHave = false);
 
+    static bool validateSinglePropInstance(
+        ::xmlNodePtr node,
+        const AtomPropsMap& props,
+        Atom prop,
+        Logger& logger,
+        bool mustHave = false);
+
     static bool validateNoPropInstance(
         ::xmlNodePtr node,
         const PropsMap& props,
         const std::string& str,
         Logger& logger);
 
+    static bool validateNoPropInstance(
+        ::xmlNodePtr node,
+        const AtomPropsMap& props,
+        Atom prop,
+        Logger& logger);
+
     static bool hasAnyChild(::xmlNodePtr node, const NamesList& names);
 
     static void reportUnexpectedPropertyValue(
@@ -116,6 +156,14 @@ struct XmlWrap
         unsigned& deprecatedSince,
         ProtocolImpl& protocol);
 
+    static bool getAndCheckVersions(
+        ::xmlNodePtr node,
+        const std::string& name,
+        const AtomPropsMap& props,
+        unsigned& sinceVersion,
+        unsigned& deprecatedSince,
+        ProtocolImpl& protocol);
+
     static bool getAndCheckVersions(
         ::xmlNodePtr node,
         const std::string& name,
@@ -123,15 +171,64 @@ struct XmlWrap
         unsigned& deprecatedSince,
         ProtocolImpl& protocol);
 
-    static PropsMap getExtraAttributes(
+    static AttributesMap getExtraAttributes(
         ::xmlNodePtr node,
         const XmlWrap::NamesList& names,
         ProtocolImpl& protocol);
 
+    static AttributesMap getExtraAttributes(
+        ::xmlNodePtr node,
+        NamesListsRefs names,
+        ProtocolImpl& protocol);
+
+    static AttributesMap getExtraAttributes(
+        ::xmlNodePtr node,
+        const AtomsList& names,
+        ProtocolImpl& protocol);
+
+    static AttributesMap getExtraAttributes(
+        ::xmlNodePtr node,
+        AtomsListsRefs names,
+        ProtocolImpl& protocol);
+
     static ContentsList getExtraChildren(
         ::xmlNodePtr node,
         const XmlWrap::NamesList& names,
         ProtocolImpl& protocol);
+
+    static ContentsList getExtraChildren(
+        ::xmlNodePtr node,
+        NamesListsRefs names,
+        ProtocolImpl& protocol);
+
+    static ContentsList getExtraChildren(
+        ::xmlNodePtr node,
+        const AtomsList& names,
+        ProtocolImpl& protocol);
+
+    static ContentsList getExtraChildren(
+        ::xmlNodePtr node,
+        AtomsListsRefs names,
+        ProtocolImpl& protocol);
+
+    // Updates FNV-1a digest with names, attributes and non-blank text of
+    // the node and all its descendants.
+    static std::uint64_t updateDigest(std::uint64_t digest, ::xmlNodePtr node);
+
+    // Same as updateDigest() for the schema or namespace node, the nested
+    // namespaces are processed the same way. The children with the skipped
+    // names are excluded together with their subtrees.
+    static std::uint64_t updateNamespaceDigest(
+        std::uint64_t digest,
+        ::xmlNodePtr node,
+        const NamesList& skipNames);
+
+    static std::uint64_t combineDigests(std::uint64_t first, std::uint64_t second);
+
+    static std::uint64_t initialDigest()
+    {
+        return 14695981039346656037ULL;
+    }
 };
 
 } // namespace commsdsl
@@ -20,6 +20,7 @@
 #include <cctype>
 #include <cmath>
 #include <cassert>
+#include <limits>
 
 namespace commsdsl
 {
@@ -1060,6 +1061,19 @@ const std::string& getStringProp(
     return iter->second;
 }
 
+const std::string& getStringProp(
+    const AtomPropsMap& map,
+    Atom prop,
+    const std::string& defaultValue)
+{
+    auto iter = map.find(prop);
+    if (iter == map.end()) {
+        return defaultValue;
+    }
+
+    return iter->second;
+}
+
 Endian parseEndian(const std::string& value, Endian defaultEndian)
 {
     if (value.empty()) {
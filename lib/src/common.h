@@ -22,6 +22,8 @@
 
 #include "commsdsl/Endian.h"
 #include "commsdsl/Units.h"
+#include "Atom.h"
+#include "FlatMultimap.h"
 
 namespace commsdsl
 {
@@ -29,7 +31,8 @@ namespace commsdsl
 namespace common
 {
 
-using PropsMap = std::multimap<std::string, std::string>;
+using PropsMap = FlatMultimap<std::string, std::string>;
+using AtomPropsMap = FlatMultimap<Atom, std::string>;
 
 const std::string& emptyString();
 const std::string& nameStr();
@@ -160,6 +163,11 @@ const std::string& getStringProp(
     const std::string& prop,
     const std::string& defaultValue = emptyString());
 
+const std::string& getStringProp(
+    const AtomPropsMap& map,
+    Atom prop,
+    const std::string& defaultValue = emptyString());
+
 Endian parseEndian(const std::string& value, Endian defaultEndian);
 
 void toLower(std::string& str);